@@ -8,45 +8,36 @@
 #include <Windows.h>
 #endif
 
+#include "motor_jogo.h"
+
 // Desafio Detective Quest
 // Tema 4 - Árvores e Tabela Hash
 // Este código inicial serve como base para o desenvolvimento das estruturas de navegação, pistas e suspeitos.
 // Use as instruções de cada região para desenvolver o sistema completo com árvore binária, árvore de busca e tabela hash.
 	
-// **** Definições de estruturas. ****
-
-/// @brief Define a struct para representar a pista. Contém um campo com um texto descritivo.
-struct Pista
-{
-	char pista[50];
-	struct Pista* esquerda;
-	struct Pista* direita;
-};
+// **** Definições de constantes. ****
 
-/// @brief Define uma struct com um alias Pista, para uso em uma estratégia BST.
-typedef struct Pista Pista;
-
-/// @brief Define um tipo personalizado(Sala) com campos para nome e ponteiros(esquerda e direita).
-struct Sala
+/// @brief Define as salas da mansão e suas pistas, com as saídas por índice.
+/// A navegação e a árvore de pistas ficam a cargo do motor do jogo.
+static const DescricaoSalaMotor SALAS_MANSAO[] =
 {
-	char pista[50];
-	char nome[50];
-	struct Sala* esquerda;
-	struct Sala* direita;
+	{ "Hall de Entrada", "O sistema de alarme não foi acionado.", 1, 2 }, // 0
+	{ "Area Reservada", "Há uma cápsula de projétil no chão.", 3, 4 }, // 1
+	{ "Sala de Estar", "Têm um vaso quebrado com algo dentro.", 9, 10 }, // 2
+	{ "Escadaria", "Há um colar despedaçado.", 5, 6 }, // 3
+	{ "O Corredor", "Têm uma mancha de sangue.", 7, 8 }, // 4
+	{ "A Suíte", "Há uma maçaneta quebrada.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 5
+	{ "Hidro", "Têm problemas elétricos.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 6
+	{ "Biblioteca", "Há livros jogados pelo chão.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 7
+	{ "Escritório", "A janela está quebrada.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 8
+	{ "A Sala de Jantar", "O café ainda está quente no copo.", 11, 12 }, // 9
+	{ "O Gazebo", "Os assentos estão bagunçados.", 13, 14 }, // 10
+	{ "A Cozinha", "Alguém deixou algo os aparelhos ligados.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 11
+	{ "Despensa", "Está aberta e desorganizada.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 12
+	{ "A Piscina", "Está parcialmente coberta.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 13
+	{ "Quadra", "A iluminação está parcial.", SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 14
 };
 
-/// @brief Define a struct com um alias Sala, para uso em uma estratégia BST.
-typedef struct Sala Sala;
-
-/// @brief Define uma enumeração(alias SeguirNaDirecao), usada na navegação de salas.
-typedef enum
-{
-	SeguirNaDirecao_NENHUM = 0,
-	SeguirNaDirecao_ESQUERDA = 1,
-	SeguirNaDirecao_DIREITA = 2,
-} SeguirNaDirecao;
-
-
 // **** Declarações das funções. ****
 
 // **** Funções de Interface de Usuário ****
@@ -55,97 +46,35 @@ typedef enum
 /// @param Inteiro. Ponteiro via referência, para conter o valor da opção escolhida.
 void exibirMenuPrincipal(int* opcao);
 /// @brief Exibe e monitora o estado atual resultante da investigação,
-/// em função nó atualmente visitado(Sala).
-/// @param Sala. Ponteiro para recuperação de informações. Somente leitura.
-void exibirEstadoInvestigacao(const Sala* noLocal);
+/// em função da sala atualmente visitada.
+/// @param Texto. Nome da sala atual, ou NULL quando não há sala na direção escolhida.
+void exibirEstadoInvestigacao(const char* nomeSala);
+/// @brief Exibe os eventos pendentes do motor do jogo.
+/// @param MotorJogo. Ponteiro via referência, usado na retirada dos eventos.
+void exibirEventos(MotorJogo* motor);
 
 // **** Funções de Lógica Principal e Gerenciamento de Memória ****
 
-/// @brief Cria um ponteiro para referência ao nó(Sala) raiz principal.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* criarMansao();
-/// @brief Cria os nós de forma manual, usando um ponteiro via
-/// referência ao nó(Sala) raiz principal.
-void criarSalas(Sala* mansao);
-/// @brief Explora os nós de forma hierárquica, simulando uma navegação.
+/// @brief Cria o motor do jogo para a mansão fixa deste nível.
+/// @returns MotorJogo. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+MotorJogo* criarMansao();
+/// @brief Explora as salas coletando a pista da sala atual antes de seguir na direção escolhida.
+/// Sem sala nessa direção, o motor volta à entrada da mansão.
 /// @param Enumeração. Valor descrevendo a direção a seguir na navegação.
-/// @param Sala. Ponteiro via referência, usado para exploração das salas.
-/// @param Sala. Ponteiro via referência, usado para valor padrão, em caso de recuo na navegação.
-/// @param Pista. Ponteiro via referência, usado para leitura e atribuição no processo de navegação.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* explorarSalasComPistas(SeguirNaDirecao direcao, Sala* atual, Sala* mansao, Pista** pista);
-/// @brief Cria um ponteiro para um nó, tipo Sala.
-/// Baseado no conteúdo da plataforma.
-/// @param Texto. Valor descrevendo o nome da Sala.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* criarSala(const char* nome, const char* pista);
-/// @brief Efetua uma inserção na árvore para BST, tipo Sala.
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro via referência, usado na inserção.
-/// @param Texto. Valor descrevendo o nome da Sala.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* inserirSala(Sala* raiz, const char* nome);
-/// @brief Cria um ponteiro para um nó, tipo Pista.
-/// Baseado no conteúdo da plataforma.
-/// @param Texto. Valor descrevendo a pista.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Pista* criarPista(const char* pista);
-/// @brief Efetua uma inserção na árvore para BST, tipo Pista.
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro via referência, usado na inserção.
-/// @param Texto. Valor descrevendo a pista.
-/// @returns Pista. Ponteiro do tipo conforme especificado.
-Pista* inserirPista(Pista* raiz, const char* pista);
-/// @brief Efetua a exibição de informações sobre as pistas.
-/// @param Pista. Ponteiro via referência, usado na recuperação de informações. Somente leitura.
-/// @returns Pista. Ponteiro do tipo conforme especificado.
-void exibirPistas(const Pista* pista);
-/// @brief Recupera informações sobre a altura de uma árvore(composição hierárquica).
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro usado na recuperação de informações. Somente leitura.
-/// @returns Inteiro. Valor informando a altura, conforme especificado.
-int altura(const Sala* raiz);
-/// @brief Recupera informações sobre a profundidade(a nível recursivo) 
-/// de uma árvore(composição hierárquica). Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz usado na recuperação de informações. Somente leitura.
-/// @param Sala. Ponteiro alvo a ser usado como para consulta de profundidade. Somente leitura.
-/// @param Inteiro. Valor representando o nível máximo de chamadas recursivas permitidas.
-/// @returns Inteiro. Valor informando a profundidade, conforme especificado.
-int profundidade(const Sala* raiz, const Sala* alvo, int nivel);
-/// @brief Efetua a pré-ordenação de um nó e seus descendentes. Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de pré-ordenação.
-void preOrdem(const Sala* raiz);
-/// @brief Efetua a ordenação de um nó e seus descendentes. Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de ordenação.
-void emOrdem(const Sala* raiz);
-/// @brief Efetua a ordenação de um nó e seus descendentes. Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de ordenação. Somente leitura.
-void exibirPistasEmOrdem(const Pista* raiz);
-/// @brief Efetua a pós-ordenação de um nó e seus descendentes.
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de pós-ordenação.
-void posOrdem(const Sala* raiz);
-/// @brief Libera a memória alocada para um nó e seus descendentes, usando chamadas recursivas.
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de liberação.
-void liberarSala(Sala* raiz);
-/// @brief Libera a memória alocada para um nó e seus descendentes, usando chamadas recursivas.
-/// Baseado no conteúdo da plataforma.
-/// @param Pista. Ponteiro raiz, via referência, usado na operação de liberação.
-void liberarPista(Pista* raiz);
-/// @brief Libera a memória alocada para um nó e seus descendentes.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de liberação.
-/// @param Pista. Ponteiro raiz, via referência, usado na operação de liberação.
-void liberarMemoria(Sala* raiz, Pista* pista);
+/// @param MotorJogo. Ponteiro via referência, usado para exploração das salas e coleta das pistas.
+void explorarSalasComPistas(DirecaoMotor direcao, MotorJogo* motor);
+/// @brief Efetua a exibição das pistas coletadas, em ordem alfabética pt-BR(ordem da árvore de pistas).
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+void exibirPistas(const MotorJogo* motor);
+/// @brief Libera a memória alocada para o motor do jogo e suas pistas.
+/// @param MotorJogo. Ponteiro via referência, usado na operação de liberação.
+void liberarMemoria(MotorJogo* motor);
 
 // **** Funções utilitárias ****
 
 /// @brief Limpa o buffer de entrada do teclado (stdin), evitando problemas 
 /// com leituras consecutivas de scanf e getchar.
 void limparBufferEntrada();
-/// @brief Função para limpar '\n' deixado pelo fgets.
-/// @param str Conteúdo do texto a ser analisado e limpo.
-void limparEnter(char* str);
 
 /// @brief Ponto de entrada do programa.
 /// @returns Inteiro. Zero, em caso de sucesso. Ex: EXIT_SUCCESS. 
@@ -154,13 +83,12 @@ int main() {
 
 	// 🔍 Nível Aventureiro: Armazenamento de Pistas com Árvore de Busca
 	//
-	// - Crie uma struct Pista com campo texto (string).
-	// - Crie uma árvore binária de busca (BST) para inserir as pistas coletadas.
-	// - Ao visitar salas específicas, adicione pistas automaticamente com inserirBST().
-	// - Implemente uma função para exibir as pistas em ordem alfabética (emOrdem()).
-	// - Utilize alocação dinâmica e comparação de strings (strcmp) para organizar.
-	// - Não precisa remover ou balancear a árvore.
-	// - Use funções para modularizar: inserirPista(), listarPistas().
+	// - Cada sala de SALAS_MANSAO traz a sua pista, coletada pelo motor do jogo ao sair da sala.
+	// - As pistas coletadas ficam na árvore de pistas do motor(struct Pista, de arvore_pistas.h).
+	// - A árvore é uma AVL em ordem alfabética pt-BR(chave de colação), e não por strcmp:
+	//   acentos e maiúsculas não mudam a posição de uma pista.
+	// - Uma pista repetida não é inserida de novo; não há remoção durante a exploração.
+	// - Use funções para modularizar: explorarSalasComPistas(), exibirPistas().
 	// - A árvore de pistas deve ser exibida quando o jogador quiser revisar evidências.	
 
 	// Configurações de caracteres para ajuste de ortografia para saída do console(UTF-8).
@@ -175,17 +103,17 @@ int main() {
 
 	int opcao = 0;
 
-	Sala* mansao = criarMansao();
-
-	criarSalas(mansao);
-
-	Sala* atual = mansao; // Definindo o valor padrão inicial para a navegação.
-
-	Pista* pista = NULL; // Preparando um ponteiro para conter uma referência para os nós das pistas.
+	MotorJogo* motor = criarMansao();
+	if (motor == NULL)
+	{
+		return EXIT_FAILURE;
+	}
 
 	do
 	{
-		exibirEstadoInvestigacao(atual);
+		exibirEventos(motor);
+
+		exibirEstadoInvestigacao(SALAS_MANSAO[salaAtualMotorJogo(motor)].nome);
 
 		exibirMenuPrincipal(&opcao);
 
@@ -193,14 +121,14 @@ int main() {
 		{
 		case 1:
 			// Ir para a esquerda.
-			atual = explorarSalasComPistas(SeguirNaDirecao_ESQUERDA, atual, mansao, &pista);
+			explorarSalasComPistas(DirecaoMotor_ESQUERDA, motor);
 			break;
 		case 2:
 			// Ir para a direita.
-			atual = explorarSalasComPistas(SeguirNaDirecao_DIREITA, atual, mansao, &pista);
+			explorarSalasComPistas(DirecaoMotor_DIREITA, motor);
 			break;
 		case 0:
-			exibirPistas(pista);
+			exibirPistas(motor);
 			//  0  Sair.
 			printf("\n==== Saindo do sistema... ====\n");
 			break;
@@ -213,7 +141,7 @@ int main() {
 	} while (opcao != 0);
 
 
-	liberarMemoria(mansao, pista);
+	liberarMemoria(motor);
 
 	printf("\n==== Operação encerrada. ====\n");
 
@@ -271,279 +199,75 @@ void exibirMenuPrincipal(int* opcao)
 	}
 }
 
-void exibirEstadoInvestigacao(const Sala* noLocal)
+void exibirEstadoInvestigacao(const char* nomeSala)
 {
-	if (noLocal == NULL)
+	if (nomeSala == NULL)
 	{
 		printf("\n ====  🚫  Nada existe além do local atual.  🚩 ==== \n");
 		printf("\n  ℹ️  Vamos voltar ao ponto de partida.\n");
 		return;
 	}
 
-	printf("\n ====  ℹ️  No momento, você se encontra neste local: %s  🚩 ==== \n", noLocal->nome);
+	printf("\n ====  ℹ️  No momento, você se encontra neste local: %s  🚩 ==== \n", nomeSala);
 }
 
-// **** Funções de Lógica Principal e Gerenciamento de Memória ****
-
-Sala* criarMansao()
-{
-	return criarSala("Hall de Entrada", "O sistema de alarme não foi acionado.");
-}
-
-void criarSalas(Sala* mansao)
+void exibirEventos(MotorJogo* motor)
 {
-	// Criação de nós de forma explícita(manual), procurando seguir uma ordem para a 
-	// otimização por busca alfabética do algoritmo. Por exemplo, o BST(Binary Search Tree),
-	// usando o conteúdo do texto. Mas ainda assim, ao menos conseguimos simular uma hierarquia
-	// baseada no posicionamento para a navegação de nós do nosso desafio atual.
-
-	mansao->esquerda = criarSala("Area Reservada", "Há uma cápsula de projétil no chão.");
-	mansao->direita = criarSala("Sala de Estar", "Têm um vaso quebrado com algo dentro.");
-
-	mansao->esquerda->esquerda = criarSala("Escadaria", "Há um colar despedaçado.");
-	mansao->esquerda->direita = criarSala("O Corredor", "Têm uma mancha de sangue.");
-
-	mansao->esquerda->esquerda->esquerda = criarSala("A Suíte", "Há uma maçaneta quebrada.");
-	mansao->esquerda->esquerda->direita = criarSala("Hidro", "Têm problemas elétricos.");
-
-	mansao->esquerda->direita->esquerda = criarSala("Biblioteca", "Há livros jogados pelo chão.");
-	mansao->esquerda->direita->direita = criarSala("Escritório", "A janela está quebrada.");
-
-	mansao->direita->esquerda = criarSala("A Sala de Jantar", "O café ainda está quente no copo.");
-	mansao->direita->direita = criarSala("O Gazebo", "Os assentos estão bagunçados.");
-
-	mansao->direita->esquerda->esquerda = criarSala("A Cozinha", "Alguém deixou algo os aparelhos ligados.");
-	mansao->direita->esquerda->direita = criarSala("Despensa", "Está aberta e desorganizada.");
-
-	mansao->direita->direita->esquerda = criarSala("A Piscina", "Está parcialmente coberta.");
-	mansao->direita->direita->direita = criarSala("Quadra", "A iluminação está parcial.");
-}
-
-Sala* explorarSalasComPistas(SeguirNaDirecao direcao, Sala* atual, Sala* mansao, Pista** pista)
-{
-	if (atual == NULL)
+	// Apenas o fim do caminho tem mensagem própria; a sala atual é exibida a cada rodada do menu.
+	EventoMotor evento;
+	while (proximoEventoMotorJogo(motor, &evento))
 	{
-		return NULL;
-	}
-
-	if (atual != NULL && atual->pista != NULL)
-	{
-		*pista = inserirPista(*pista, atual->pista);		
-	}
-
-	// Caso o ponto de navegação atual resulte em um nó folha, vamos voltar
-	// automaticamente à referência mais alta. Neste nível de desafio, é indefinido
-	// em que momento a investigação deveria terminar, até o jogador decidir sair.
-	switch (direcao)
-	{
-	case SeguirNaDirecao_ESQUERDA:		
-
-		if (atual->esquerda == NULL)
+		if (evento.tipo == EventoMotor_FIM_DO_CAMINHO)
 		{
-			exibirEstadoInvestigacao(atual->esquerda);
-			return mansao;
+			exibirEstadoInvestigacao(NULL);
 		}
-
-		return atual->esquerda;
-
-	case SeguirNaDirecao_DIREITA:
-
-		if (atual->direita == NULL)
-		{
-			exibirEstadoInvestigacao(atual->direita);
-			return mansao;
-		}		
-
-		return atual->direita;
-
-	default:
-		return NULL;
 	}
 }
 
-Sala* criarSala(const char* nome, const char* pista)
-{
-	Sala* novo = (Sala*)malloc(sizeof(Sala));
-	if (novo == NULL)
-	{
-		printf("\n  ❌  Erro ao tentar alocar a memória para o novo nó.\n");
-		return NULL;
-	}
-
-	strcpy(novo->nome, nome);
-	strcpy(novo->pista, pista);
-	novo->esquerda = NULL;
-	novo->direita = NULL;
-
-	return novo;
-}
+// **** Funções de Lógica Principal e Gerenciamento de Memória ****
 
-Pista* criarPista(const char* pista)
+MotorJogo* criarMansao()
 {
-	Pista* novo = (Pista*)malloc(sizeof(Pista));
-	if (novo == NULL)
+	// Neste nível não há suspeitos: as pistas vão apenas para a árvore de busca, e uma saída
+	// inexistente leva de volta à entrada, até o jogador decidir sair.
+	DescricaoCasoMotor caso = { 0 };
+	caso.salas = SALAS_MANSAO;
+	caso.totalSalas = (int32_t)(sizeof(SALAS_MANSAO) / sizeof(SALAS_MANSAO[0]));
+	caso.voltarAoInicio = true;
+
+	MotorJogo* motor = NULL;
+	StatusMotor status = criarMotorJogo(&caso, (uint64_t)time(NULL), &motor);
+	if (status != StatusMotor_OK)
 	{
-		printf("\n  ❌  Erro ao tentar alocar a memória para o novo nó.\n");
+		printf("\n  ❌  Erro ao tentar criar o motor do jogo: %s\n", descreverStatusMotor(status));
 		return NULL;
 	}
 
-	strcpy(novo->pista, pista);
-	novo->esquerda = NULL;
-	novo->direita = NULL;
-
-	return novo;
-}
-
-Sala* inserirSala(Sala* raiz, const char* nome)
-{
-	// Se o nó atual ainda não existe(portanto, não possui nós filhos), então será criado.
-	if (raiz == NULL)
-	{
-		return criarSala(nome, nome);
-	}
-	// Verificamos se o nome correspondente é um valor menor que o atual atual.
-	// Feito isso, atribui o nó de menor valor à esquerda.
-	if (strcmp(nome, raiz->nome) < 0)
-	{
-		raiz->esquerda = inserirSala(raiz->esquerda, nome);
-	}
-	else if (strcmp(nome, raiz->nome) > 0)
-	{
-		// Caso contrário, atribui o nó à direita.
-		raiz->direita = inserirSala(raiz->direita, nome);
-	}
-
-	return raiz;
+	return motor;
 }
 
-Pista* inserirPista(Pista* raiz, const char* pista)
+void explorarSalasComPistas(DirecaoMotor direcao, MotorJogo* motor)
 {
-	// Se o nó atual ainda não existe(portanto, não possui nós filhos), então será criado.
-	if (raiz == NULL)
-	{
-		return criarPista(pista);
-	}
-	// Verificamos se o nome correspondente é um valor menor que o atual atual.
-	// Feito isso, atribui o nó de menor valor à esquerda.
-	if (strcmp(pista, raiz->pista) < 0)
-	{
-		raiz->esquerda = inserirPista(raiz->esquerda, pista);
-	}
-	else if (strcmp(pista, raiz->pista) > 0)
-	{
-		// Caso contrário, se o valor é maior, atribui o nó à direita.
-		raiz->direita = inserirPista(raiz->direita, pista);
-	}
-
-	return raiz;
+	// Uma pista já coletada(StatusMotor_PISTA_REPETIDA) não é inserida de novo na árvore.
+	coletarPistaMotorJogo(motor);
+	moverMotorJogo(motor, direcao);
 }
 
-int altura(const Sala* raiz)
-{
-	if (raiz == NULL)
-	{
-		return 0;
-	}
-
-	int alt_esq = altura(raiz->esquerda);
-	int alt_dir = altura(raiz->direita);
-	return 1 + (alt_esq > alt_dir ? alt_esq : alt_dir);
-}
-
-int profundidade(const Sala* raiz, const Sala* alvo, int nivel)
-{
-	if (raiz == NULL)
-	{
-		return -1;
-	}
-
-	if (raiz == alvo)
-	{
-		return nivel;
-	}
-
-	int esq = profundidade(raiz->esquerda, alvo, nivel + 1);
-
-	if (esq != -1)
-	{
-		return esq;
-	}
-
-	return profundidade(raiz->direita, alvo, nivel + 1);
-}
-
-void preOrdem(const Sala* raiz)
-{
-	if (raiz != NULL)
-	{
-		printf(" • %s\n", raiz->nome);
-		preOrdem(raiz->esquerda);
-		preOrdem(raiz->direita);
-	}
-}
-
-void emOrdem(const Sala* raiz)
-{
-	if (raiz != NULL)
-	{
-		emOrdem(raiz->esquerda);
-		printf(" • %s\n", raiz->nome);
-		emOrdem(raiz->direita);
-	}
-}
-
-void exibirPistasEmOrdem(const Pista* raiz)
-{
-	if (raiz == NULL)
-	{
-		return;
-	}
-	exibirPistasEmOrdem(raiz->esquerda);
-	printf("\n • %s\n", raiz->pista);
-	exibirPistasEmOrdem(raiz->direita);
-}
-
-void exibirPistas(const Pista* pista) 
+void exibirPistas(const MotorJogo* motor)
 {
 	printf("\n  ℹ️  Descrição das pistas encontradas até o momento:\n");
 
-	exibirPistasEmOrdem(pista);
-}
-
-void posOrdem(const Sala* raiz)
-{
-	if (raiz != NULL)
+	const char* pistas[sizeof(SALAS_MANSAO) / sizeof(SALAS_MANSAO[0])];
+	int32_t total = listarPistasMotorJogo(motor, pistas, (int32_t)(sizeof(pistas) / sizeof(pistas[0])));
+	for (int32_t i = 0; i < total; i++)
 	{
-		posOrdem(raiz->esquerda);
-		posOrdem(raiz->direita);
-		printf(" • %s\n", raiz->nome);
+		printf("\n • %s\n", pistas[i]);
 	}
 }
 
-void liberarSala(Sala* raiz)
+void liberarMemoria(MotorJogo* motor)
 {
-	if (raiz != NULL)
-	{
-		liberarSala(raiz->esquerda);
-		liberarSala(raiz->direita);
-		free(raiz);
-	}
-}
-
-void liberarPista(Pista* raiz)
-{
-	if (raiz != NULL)
-	{
-		liberarPista(raiz->esquerda);
-		liberarPista(raiz->direita);
-		free(raiz);
-	}
-}
-
-void liberarMemoria(Sala* raiz, Pista* pista)
-{
-	liberarSala(raiz);
-	liberarPista(pista);
+	liberarMotorJogo(motor);
 
 	printf("\n  ✅  Memória alocada para os nós liberada com sucesso.\n");
 }
@@ -555,8 +279,3 @@ void limparBufferEntrada()
 	int c;
 	while ((c = getchar()) != '\n' && c != EOF);
 }
-
-void limparEnter(char* str)
-{
-	str[strcspn(str, "\n")] = '\0';
-}
\ No newline at end of file
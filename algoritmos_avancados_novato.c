@@ -8,32 +8,35 @@
 #include <Windows.h>
 #endif
 
+#include "motor_jogo.h"
+
 // Desafio Detective Quest
 // Tema 4 - Árvores e Tabela Hash
 // Este código inicial serve como base para o desenvolvimento das estruturas de navegação, pistas e suspeitos.
 // Use as instruções de cada região para desenvolver o sistema completo com árvore binária, árvore de busca e tabela hash.
 
-// **** Definições de estruturas. ****
-
-/// @brief Define um tipo personalizado(Sala) com campos para nome e ponteiros(esquerda e direita).
-struct Sala
-{
-	char nome[50];
-	struct Sala* esquerda;
-	struct Sala* direita;
+// **** Definições de constantes. ****
+
+/// @brief Define as salas da mansão, com as saídas por índice. A navegação fica a cargo do motor do jogo.
+static const DescricaoSalaMotor SALAS_MANSAO[] =
+{
+	{ "Hall de Entrada", NULL, 1, 2 }, // 0
+	{ "Area Reservada", NULL, 3, 4 }, // 1
+	{ "Sala de Estar", NULL, 9, 10 }, // 2
+	{ "Escadaria", NULL, 5, 6 }, // 3
+	{ "O Corredor", NULL, 7, 8 }, // 4
+	{ "A Suíte", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 5
+	{ "Hidro", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 6
+	{ "Biblioteca", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 7
+	{ "Escritório", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 8
+	{ "A Sala de Jantar", NULL, 11, 12 }, // 9
+	{ "O Gazebo", NULL, 13, 14 }, // 10
+	{ "A Cozinha", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 11
+	{ "Despensa", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 12
+	{ "A Piscina", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 13
+	{ "Quadra", NULL, SEM_INDICE_MOTOR, SEM_INDICE_MOTOR }, // 14
 };
 
-/// @brief Define uma struct com um alias Sala.
-typedef struct Sala Sala;
-
-/// @brief Define uma enumeração(alias SeguirNaDirecao), usada na navegação de salas.
-typedef enum
-{
-	SeguirNaDirecao_NENHUM = 0,
-	SeguirNaDirecao_ESQUERDA = 1,
-	SeguirNaDirecao_DIREITA = 2,
-} SeguirNaDirecao;
-
 // **** Declarações das funções. ****
 
 // **** Funções de Interface de Usuário ****
@@ -42,69 +45,29 @@ typedef enum
 /// @param Inteiro. Ponteiro via referência, para conter o valor da opção escolhida.
 void exibirMenuPrincipal(int* opcao);
 /// @brief Exibe e monitora o estado atual resultante da investigação,
-/// em função nó atualmente visitado(Sala).
-/// @param Sala. Ponteiro para recuperação de informações. Somente leitura.
-void exibirEstadoInvestigacao(const Sala* noLocal);
+/// em função da sala atualmente visitada.
+/// @param Texto. Nome da sala atual, ou NULL quando não há sala na direção escolhida.
+void exibirEstadoInvestigacao(const char* nomeSala);
 
 // **** Funções de Lógica Principal e Gerenciamento de Memória ****
 
-/// @brief Cria um ponteiro para referência ao nó(Sala) raiz principal.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* criarMansao();
-/// @brief Cria os nós de forma manual, usando um ponteiro via referência ao nó(Sala) raiz principal.
-void criarSalas(Sala* mansao);
-/// @brief Explora os nós de forma hierárquica, simulando uma navegação.
+/// @brief Cria o motor do jogo para a mansão fixa deste nível.
+/// @returns MotorJogo. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+MotorJogo* criarMansao();
+/// @brief Explora as salas, delegando o movimento ao motor do jogo.
 /// @param Enumeração. Valor descrevendo a direção a seguir na navegação.
-/// @param Sala. Ponteiro, usado para exploração das salas.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* explorarSalas(SeguirNaDirecao direcao, Sala* atual);
-/// @brief Cria um ponteiro para um nó, tipo Sala. Baseado no conteúdo da plataforma.
-/// @param Texto. Valor descrevendo o nome da Sala.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* criarSala(const char* nome);
-/// @brief Cria um ponteiro para um nó, tipo Sala. Baseado no conteúdo da plataforma.
-/// @param Texto. Valor descrevendo o nome da Sala.
-/// @returns Sala. Ponteiro do tipo conforme especificado.
-Sala* inserirSala(Sala* raiz, const char* nome);
-/// @brief Recupera informações sobre a altura de uma árvore(composição hierárquica).
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro usado na recuperação de informações. Somente leitura.
-/// @returns Inteiro. Valor informando a altura, conforme especificado.
-int altura(const Sala* raiz);
-/// @brief Recupera informações sobre a profundidade(a nível recursivo) 
-/// de uma árvore(composição hierárquica). Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz usado na recuperação de informações. Somente leitura.
-/// @param Sala. Ponteiro alvo a ser usado como para consulta de profundidade. Somente leitura.
-/// @param Inteiro. Valor representando o nível máximo de chamadas recursivas permitidas.
-/// @returns Inteiro. Valor informando a profundidade, conforme especificado.
-int profundidade(const Sala* raiz, const Sala* alvo, int nivel);
-/// @brief Efetua a pré-ordenação de um nó e seus descendentes. Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de pré-ordenação.
-void preOrdem(const Sala* raiz);
-/// @brief Efetua a ordenação de um nó e seus descendentes.
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de ordenação.
-void emOrdem(const Sala* raiz);
-/// @brief Efetua a pós-ordenação de um nó e seus descendentes.
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de pós-ordenação.
-void posOrdem(const Sala* raiz);
-/// @brief Libera a memória alocada para um nó e seus descendentes, usando chamadas recursivas.
-/// Baseado no conteúdo da plataforma.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de liberação.
-void liberarSala(Sala* raiz);
-/// @brief Libera a memória alocada para um nó e seus descendentes.
-/// @param Sala. Ponteiro raiz, via referência, usado na operação de liberação.
-void liberarMemoria(Sala* raiz);
+/// @param MotorJogo. Ponteiro via referência, usado para exploração das salas.
+/// @returns Texto. Nome da sala de destino, ou NULL quando não há sala na direção escolhida.
+const char* explorarSalas(DirecaoMotor direcao, MotorJogo* motor);
+/// @brief Libera a memória alocada para o motor do jogo.
+/// @param MotorJogo. Ponteiro via referência, usado na operação de liberação.
+void liberarMemoria(MotorJogo* motor);
 
 // **** Funções utilitárias ****
 
 /// @brief Limpa o buffer de entrada do teclado (stdin), evitando problemas 
 /// com leituras consecutivas de scanf e getchar.
 void limparBufferEntrada();
-/// @brief Função para limpar '\n' deixado pelo fgets.
-/// @param str Conteúdo do texto a ser analisado e limpo.
-void limparEnter(char* str);
 
 /// @brief Ponto de entrada do programa.
 /// @returns Inteiro. Zero, em caso de sucesso. Ex: EXIT_SUCCESS. 
@@ -113,13 +76,13 @@ int main() {
 
 	// 🌱 Nível Novato: Mapa da Mansão com Árvore Binária
 	//
-	// - Crie uma struct Sala com nome, e dois ponteiros: esquerda e direita.
-	// - Use funções como criarSala(), conectarSalas() e explorarSalas().
-	// - A árvore pode ser fixa: Hall de Entrada, Biblioteca, Cozinha, Sótão etc.
+	// - As salas ficam na tabela SALAS_MANSAO: nome e os índices das salas à esquerda e à direita.
+	// - A mansão é entregue ao motor do jogo(criarMansao()), e explorarSalas() segue pelo motor.
+	// - A árvore é fixa: Hall de Entrada, Biblioteca, Cozinha, Escritório etc.
 	// - O jogador deve poder explorar indo à esquerda (e) ou à direita (d).
 	// - Finalize a exploração com uma opção de saída (s).
 	// - Exiba o nome da sala a cada movimento.
-	// - Use recursão ou laços para caminhar pela árvore.
+	// - O motor caminha pela árvore pelos índices das saídas, sem recursão.
 	// - Nenhuma inserção dinâmica é necessária neste nível.	
 
 	// Configurações de caracteres para ajuste de ortografia para saída do console(UTF-8).
@@ -134,11 +97,13 @@ int main() {
 
 	int opcao = 0;
 
-	Sala* mansao = criarMansao();
-
-	criarSalas(mansao);
+	MotorJogo* motor = criarMansao();
+	if (motor == NULL)
+	{
+		return EXIT_FAILURE;
+	}
 
-	Sala* atual = mansao;
+	const char* atual = SALAS_MANSAO[salaAtualMotorJogo(motor)].nome;
 
 	do
 	{
@@ -155,11 +120,11 @@ int main() {
 		{
 		case 1:
 			// Ir para a esquerda.
-			atual = explorarSalas(SeguirNaDirecao_ESQUERDA, atual);
+			atual = explorarSalas(DirecaoMotor_ESQUERDA, motor);
 			break;
 		case 2:
 			// Ir para a direita.
-			atual = explorarSalas(SeguirNaDirecao_DIREITA, atual);
+			atual = explorarSalas(DirecaoMotor_DIREITA, motor);
 			break;
 		case 0:
 			//  0  Sair.
@@ -174,7 +139,7 @@ int main() {
 	} while (opcao != 0);
 
 
-	liberarMemoria(mansao);
+	liberarMemoria(motor);
 
 	printf("\n==== Operação encerrada. ====\n");
 
@@ -231,185 +196,52 @@ void exibirMenuPrincipal(int* opcao)
 	}
 }
 
-void exibirEstadoInvestigacao(const Sala* noLocal)
+void exibirEstadoInvestigacao(const char* nomeSala)
 {
-	if (noLocal == NULL)
-	{		
+	if (nomeSala == NULL)
+	{
 		printf("\n ====  🚫  Nada existe além do local atual.  🚩 ==== \n");
 		printf("\n  ℹ️  A exploração terminou.\n");
 		return;
 	}
 
-	printf("\n ====  ℹ️  No momento, você se encontra neste local: %s  🚩 ==== \n", noLocal->nome);
+	printf("\n ====  ℹ️  No momento, você se encontra neste local: %s  🚩 ==== \n", nomeSala);
 }
 
 // **** Funções de Lógica Principal e Gerenciamento de Memória ****
 
-Sala* criarMansao()
-{
-	return criarSala("Hall de Entrada");
-}
-
-void criarSalas(Sala* mansao)
-{	
-	// Criação de nós de forma explícita(manual), procurando seguir uma ordem para a 
-	// otimização por busca alfabética do algoritmo. Por exemplo, o BST(Binary Search Tree),
-	// usando o conteúdo do texto. Mas ainda assim, ao menos conseguimos simular uma hierarquia
-	// baseada no posicionamento para a navegação de nós do nosso desafio atual.
-
-	mansao->esquerda = criarSala("Area Reservada");
-	mansao->direita = criarSala("Sala de Estar");
-
-	mansao->esquerda->esquerda = criarSala("Escadaria");
-	mansao->esquerda->direita = criarSala("O Corredor");
-
-	mansao->esquerda->esquerda->esquerda = criarSala("A Suíte");
-	mansao->esquerda->esquerda->direita = criarSala("Hidro");
-
-	mansao->esquerda->direita->esquerda = criarSala("Biblioteca");
-	mansao->esquerda->direita->direita = criarSala("Escritório");
-
-	mansao->direita->esquerda = criarSala("A Sala de Jantar");
-	mansao->direita->direita = criarSala("O Gazebo");
-
-	mansao->direita->esquerda->esquerda = criarSala("A Cozinha");
-	mansao->direita->esquerda->direita = criarSala("Despensa");
-
-	mansao->direita->direita->esquerda = criarSala("A Piscina");
-	mansao->direita->direita->direita = criarSala("Quadra");
-}
-
-Sala* explorarSalas(SeguirNaDirecao direcao, Sala* atual)
+MotorJogo* criarMansao()
 {
-	if (atual == NULL)
-	{		
-		return NULL;
-	}
-	switch (direcao)
-	{
-	case SeguirNaDirecao_ESQUERDA:
-		return atual->esquerda;		
-	case SeguirNaDirecao_DIREITA:		
-		return atual->direita;		
-	default:
-		return NULL;		
-	}
-}
+	// Neste nível não há pistas nem suspeitos: uma saída inexistente encerra a exploração.
+	DescricaoCasoMotor caso = { 0 };
+	caso.salas = SALAS_MANSAO;
+	caso.totalSalas = (int32_t)(sizeof(SALAS_MANSAO) / sizeof(SALAS_MANSAO[0]));
+	caso.voltarAoInicio = false;
 
-Sala* criarSala(const char* nome)
-{
-	Sala* novo = (Sala*)malloc(sizeof(Sala));
-	if (novo == NULL)
+	MotorJogo* motor = NULL;
+	StatusMotor status = criarMotorJogo(&caso, (uint64_t)time(NULL), &motor);
+	if (status != StatusMotor_OK)
 	{
-		printf("\n  ❌  Erro ao tentar alocar a memória para o novo nó.\n");
+		printf("\n  ❌  Erro ao tentar criar o motor do jogo: %s\n", descreverStatusMotor(status));
 		return NULL;
 	}
 
-	strcpy(novo->nome, nome);
-	novo->esquerda = NULL;
-	novo->direita = NULL;
-
-	return novo;
-}
-
-Sala* inserirSala(Sala* raiz, const char* nome)
-{
-	// Se o nó atual ainda não existe(portanto, não possui nós filhos), então será criado.
-	if (raiz == NULL)
-	{
-		return criarSala(nome);
-	}
-	// Verificamos se o nome correspondente é diferente do atual. Feito isso, atribui o nó.
-	if (strcmp(nome, raiz->nome) < 0)
-	{
-		raiz->esquerda = inserirSala(raiz->esquerda, nome);		
-	}
-	else if(strcmp(nome, raiz->nome) > 0)
-	{
-		// Caso contrário, atribui o nó à direita.
-		raiz->direita = inserirSala(raiz->direita, nome);
-	}
-
-	return raiz;
-}
-
-int altura(const Sala* raiz)
-{
-	if (raiz == NULL)
-	{
-		return 0;
-	}
-
-	int alt_esq = altura(raiz->esquerda);
-	int alt_dir = altura(raiz->direita);
-	return 1 + (alt_esq > alt_dir ? alt_esq : alt_dir);
-}
-
-int profundidade(const Sala* raiz, const Sala* alvo, int nivel)
-{
-	if (raiz == NULL)
-	{
-		return -1;
-	}
-
-	if (raiz == alvo)
-	{
-		return nivel;
-	}
-
-	int esq = profundidade(raiz->esquerda, alvo, nivel + 1);
-
-	if (esq != -1)
-	{
-		return esq;
-	}
-
-	return profundidade(raiz->direita, alvo, nivel + 1);
-}
-
-void preOrdem(const Sala* raiz)
-{
-	if (raiz != NULL)
-	{
-		printf(" %s |", raiz->nome);
-		preOrdem(raiz->esquerda);
-		preOrdem(raiz->direita);
-	}
+	return motor;
 }
 
-void emOrdem(const Sala* raiz)
+const char* explorarSalas(DirecaoMotor direcao, MotorJogo* motor)
 {
-	if (raiz != NULL)
+	if (moverMotorJogo(motor, direcao) != StatusMotor_OK)
 	{
-		emOrdem(raiz->esquerda);
-		printf(" %s |", raiz->nome);
-		emOrdem(raiz->direita);
-	}
-}
-
-void posOrdem(const Sala* raiz)
-{
-	if (raiz != NULL)
-	{
-		posOrdem(raiz->esquerda);
-		posOrdem(raiz->direita);
-		printf(" %s |", raiz->nome);
+		return NULL;
 	}
-}
 
-void liberarSala(Sala* raiz)
-{
-	if (raiz != NULL)
-	{
-		liberarSala(raiz->esquerda);
-		liberarSala(raiz->direita);
-		free(raiz);
-	}
+	return SALAS_MANSAO[salaAtualMotorJogo(motor)].nome;
 }
 
-void liberarMemoria(Sala* raiz)
+void liberarMemoria(MotorJogo* motor)
 {
-	liberarSala(raiz);
+	liberarMotorJogo(motor);
 
 	printf("\n  ✅  Memória alocada para os nós liberada com sucesso.\n");
 }
@@ -421,8 +253,3 @@ void limparBufferEntrada()
 	int c;
 	while ((c = getchar()) != '\n' && c != EOF);
 }
-
-void limparEnter(char* str)
-{
-	str[strcspn(str, "\n")] = '\0';
-}
\ No newline at end of file
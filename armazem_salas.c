@@ -0,0 +1,354 @@
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/types.h>
+#endif
+
+#include "armazem_salas.h"
+
+// Desafio Detective Quest
+// Implementação do armazém de salas paginado.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem abre o armazém informa as falhas.
+
+// **** Funções do Armazém de Salas Paginado ****
+
+/// @brief Posiciona o arquivo em um deslocamento de 64 bits: arquivos de salas podem passar de 2 GB.
+static bool posicionarArquivoSalas(FILE* arquivo, int64_t posicao)
+{
+#ifdef _WIN32
+	return _fseeki64(arquivo, posicao, SEEK_SET) == 0;
+#else
+	return fseeko(arquivo, (off_t)posicao, SEEK_SET) == 0;
+#endif
+}
+
+bool gravarSalasPaginadas(const MansaoColunar* mansao, const char* caminho)
+{
+	if (mansao == NULL)
+	{
+		return false;
+	}
+
+	FILE* arquivo = fopen(caminho, "wb");
+	if (arquivo == NULL)
+	{
+		return false;
+	}
+
+	CabecalhoSalasPaginadas cabecalho = { 0 };
+	memcpy(cabecalho.magica, MAGICA_SALAS_PAGINADAS, sizeof(cabecalho.magica));
+	cabecalho.versao = VERSAO_SALAS_PAGINADAS;
+	cabecalho.tamanhoRegistro = sizeof(RegistroSalaPaginada);
+	cabecalho.totalSalas = mansao->totalSalas;
+	cabecalho.salasPorPagina = SALAS_POR_PAGINA;
+	bool sucesso = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1;
+
+	// Uma página por vez: a gravação não precisa de todos os registros em memória.
+	RegistroSalaPaginada pagina[SALAS_POR_PAGINA];
+	for (int32_t inicio = 0; sucesso && inicio < mansao->totalSalas; inicio += SALAS_POR_PAGINA)
+	{
+		int32_t total = mansao->totalSalas - inicio < SALAS_POR_PAGINA ? mansao->totalSalas - inicio : SALAS_POR_PAGINA;
+		memset(pagina, 0, sizeof(pagina));
+		for (int32_t i = 0; i < total; i++)
+		{
+			int32_t sala = inicio + i;
+			pagina[i].esquerda = mansao->esquerda[sala];
+			pagina[i].direita = mansao->direita[sala];
+			copiarTextoLimitado(pagina[i].nome, sizeof(pagina[i].nome), mansao->textos[mansao->nome[sala]]);
+			copiarTextoLimitado(pagina[i].pista, sizeof(pagina[i].pista),
+				mansao->pista[sala] != SEM_INDICE_COLUNAR ? mansao->textos[mansao->pista[sala]] : "");
+		}
+		sucesso = fwrite(pagina, sizeof(RegistroSalaPaginada), (size_t)total, arquivo) == (size_t)total;
+	}
+
+	return fclose(arquivo) == 0 && sucesso;
+}
+
+ArmazemSalas* abrirArmazemSalas(const char* caminho, int32_t capacidadePaginas)
+{
+	if (capacidadePaginas < 1)
+	{
+		return NULL;
+	}
+
+	FILE* arquivo = fopen(caminho, "rb");
+	CabecalhoSalasPaginadas cabecalho;
+	if (arquivo == NULL || fread(&cabecalho, sizeof(cabecalho), 1, arquivo) != 1 ||
+		memcmp(cabecalho.magica, MAGICA_SALAS_PAGINADAS, sizeof(cabecalho.magica)) != 0 ||
+		cabecalho.versao != VERSAO_SALAS_PAGINADAS || cabecalho.tamanhoRegistro != sizeof(RegistroSalaPaginada) ||
+		cabecalho.salasPorPagina != SALAS_POR_PAGINA || cabecalho.totalSalas < 1)
+	{
+		if (arquivo != NULL)
+		{
+			fclose(arquivo);
+		}
+		return NULL;
+	}
+
+	// O arquivo é lido em páginas inteiras: o buffer do FILE apenas duplicaria as cópias.
+	setvbuf(arquivo, NULL, _IONBF, 0);
+
+	int32_t totalPaginas = (cabecalho.totalSalas + SALAS_POR_PAGINA - 1) / SALAS_POR_PAGINA;
+	int32_t capacidade = capacidadePaginas < totalPaginas ? capacidadePaginas : totalPaginas;
+	uint32_t totalBaldes = 1;
+	while (totalBaldes < (uint32_t)capacidade * 2)
+	{
+		totalBaldes <<= 1;
+	}
+
+	ArmazemSalas* armazem = (ArmazemSalas*)calloc(1, sizeof(ArmazemSalas));
+	if (armazem == NULL)
+	{
+		fclose(arquivo);
+		return NULL;
+	}
+
+	armazem->arquivo = arquivo;
+	armazem->totalSalas = cabecalho.totalSalas;
+	armazem->totalPaginas = totalPaginas;
+	armazem->capacidade = capacidade;
+	armazem->mascaraBaldes = totalBaldes - 1;
+	armazem->maisRecente = -1;
+	armazem->menosRecente = -1;
+	armazem->paginas = (RegistroSalaPaginada**)calloc((size_t)capacidade, sizeof(RegistroSalaPaginada*));
+	armazem->paginaVaga = (int32_t*)malloc((size_t)capacidade * sizeof(int32_t));
+	armazem->anterior = (int32_t*)malloc((size_t)capacidade * sizeof(int32_t));
+	armazem->proxima = (int32_t*)malloc((size_t)capacidade * sizeof(int32_t));
+	armazem->proximaBalde = (int32_t*)malloc((size_t)capacidade * sizeof(int32_t));
+	armazem->baldes = (int32_t*)malloc((size_t)totalBaldes * sizeof(int32_t));
+	if (armazem->paginas == NULL || armazem->paginaVaga == NULL || armazem->anterior == NULL ||
+		armazem->proxima == NULL || armazem->proximaBalde == NULL || armazem->baldes == NULL)
+	{
+		fecharArmazemSalas(armazem);
+		return NULL;
+	}
+	memset(armazem->baldes, 0xFF, (size_t)totalBaldes * sizeof(int32_t)); // Todos os baldes vazios(-1).
+
+	return armazem;
+}
+
+/// @brief Calcula o balde da tabela hash de vagas de uma página.
+static inline uint32_t baldePaginaArmazem(const ArmazemSalas* armazem, int32_t pagina)
+{
+	return ((uint32_t)pagina * 2654435761u) & armazem->mascaraBaldes;
+}
+
+/// @brief Retira uma vaga da lista LRU.
+static void desligarVagaArmazem(ArmazemSalas* armazem, int32_t vaga)
+{
+	int32_t anterior = armazem->anterior[vaga];
+	int32_t proxima = armazem->proxima[vaga];
+	if (anterior >= 0)
+		armazem->proxima[anterior] = proxima;
+	else
+		armazem->maisRecente = proxima;
+	if (proxima >= 0)
+		armazem->anterior[proxima] = anterior;
+	else
+		armazem->menosRecente = anterior;
+}
+
+/// @brief Coloca uma vaga no início da lista LRU, como a usada mais recentemente.
+static void ligarVagaArmazem(ArmazemSalas* armazem, int32_t vaga)
+{
+	armazem->anterior[vaga] = -1;
+	armazem->proxima[vaga] = armazem->maisRecente;
+	if (armazem->maisRecente >= 0)
+		armazem->anterior[armazem->maisRecente] = vaga;
+	armazem->maisRecente = vaga;
+	if (armazem->menosRecente < 0)
+		armazem->menosRecente = vaga;
+}
+
+/// @brief Procura a vaga de uma página residente.
+/// @returns Inteiro. Índice da vaga, ou -1 se a página não estiver no cache.
+static int32_t buscarVagaArmazem(const ArmazemSalas* armazem, int32_t pagina)
+{
+	int32_t vaga = armazem->baldes[baldePaginaArmazem(armazem, pagina)];
+	while (vaga >= 0 && armazem->paginaVaga[vaga] != pagina)
+	{
+		vaga = armazem->proximaBalde[vaga];
+	}
+	return vaga;
+}
+
+/// @brief Retira uma vaga da tabela hash, antes de ela receber outra página.
+static void removerVagaBaldeArmazem(ArmazemSalas* armazem, int32_t vaga)
+{
+	if (armazem->paginaVaga[vaga] < 0)
+	{
+		return; // Vaga de uma leitura que falhou: não está na tabela.
+	}
+
+	int32_t* ligacao = &armazem->baldes[baldePaginaArmazem(armazem, armazem->paginaVaga[vaga])];
+	while (*ligacao != vaga)
+	{
+		ligacao = &armazem->proximaBalde[*ligacao];
+	}
+	*ligacao = armazem->proximaBalde[vaga];
+}
+
+/// @brief Pede ao sistema a leitura antecipada das páginas das filhas das salas de uma página. A leitura
+/// acontece em segundo plano e a próxima descida encontra as páginas no cache do sistema, sem ocupar
+/// vagas do cache do armazém com páginas que podem não ser visitadas.
+static void anteciparPaginasFilhas(ArmazemSalas* armazem, const RegistroSalaPaginada* salas, int32_t total)
+{
+	int32_t menor = INT32_MAX, maior = -1;
+	for (int32_t i = 0; i < total; i++)
+	{
+		int32_t filhas[2] = { salas[i].esquerda, salas[i].direita };
+		for (int j = 0; j < 2; j++)
+		{
+			if (filhas[j] >= 0 && filhas[j] < armazem->totalSalas)
+			{
+				menor = filhas[j] < menor ? filhas[j] : menor;
+				maior = filhas[j] > maior ? filhas[j] : maior;
+			}
+		}
+	}
+	if (maior < 0)
+	{
+		return;
+	}
+
+	// Em ordem de nível, as filhas de uma página ficam em poucas páginas seguidas.
+	int32_t primeira = menor / SALAS_POR_PAGINA;
+	int32_t ultima = maior / SALAS_POR_PAGINA;
+	if (ultima - primeira >= MAXIMO_PAGINAS_ANTECIPADAS)
+	{
+		ultima = primeira + MAXIMO_PAGINAS_ANTECIPADAS - 1;
+	}
+	for (int32_t pagina = primeira; pagina <= ultima; pagina++)
+	{
+		if (buscarVagaArmazem(armazem, pagina) >= 0)
+		{
+			continue;
+		}
+#ifndef _WIN32
+		posix_fadvise(fileno(armazem->arquivo), (off_t)posicaoPaginaSalas(pagina),
+			(off_t)(SALAS_POR_PAGINA * sizeof(RegistroSalaPaginada)), POSIX_FADV_WILLNEED);
+#endif
+		armazem->antecipadas++;
+	}
+}
+
+const RegistroSalaPaginada* obterSalaArmazem(ArmazemSalas* armazem, int32_t sala)
+{
+	if (armazem == NULL || sala < 0 || sala >= armazem->totalSalas)
+	{
+		return NULL;
+	}
+
+	int32_t pagina = sala / SALAS_POR_PAGINA;
+	int32_t vaga = buscarVagaArmazem(armazem, pagina);
+	if (vaga >= 0)
+	{
+		armazem->acertos++;
+		if (armazem->maisRecente != vaga)
+		{
+			desligarVagaArmazem(armazem, vaga);
+			ligarVagaArmazem(armazem, vaga);
+		}
+		return &armazem->paginas[vaga][sala % SALAS_POR_PAGINA];
+	}
+
+	// Falta: uma vaga nova, enquanto houver, ou a da página usada menos recentemente.
+	armazem->faltas++;
+	if (armazem->ocupadas < armazem->capacidade)
+	{
+		vaga = armazem->ocupadas;
+		armazem->paginas[vaga] = (RegistroSalaPaginada*)malloc(SALAS_POR_PAGINA * sizeof(RegistroSalaPaginada));
+		if (armazem->paginas[vaga] == NULL)
+		{
+			return NULL;
+		}
+		armazem->ocupadas++;
+	}
+	else
+	{
+		vaga = armazem->menosRecente;
+		desligarVagaArmazem(armazem, vaga);
+		removerVagaBaldeArmazem(armazem, vaga);
+		armazem->despejos++;
+	}
+
+	int32_t inicio = pagina * SALAS_POR_PAGINA;
+	int32_t total = armazem->totalSalas - inicio < SALAS_POR_PAGINA ? armazem->totalSalas - inicio : SALAS_POR_PAGINA;
+	if (!posicionarArquivoSalas(armazem->arquivo, posicaoPaginaSalas(pagina)) ||
+		fread(armazem->paginas[vaga], sizeof(RegistroSalaPaginada), (size_t)total, armazem->arquivo) != (size_t)total)
+	{
+		// A vaga volta ao fim da lista, sem página e fora da tabela: será a primeira a ser reutilizada.
+		armazem->paginaVaga[vaga] = -1;
+		armazem->proximaBalde[vaga] = -1;
+		armazem->anterior[vaga] = armazem->menosRecente;
+		armazem->proxima[vaga] = -1;
+		if (armazem->menosRecente >= 0)
+			armazem->proxima[armazem->menosRecente] = vaga;
+		else
+			armazem->maisRecente = vaga;
+		armazem->menosRecente = vaga;
+		return NULL;
+	}
+
+	uint32_t balde = baldePaginaArmazem(armazem, pagina);
+	armazem->paginaVaga[vaga] = pagina;
+	armazem->proximaBalde[vaga] = armazem->baldes[balde];
+	armazem->baldes[balde] = vaga;
+	ligarVagaArmazem(armazem, vaga);
+
+	anteciparPaginasFilhas(armazem, armazem->paginas[vaga], total);
+	return &armazem->paginas[vaga][sala % SALAS_POR_PAGINA];
+}
+
+int32_t explorarSalaArmazem(ArmazemSalas* armazem, int32_t atual, bool esquerda)
+{
+	const RegistroSalaPaginada* sala = obterSalaArmazem(armazem, atual);
+	if (sala == NULL)
+	{
+		return SEM_INDICE_COLUNAR;
+	}
+
+	int32_t destino = esquerda ? sala->esquerda : sala->direita;
+
+	// Como em explorarSalasComPistas: uma saída inexistente leva de volta à primeira sala.
+	return destino != SEM_INDICE_COLUNAR ? destino : 0;
+}
+
+size_t memoriaResidenteArmazem(const ArmazemSalas* armazem)
+{
+	if (armazem == NULL)
+	{
+		return 0;
+	}
+
+	return sizeof(ArmazemSalas) +
+		(size_t)armazem->capacidade * (sizeof(RegistroSalaPaginada*) + 4 * sizeof(int32_t)) +
+		((size_t)armazem->mascaraBaldes + 1) * sizeof(int32_t) +
+		(size_t)armazem->ocupadas * SALAS_POR_PAGINA * sizeof(RegistroSalaPaginada);
+}
+
+void fecharArmazemSalas(ArmazemSalas* armazem)
+{
+	if (armazem == NULL)
+		return;
+
+	if (armazem->paginas != NULL)
+	{
+		for (int32_t i = 0; i < armazem->ocupadas; i++)
+		{
+			free(armazem->paginas[i]);
+		}
+	}
+	free(armazem->paginas);
+	free(armazem->paginaVaga);
+	free(armazem->anterior);
+	free(armazem->proxima);
+	free(armazem->proximaBalde);
+	free(armazem->baldes);
+	if (armazem->arquivo != NULL)
+	{
+		fclose(armazem->arquivo);
+	}
+	free(armazem);
+}
@@ -0,0 +1,117 @@
+#ifndef ARMAZEM_SALAS_H
+#define ARMAZEM_SALAS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mansao_colunar.h"
+
+// Desafio Detective Quest
+// Armazém de salas paginado, para mansões maiores que a memória: as salas ficam em um arquivo de registros
+// de tamanho fixo e são lidas sob demanda, em páginas, por um cache LRU de capacidade fixa.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a assinatura do cabeçalho do arquivo de salas paginado.
+#define MAGICA_SALAS_PAGINADAS "DQSALAS"
+/// @brief Define a versão do formato do arquivo de salas paginado.
+#define VERSAO_SALAS_PAGINADAS 1
+/// @brief Define a quantidade de salas de cada página do arquivo de salas(32 salas, cerca de 4 KB).
+#define SALAS_POR_PAGINA 32
+/// @brief Define a capacidade padrão, em páginas, do cache do armazém de salas paginado.
+#define CAPACIDADE_PADRAO_PAGINAS 256
+/// @brief Define a quantidade máxima de páginas das salas filhas antecipadas a cada página lida.
+#define MAXIMO_PAGINAS_ANTECIPADAS 4
+
+// **** Definições de estruturas. ****
+
+/// @brief Define o cabeçalho do arquivo de salas paginado.
+typedef struct
+{
+	char magica[8];
+	uint32_t versao;
+	uint32_t tamanhoRegistro;
+	int32_t totalSalas;
+	int32_t salasPorPagina;
+} CabecalhoSalasPaginadas;
+
+/// @brief Define o registro de tamanho fixo de uma sala no arquivo paginado. As salas ficam em ordem
+/// de nível, então as filhas das salas de uma página ficam nas páginas seguintes, próximas entre si.
+typedef struct
+{
+	int32_t esquerda; // Índice da sala à esquerda, ou SEM_INDICE_COLUNAR.
+	int32_t direita; // Índice da sala à direita, ou SEM_INDICE_COLUNAR.
+	char nome[TAMANHO_MAX_NOME];
+	char pista[TAMANHO_MAX_PISTA]; // Vazio quando a sala não tem pista.
+} RegistroSalaPaginada;
+
+/// @brief Define um armazém de salas lidas do disco sob demanda, em páginas de SALAS_POR_PAGINA salas.
+/// As páginas residentes ficam em um cache LRU de capacidade fixa: uma tabela hash de vagas, encadeada
+/// por índices, e uma lista duplamente encadeada da mais recente à menos recente.
+/// Os buffers das vagas são alocados no primeiro uso: a memória acompanha a região explorada.
+typedef struct
+{
+	FILE* arquivo;
+	int32_t totalSalas;
+	int32_t totalPaginas;
+	int32_t capacidade; // Vagas do cache, em páginas.
+	int32_t ocupadas;
+	RegistroSalaPaginada** paginas; // Buffer de cada vaga, ou NULL se ainda não usado.
+	int32_t* paginaVaga; // Página guardada em cada vaga.
+	int32_t* anterior; // Vaga usada mais recentemente que esta, ou -1.
+	int32_t* proxima; // Vaga usada menos recentemente que esta, ou -1.
+	int32_t* proximaBalde; // Próxima vaga do mesmo balde da tabela hash, ou -1.
+	int32_t* baldes;
+	uint32_t mascaraBaldes;
+	int32_t maisRecente;
+	int32_t menosRecente;
+	unsigned long long acertos;
+	unsigned long long faltas;
+	unsigned long long despejos;
+	unsigned long long antecipadas;
+} ArmazemSalas;
+
+// **** Funções do Armazém de Salas Paginado ****
+
+/// @brief Calcula o deslocamento, no arquivo, da primeira sala de uma página.
+/// @param Inteiro. Índice da página.
+/// @returns Inteiro. Deslocamento em bytes, a partir do início do arquivo.
+static inline int64_t posicaoPaginaSalas(int32_t pagina)
+{
+	return (int64_t)sizeof(CabecalhoSalasPaginadas) + (int64_t)pagina * SALAS_POR_PAGINA * (int64_t)sizeof(RegistroSalaPaginada);
+}
+/// @brief Grava uma mansão colunar em um arquivo de salas paginado, com registros de tamanho fixo.
+/// @param MansaoColunar. Ponteiro usado na gravação. Somente leitura.
+/// @param Texto. Caminho do arquivo.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool gravarSalasPaginadas(const MansaoColunar* mansao, const char* caminho);
+/// @brief Abre um arquivo de salas paginado, lendo apenas o cabeçalho: o tempo de abertura não depende
+/// da quantidade de salas, e nenhuma página fica residente.
+/// @param Texto. Caminho do arquivo.
+/// @param Inteiro. Capacidade do cache, em páginas.
+/// @returns ArmazemSalas. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+ArmazemSalas* abrirArmazemSalas(const char* caminho, int32_t capacidadePaginas);
+/// @brief Recupera uma sala do armazém, lendo a sua página do disco se ela não estiver no cache.
+/// Uma página lida despeja a menos recente, quando o cache está cheio, e antecipa as páginas das filhas.
+/// @param ArmazemSalas. Ponteiro via referência, usado na leitura e no cache.
+/// @param Inteiro. Índice da sala.
+/// @returns RegistroSalaPaginada. Ponteiro válido até a próxima chamada, ou NULL em caso de falha.
+const RegistroSalaPaginada* obterSalaArmazem(ArmazemSalas* armazem, int32_t sala);
+/// @brief Explora as salas do armazém, como explorarSalasComPistas: ao seguir uma saída inexistente,
+/// a navegação volta à primeira sala.
+/// @param ArmazemSalas. Ponteiro via referência, usado na leitura e no cache.
+/// @param Inteiro. Índice da sala atual.
+/// @param Bool. Verdadeiro(true) para seguir pela esquerda. Caso contrário, falso(false), pela direita.
+/// @returns Inteiro. Índice da sala de destino, ou SEM_INDICE_COLUNAR em caso de falha.
+int32_t explorarSalaArmazem(ArmazemSalas* armazem, int32_t atual, bool esquerda);
+/// @brief Recupera a memória ocupada pelo armazém: a estrutura, as tabelas do cache e as páginas alocadas.
+/// @param ArmazemSalas. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Quantidade de bytes.
+size_t memoriaResidenteArmazem(const ArmazemSalas* armazem);
+/// @brief Fecha o arquivo e libera a memória do armazém de salas.
+/// @param ArmazemSalas. Ponteiro via referência, usado na operação de liberação.
+void fecharArmazemSalas(ArmazemSalas* armazem);
+
+#endif
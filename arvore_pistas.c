@@ -0,0 +1,428 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "arvore_pistas.h"
+
+// Desafio Detective Quest
+// Implementação da árvore de pistas persistente, com as consultas por posição e por intervalo.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: as falhas de alocação deixam a árvore como estava.
+
+// **** Funções da Árvore de Pistas ****
+
+/// @brief Quantidade de nós de pista alocados, somando todas as versões das árvores.
+static atomic_size_t nosPistaVivos;
+
+/// @brief Limita uma pista a TAMANHO_MAX_PISTA - 1 bytes. Uma pista que já cabe é devolvida como está,
+/// sem cópia; as demais são truncadas no buffer.
+static const char* limitarPista(const char* pista, char* buffer)
+{
+	if (strnlen(pista, TAMANHO_MAX_PISTA) < TAMANHO_MAX_PISTA)
+	{
+		return pista;
+	}
+
+	copiarTextoLimitado(buffer, TAMANHO_MAX_PISTA, pista);
+	return buffer;
+}
+
+Pista* criarPista(HeapTextos* textos, const char* pista)
+{
+	Pista* novo = (Pista*)malloc(sizeof(Pista));
+	if (novo == NULL)
+	{
+		return NULL;
+	}
+
+	// O texto é internado: pistas iguais compartilham a cópia, e as de um arquivo mapeado não são copiadas.
+	char buffer[TAMANHO_MAX_PISTA];
+	novo->pista = internarTexto(textos, limitarPista(pista, buffer));
+	novo->chave = novo->pista != NULL ? internarChaveColacao(textos, novo->pista) : NULL;
+	if (novo->chave == NULL)
+	{
+		free(novo);
+		return NULL;
+	}
+	novo->tamanho = 1;
+	novo->altura = 1;
+	novo->referencias = 1;
+	novo->esquerda = NULL;
+	novo->direita = NULL;
+	atomic_fetch_add_explicit(&nosPistaVivos, 1, memory_order_relaxed);
+
+	return novo;
+}
+
+/// @brief Recupera a altura de uma subárvore de pistas, considerando NULL como zero.
+static int alturaPista(const Pista* raiz)
+{
+	return raiz == NULL ? 0 : raiz->altura;
+}
+
+/// @brief Prepara um nó do caminho da inserção para ser alterado. Sem outras referências, é o próprio nó;
+/// senão, é uma cópia, que passa a referenciar os mesmos filhos, e o original perde a referência do caminho.
+/// @returns Pista. O nó a alterar, ou NULL se a cópia não pôde ser alocada.
+static Pista* escreverPista(Pista* no)
+{
+	if (no->referencias == 1)
+	{
+		return no;
+	}
+
+	Pista* copia = (Pista*)malloc(sizeof(Pista));
+	if (copia == NULL)
+	{
+		return NULL;
+	}
+	*copia = *no;
+	copia->referencias = 1;
+	if (copia->esquerda != NULL)
+	{
+		copia->esquerda->referencias++;
+	}
+	if (copia->direita != NULL)
+	{
+		copia->direita->referencias++;
+	}
+	no->referencias--;
+	atomic_fetch_add_explicit(&nosPistaVivos, 1, memory_order_relaxed);
+
+	return copia;
+}
+
+/// @brief Recalcula a altura e o tamanho de um nó a partir dos filhos.
+static void atualizarPista(Pista* raiz)
+{
+	int altEsq = alturaPista(raiz->esquerda);
+	int altDir = alturaPista(raiz->direita);
+	raiz->altura = 1 + (altEsq > altDir ? altEsq : altDir);
+	raiz->tamanho = 1 + tamanhoPista(raiz->esquerda) + tamanhoPista(raiz->direita);
+}
+
+/// @brief Efetua uma rotação à direita, promovendo o filho esquerdo.
+static Pista* rotacionarPistaDireita(Pista* raiz)
+{
+	Pista* nova = escreverPista(raiz->esquerda);
+	if (nova == NULL)
+	{
+		atualizarPista(raiz);
+		return raiz; // Sem memória para a cópia: a versão fica apenas menos balanceada.
+	}
+	raiz->esquerda = nova->direita;
+	nova->direita = raiz;
+	atualizarPista(raiz);
+	atualizarPista(nova);
+	return nova;
+}
+
+/// @brief Efetua uma rotação à esquerda, promovendo o filho direito.
+static Pista* rotacionarPistaEsquerda(Pista* raiz)
+{
+	Pista* nova = escreverPista(raiz->direita);
+	if (nova == NULL)
+	{
+		atualizarPista(raiz);
+		return raiz; // Sem memória para a cópia: a versão fica apenas menos balanceada.
+	}
+	raiz->direita = nova->esquerda;
+	nova->esquerda = raiz;
+	atualizarPista(raiz);
+	atualizarPista(nova);
+	return nova;
+}
+
+/// @brief Atualiza o nó e, se a diferença de altura entre os filhos passar de um, rebalanceia(AVL).
+static Pista* balancearPista(Pista* raiz)
+{
+	atualizarPista(raiz);
+	int fator = alturaPista(raiz->esquerda) - alturaPista(raiz->direita);
+
+	if (fator > 1)
+	{
+		if (alturaPista(raiz->esquerda->esquerda) < alturaPista(raiz->esquerda->direita))
+		{
+			raiz->esquerda = rotacionarPistaEsquerda(raiz->esquerda);
+		}
+		return rotacionarPistaDireita(raiz);
+	}
+	if (fator < -1)
+	{
+		if (alturaPista(raiz->direita->direita) < alturaPista(raiz->direita->esquerda))
+		{
+			raiz->direita = rotacionarPistaDireita(raiz->direita);
+		}
+		return rotacionarPistaEsquerda(raiz);
+	}
+
+	return raiz;
+}
+
+/// @brief Efetua a inserção recursiva de uma pista, comparando pela chave de colação já calculada.
+static Pista* inserirPistaChave(HeapTextos* textos, Pista* raiz, const char* pista, const ChaveColacao* chave)
+{
+	// Se o nó atual ainda não existe(portanto, não possui nós filhos), então será criado.
+	if (raiz == NULL)
+	{
+		return criarPista(textos, pista);
+	}
+	// Verificamos se o nome correspondente é um valor menor que o atual atual.
+	// Feito isso, atribui o nó de menor valor à esquerda.
+	int comparacao = compararChavesColacao(chave, raiz->chave);
+	if (comparacao == 0)
+	{
+		return raiz; // Pista já registrada.
+	}
+
+	// O nó do caminho muda: se outra versão também o referencia, a alteração vai para uma cópia.
+	Pista* alterado = escreverPista(raiz);
+	if (alterado == NULL)
+	{
+		return raiz; // Sem memória para a cópia: a pista não é inserida nesta versão.
+	}
+	raiz = alterado;
+
+	if (comparacao < 0)
+	{
+		raiz->esquerda = inserirPistaChave(textos, raiz->esquerda, pista, chave);
+	}
+	else
+	{
+		// Caso contrário, se o valor é maior, atribui o nó à direita.
+		raiz->direita = inserirPistaChave(textos, raiz->direita, pista, chave);
+	}
+
+	// Na volta da recursão, os tamanhos são atualizados e o caminho é rebalanceado.
+	return balancearPista(raiz);
+}
+
+Pista* inserirPista(HeapTextos* textos, Pista* raiz, const char* pista)
+{
+	// A pista é guardada truncada no nó: a chave é a do texto guardado, calculada uma única vez.
+	char buffer[TAMANHO_MAX_PISTA];
+	const char* texto = limitarPista(pista, buffer);
+
+	const ChaveColacao* chave = internarChaveColacao(textos, texto);
+	if (chave == NULL)
+	{
+		return raiz;
+	}
+
+	return inserirPistaChave(textos, raiz, texto, chave);
+}
+
+Pista* reterPista(Pista* raiz)
+{
+	if (raiz != NULL)
+	{
+		raiz->referencias++;
+	}
+
+	return raiz;
+}
+
+Pista* copiarPistaCompleta(const Pista* raiz)
+{
+	if (raiz == NULL)
+	{
+		return NULL;
+	}
+
+	Pista* copia = (Pista*)malloc(sizeof(Pista));
+	if (copia == NULL)
+	{
+		return NULL;
+	}
+	*copia = *raiz;
+	copia->referencias = 1;
+	copia->esquerda = copiarPistaCompleta(raiz->esquerda);
+	copia->direita = copiarPistaCompleta(raiz->direita);
+	atomic_fetch_add_explicit(&nosPistaVivos, 1, memory_order_relaxed);
+
+	return copia;
+}
+
+const Pista* buscarPista(const Pista* raiz, const char* pista)
+{
+	if (raiz == NULL)
+	{
+		return NULL;
+	}
+
+	ChaveColacao consulta;
+	unsigned char buffer[TAMANHO_MAX_CHAVE_COLACAO];
+	const ChaveColacao* chave = prepararChaveConsulta(pista, &consulta, buffer);
+	if (chave == NULL)
+	{
+		return NULL;
+	}
+
+	// A chave da consulta é montada uma única vez; cada nível compara apenas chaves.
+	while (raiz != NULL)
+	{
+		int comparacao = compararChavesColacao(chave, raiz->chave);
+		if (comparacao == 0)
+		{
+			return raiz;
+		}
+		raiz = comparacao < 0 ? raiz->esquerda : raiz->direita;
+	}
+
+	return NULL;
+}
+
+int tamanhoPista(const Pista* raiz)
+{
+	return raiz == NULL ? 0 : raiz->tamanho;
+}
+
+int posicaoPista(const Pista* raiz, const char* pista)
+{
+	int posicao = 0;
+	ChaveColacao consulta;
+	unsigned char buffer[TAMANHO_MAX_CHAVE_COLACAO];
+	const ChaveColacao* chave = prepararChaveConsulta(pista, &consulta, buffer);
+	if (chave == NULL)
+	{
+		return 0;
+	}
+
+	while (raiz != NULL)
+	{
+		int comparacao = compararChavesColacao(chave, raiz->chave);
+		if (comparacao <= 0)
+		{
+			if (comparacao == 0)
+			{
+				return posicao + tamanhoPista(raiz->esquerda);
+			}
+			raiz = raiz->esquerda;
+		}
+		else
+		{
+			// Todas as pistas da esquerda e a própria raiz são menores.
+			posicao += tamanhoPista(raiz->esquerda) + 1;
+			raiz = raiz->direita;
+		}
+	}
+
+	return posicao;
+}
+
+const Pista* selecionarPista(const Pista* raiz, int posicao)
+{
+	if (posicao < 0 || posicao >= tamanhoPista(raiz))
+	{
+		return NULL;
+	}
+
+	while (raiz != NULL)
+	{
+		int tamanhoEsquerda = tamanhoPista(raiz->esquerda);
+		if (posicao < tamanhoEsquerda)
+		{
+			raiz = raiz->esquerda;
+		}
+		else if (posicao == tamanhoEsquerda)
+		{
+			return raiz;
+		}
+		else
+		{
+			posicao -= tamanhoEsquerda + 1;
+			raiz = raiz->direita;
+		}
+	}
+
+	return NULL;
+}
+
+/// @brief Percorre em ordem apenas as subárvores que intersectam o intervalo de posições [inicio, fim).
+/// @param Inteiro. Posição do primeiro nó da subárvore na árvore inteira.
+static void coletarPistasPorPosicao(const Pista* raiz, int deslocamento, int inicio, int fim,
+	const Pista** destino, int* total)
+{
+	if (raiz == NULL || deslocamento >= fim || deslocamento + raiz->tamanho <= inicio)
+	{
+		return; // Subárvore fora do intervalo.
+	}
+
+	int posicaoRaiz = deslocamento + tamanhoPista(raiz->esquerda);
+
+	coletarPistasPorPosicao(raiz->esquerda, deslocamento, inicio, fim, destino, total);
+	if (posicaoRaiz >= inicio && posicaoRaiz < fim)
+	{
+		destino[(*total)++] = raiz;
+	}
+	coletarPistasPorPosicao(raiz->direita, posicaoRaiz + 1, inicio, fim, destino, total);
+}
+
+int listarPistasPorPosicao(const Pista* raiz, int inicio, int quantidade, const Pista** destino)
+{
+	if (inicio < 0 || quantidade <= 0)
+	{
+		return 0;
+	}
+
+	int total = 0;
+	coletarPistasPorPosicao(raiz, 0, inicio, inicio + quantidade, destino, &total);
+	return total;
+}
+
+/// @brief Percorre em ordem apenas as subárvores que podem conter pistas do intervalo [de, ate).
+static void coletarPistasPorIntervalo(const Pista* raiz, const ChaveColacao* de, const ChaveColacao* ate,
+	const Pista** destino, int maximo, int* total)
+{
+	if (raiz == NULL || *total >= maximo)
+	{
+		return;
+	}
+
+	bool acimaDoInicio = de == NULL || compararChavesColacao(raiz->chave, de) >= 0;
+	bool abaixoDoFim = ate == NULL || compararChavesColacao(raiz->chave, ate) < 0;
+
+	if (acimaDoInicio)
+	{
+		coletarPistasPorIntervalo(raiz->esquerda, de, ate, destino, maximo, total);
+	}
+	if (acimaDoInicio && abaixoDoFim && *total < maximo)
+	{
+		destino[(*total)++] = raiz;
+	}
+	if (abaixoDoFim)
+	{
+		coletarPistasPorIntervalo(raiz->direita, de, ate, destino, maximo, total);
+	}
+}
+
+int listarPistasPorIntervalo(const Pista* raiz, const char* de, const char* ate, const Pista** destino, int maximo)
+{
+	ChaveColacao consultaDe, consultaAte;
+	unsigned char bufferDe[TAMANHO_MAX_CHAVE_COLACAO], bufferAte[TAMANHO_MAX_CHAVE_COLACAO];
+	const ChaveColacao* chaveDe = de != NULL ? prepararChaveConsulta(de, &consultaDe, bufferDe) : NULL;
+	const ChaveColacao* chaveAte = ate != NULL ? prepararChaveConsulta(ate, &consultaAte, bufferAte) : NULL;
+	if ((de != NULL && chaveDe == NULL) || (ate != NULL && chaveAte == NULL))
+	{
+		return 0;
+	}
+
+	int total = 0;
+	coletarPistasPorIntervalo(raiz, chaveDe, chaveAte, destino, maximo, &total);
+	return total;
+}
+
+size_t nosPistaAlocados()
+{
+	return atomic_load_explicit(&nosPistaVivos, memory_order_relaxed);
+}
+
+void liberarPista(Pista* raiz)
+{
+	// Apenas os nós sem outras referências são liberados: as subárvores compartilhadas ficam com as demais versões.
+	if (raiz != NULL && --raiz->referencias == 0)
+	{
+		liberarPista(raiz->esquerda);
+		liberarPista(raiz->direita);
+		free(raiz);
+		atomic_fetch_sub_explicit(&nosPistaVivos, 1, memory_order_relaxed);
+	}
+}
@@ -0,0 +1,107 @@
+#ifndef ARVORE_PISTAS_H
+#define ARVORE_PISTAS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "textos_compactos.h"
+
+// Desafio Detective Quest
+// Árvore de pistas: AVL em ordem de colação pt-BR, com o tamanho de cada subárvore para as consultas
+// por posição(rank/select) e persistente(cópia do caminho), para guardar versões em tempo constante.
+// Os textos e as chaves ficam no heap de textos de quem usa a árvore.
+
+// **** Definições de estruturas. ****
+
+/// @brief Define a struct para representar a pista. Contém um campo com um texto descritivo.
+/// A árvore é mantida balanceada(AVL) e cada nó guarda o tamanho da sua subárvore,
+/// permitindo consultas por posição(rank/select) em tempo logarítmico.
+/// A ordem é a de colação pt-BR, comparada pela chave pré-calculada.
+/// A árvore é persistente(cópia do caminho): versões diferentes compartilham as subárvores não alteradas,
+/// e cada nó conta as referências que recebe, dos pais e das raízes guardadas.
+struct Pista
+{
+	const char* pista; // Texto internado(ou no arquivo mapeado), com até TAMANHO_MAX_PISTA - 1 bytes.
+	const ChaveColacao* chave; // Chave de colação internada, compartilhada por pistas iguais.
+	int tamanho; // Quantidade de nós na subárvore, incluindo o próprio nó.
+	int altura; // Altura da subárvore, usada no balanceamento.
+	uint32_t referencias; // Pais e raízes que apontam para o nó. Com mais de uma, o nó é copiado antes de mudar.
+	struct Pista* esquerda;
+	struct Pista* direita;
+};
+
+/// @brief Define uma struct com um alias Pista, para uso em uma estratégia BST.
+typedef struct Pista Pista;
+
+// **** Funções da Árvore de Pistas ****
+
+/// @brief Cria um ponteiro para um nó, tipo Pista.
+/// Baseado no conteúdo da plataforma.
+/// @param HeapTextos. Ponteiro via referência do heap do texto e da chave da pista.
+/// @param Texto. Valor descrevendo a pista.
+/// @returns Pista. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+Pista* criarPista(HeapTextos* textos, const char* pista);
+/// @brief Efetua uma inserção na árvore para BST, tipo Pista. A árvore é persistente: os nós do caminho
+/// que outras versões também referenciam são copiados, e as versões guardadas não mudam.
+/// A referência recebida passa para a raiz devolvida. Sem memória, a pista não é inserida
+/// (a quantidade de pistas não muda). Baseado no conteúdo da plataforma.
+/// @param HeapTextos. Ponteiro via referência do heap dos textos e das chaves da árvore.
+/// @param Pista. Ponteiro via referência, usado na inserção.
+/// @param Texto. Valor descrevendo a pista.
+/// @returns Pista. Ponteiro do tipo conforme especificado.
+Pista* inserirPista(HeapTextos* textos, Pista* raiz, const char* pista);
+/// @brief Guarda a versão atual de uma árvore de pistas(instantâneo), em tempo constante: a raiz ganha
+/// uma referência, que deve ser devolvida com liberarPista.
+/// @param Pista. Ponteiro raiz, via referência, da versão a guardar.
+/// @returns Pista. A mesma raiz, agora com uma referência a mais.
+Pista* reterPista(Pista* raiz);
+/// @brief Copia todos os nós de uma árvore de pistas, sem compartilhamento com a original.
+/// @param Pista. Ponteiro raiz, usado na cópia. Somente leitura.
+/// @returns Pista. Ponteiro da raiz da cópia, ou NULL se a árvore for vazia ou em caso de falha.
+Pista* copiarPistaCompleta(const Pista* raiz);
+/// @brief Efetua a busca de nós, relativos a pistas, em uma estratégia BST.
+/// Baseado no conteúdo da plataforma.
+/// @param Pista. Ponteiro via referência da árvore, usada na busca.
+/// @param Texto. Ponteiro para o valor de texto da pista a procurar.
+/// @returns Pista. Ponteiro do tipo conforme especificado.
+const Pista* buscarPista(const Pista* raiz, const char* pista);
+/// @brief Recupera a quantidade de pistas de uma árvore, em tempo constante.
+/// @param Pista. Ponteiro raiz, usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Quantidade de pistas da árvore.
+int tamanhoPista(const Pista* raiz);
+/// @brief Recupera a posição(rank) de uma pista na ordem alfabética: quantas pistas são menores que ela.
+/// @param Pista. Ponteiro raiz, usado na recuperação de informações. Somente leitura.
+/// @param Texto. Ponteiro para o valor de texto da pista.
+/// @returns Inteiro. Posição, começando em zero. Vale mesmo se a pista não estiver na árvore.
+int posicaoPista(const Pista* raiz, const char* pista);
+/// @brief Recupera a pista de uma posição(select) na ordem alfabética.
+/// @param Pista. Ponteiro raiz, usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Posição desejada, começando em zero.
+/// @returns Pista. Ponteiro do tipo conforme especificado, ou NULL se a posição for inválida.
+const Pista* selecionarPista(const Pista* raiz, int posicao);
+/// @brief Lista, em ordem, as pistas a partir de uma posição, sem percorrer a árvore inteira.
+/// @param Pista. Ponteiro raiz, usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Posição inicial, começando em zero.
+/// @param Inteiro. Quantidade máxima de pistas.
+/// @param Vetor. Ponteiro para receber as pistas encontradas.
+/// @returns Inteiro. Quantidade de pistas atribuídas ao vetor.
+int listarPistasPorPosicao(const Pista* raiz, int inicio, int quantidade, const Pista** destino);
+/// @brief Lista, em ordem, as pistas no intervalo alfabético [de, ate).
+/// @param Pista. Ponteiro raiz, usado na recuperação de informações. Somente leitura.
+/// @param Texto. Limite inferior, inclusivo. NULL para sem limite.
+/// @param Texto. Limite superior, exclusivo. NULL para sem limite.
+/// @param Vetor. Ponteiro para receber as pistas encontradas.
+/// @param Inteiro. Capacidade do vetor.
+/// @returns Inteiro. Quantidade de pistas atribuídas ao vetor.
+int listarPistasPorIntervalo(const Pista* raiz, const char* de, const char* ate, const Pista** destino, int maximo);
+/// @brief Recupera a quantidade de nós de pista alocados no processo, somando todas as versões de todas as árvores.
+/// @returns Inteiro. Quantidade de nós.
+size_t nosPistaAlocados();
+/// @brief Devolve uma referência à raiz de uma árvore de pistas. Os nós que ficam sem referências são
+/// liberados, usando chamadas recursivas; os compartilhados com outras versões permanecem.
+/// Baseado no conteúdo da plataforma.
+/// @param Pista. Ponteiro raiz, via referência, usado na operação de liberação.
+void liberarPista(Pista* raiz);
+
+#endif
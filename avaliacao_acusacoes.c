@@ -0,0 +1,345 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+#include "avaliacao_acusacoes.h"
+
+// Desafio Detective Quest
+// Implementação da avaliação paralela das acusações.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem avalia as acusações informa as falhas.
+
+// **** Funções da Avaliação Paralela das Acusações ****
+
+/// @brief Define a divisão da mansão para a avaliação das acusações: as salas de cima, em ordem de nível,
+/// com a posição da sala de origem de cada uma. As do último nível são as raízes das subárvores(tarefas).
+typedef struct
+{
+	const CasoGerado* caso;
+	TabelaAcusacoes* tabela;
+	int32_t* divisaoSala;
+	int32_t* divisaoOrigem; // Posição, na divisão, da sala de origem; -1 na entrada.
+	int32_t totalDivisao;
+	int32_t capacidadeDivisao;
+	int32_t primeiraSubarvore; // Posição, na divisão, da raiz da primeira subárvore.
+	atomic_int proximaTarefa;
+} AvaliacaoAcusacoes;
+
+/// @brief Define o estado de uma thread da avaliação: as pistas do bloco de suspeitos no caminho atual.
+/// Uma pista repetida no caminho conta uma vez, como na coleta do jogo.
+typedef struct
+{
+	AvaliacaoAcusacoes* avaliacao;
+	int32_t contagem[64]; // Pistas distintas de cada suspeito do bloco no caminho atual.
+	uint64_t acusaveis; // Suspeitos do bloco com as pistas requeridas no caminho atual.
+	uint32_t* vistas; // Por pista distinta: vezes em que aparece no caminho atual.
+	int32_t* pilha; // Salas da busca em profundidade; o complemento(~sala) marca a saída da sala.
+	size_t capacidadePilha;
+	bool sucesso;
+} TrabalhoAcusacoes;
+
+/// @brief Acrescenta ao caminho atual a pista da sala, para os suspeitos do bloco.
+static void entrarSalaAcusacoes(TrabalhoAcusacoes* trabalho, int32_t sala, int32_t bloco)
+{
+	const CasoGerado* caso = trabalho->avaliacao->caso;
+	int32_t texto = caso->mansao->pista[sala];
+	if (texto == SEM_INDICE_COLUNAR)
+	{
+		return;
+	}
+
+	int32_t pista = texto - caso->primeiraPista;
+	if (trabalho->vistas[pista]++ != 0)
+	{
+		return; // Pista repetida no caminho.
+	}
+
+	int32_t suspeito = caso->suspeitoPista[pista] - bloco * 64;
+	if (suspeito >= 0 && suspeito < 64 && ++trabalho->contagem[suspeito] == trabalho->avaliacao->tabela->pistasRequeridas)
+	{
+		trabalho->acusaveis |= 1ULL << suspeito;
+	}
+}
+
+/// @brief Retira do caminho atual a pista da sala, desfazendo entrarSalaAcusacoes.
+static void sairSalaAcusacoes(TrabalhoAcusacoes* trabalho, int32_t sala, int32_t bloco)
+{
+	const CasoGerado* caso = trabalho->avaliacao->caso;
+	int32_t texto = caso->mansao->pista[sala];
+	if (texto == SEM_INDICE_COLUNAR)
+	{
+		return;
+	}
+
+	int32_t pista = texto - caso->primeiraPista;
+	if (--trabalho->vistas[pista] != 0)
+	{
+		return;
+	}
+
+	int32_t suspeito = caso->suspeitoPista[pista] - bloco * 64;
+	if (suspeito >= 0 && suspeito < 64 && trabalho->contagem[suspeito]-- == trabalho->avaliacao->tabela->pistasRequeridas)
+	{
+		trabalho->acusaveis &= ~(1ULL << suspeito);
+	}
+}
+
+/// @brief Acrescenta(ou retira) as pistas das salas de origem de uma posição da divisão, até a entrada.
+static void percorrerOrigensAcusacoes(TrabalhoAcusacoes* trabalho, int32_t posicao, int32_t bloco, bool entrar)
+{
+	const AvaliacaoAcusacoes* avaliacao = trabalho->avaliacao;
+	for (int32_t p = avaliacao->divisaoOrigem[posicao]; p >= 0; p = avaliacao->divisaoOrigem[p])
+	{
+		if (entrar)
+		{
+			entrarSalaAcusacoes(trabalho, avaliacao->divisaoSala[p], bloco);
+		}
+		else
+		{
+			sairSalaAcusacoes(trabalho, avaliacao->divisaoSala[p], bloco);
+		}
+	}
+}
+
+/// @brief Avalia uma tarefa: a subárvore de uma raiz da divisão, para um bloco de 64 suspeitos.
+/// A busca em profundidade usa uma pilha própria, pois uma mansão degenerada estouraria a pilha de chamadas.
+static void executarTarefaAcusacoes(TrabalhoAcusacoes* trabalho, int32_t tarefa)
+{
+	AvaliacaoAcusacoes* avaliacao = trabalho->avaliacao;
+	TabelaAcusacoes* tabela = avaliacao->tabela;
+	const MansaoColunar* mansao = avaliacao->caso->mansao;
+	int32_t bloco = tarefa % tabela->palavras;
+	int32_t posicao = avaliacao->primeiraSubarvore + tarefa / tabela->palavras;
+
+	percorrerOrigensAcusacoes(trabalho, posicao, bloco, true);
+
+	size_t topo = 0;
+	trabalho->pilha[topo++] = avaliacao->divisaoSala[posicao];
+	while (topo > 0)
+	{
+		int32_t sala = trabalho->pilha[--topo];
+		if (sala < 0)
+		{
+			sairSalaAcusacoes(trabalho, ~sala, bloco);
+			continue;
+		}
+
+		entrarSalaAcusacoes(trabalho, sala, bloco);
+		tabela->acusaveis[(size_t)sala * tabela->palavras + bloco] = trabalho->acusaveis;
+
+		if (topo + 3 > trabalho->capacidadePilha)
+		{
+			int32_t* pilha = (int32_t*)realloc(trabalho->pilha, 2 * trabalho->capacidadePilha * sizeof(int32_t));
+			if (pilha == NULL)
+			{
+				trabalho->sucesso = false;
+				return;
+			}
+			trabalho->pilha = pilha;
+			trabalho->capacidadePilha *= 2;
+		}
+		trabalho->pilha[topo++] = ~sala;
+		if (mansao->direita[sala] != SEM_INDICE_COLUNAR)
+		{
+			trabalho->pilha[topo++] = mansao->direita[sala];
+		}
+		if (mansao->esquerda[sala] != SEM_INDICE_COLUNAR)
+		{
+			trabalho->pilha[topo++] = mansao->esquerda[sala];
+		}
+	}
+
+	percorrerOrigensAcusacoes(trabalho, posicao, bloco, false);
+}
+
+/// @brief Executa as tarefas da avaliação em uma thread, retirando a próxima da fila compartilhada.
+static int executarTrabalhoAcusacoes(void* argumento)
+{
+	TrabalhoAcusacoes* trabalho = (TrabalhoAcusacoes*)argumento;
+	int32_t totalTarefas = trabalho->avaliacao->tabela->totalTarefas;
+	int32_t tarefa;
+
+	while (trabalho->sucesso &&
+		(tarefa = atomic_fetch_add_explicit(&trabalho->avaliacao->proximaTarefa, 1, memory_order_relaxed)) < totalTarefas)
+	{
+		executarTarefaAcusacoes(trabalho, tarefa);
+	}
+
+	return 0;
+}
+
+/// @brief Acrescenta uma sala à divisão da mansão.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+static bool acrescentarDivisaoAcusacoes(AvaliacaoAcusacoes* avaliacao, int32_t sala, int32_t origem)
+{
+	if (avaliacao->totalDivisao == avaliacao->capacidadeDivisao)
+	{
+		int32_t capacidade = avaliacao->capacidadeDivisao > 0 ? 2 * avaliacao->capacidadeDivisao : 256;
+		int32_t* salas = (int32_t*)realloc(avaliacao->divisaoSala, (size_t)capacidade * sizeof(int32_t));
+		if (salas == NULL)
+		{
+			return false;
+		}
+		avaliacao->divisaoSala = salas;
+		int32_t* origens = (int32_t*)realloc(avaliacao->divisaoOrigem, (size_t)capacidade * sizeof(int32_t));
+		if (origens == NULL)
+		{
+			return false;
+		}
+		avaliacao->divisaoOrigem = origens;
+		avaliacao->capacidadeDivisao = capacidade;
+	}
+
+	avaliacao->divisaoSala[avaliacao->totalDivisao] = sala;
+	avaliacao->divisaoOrigem[avaliacao->totalDivisao] = origem;
+	avaliacao->totalDivisao++;
+	return true;
+}
+
+TabelaAcusacoes* avaliarAcusacoes(const CasoGerado* caso, int32_t pistasRequeridas, int totalThreads)
+{
+	if (caso == NULL || pistasRequeridas < 1 || totalThreads < 0)
+	{
+		return NULL;
+	}
+	if (totalThreads == 0)
+	{
+		totalThreads = contarProcessadores();
+	}
+	if (totalThreads > MAXIMO_THREADS_ACUSACOES)
+	{
+		totalThreads = MAXIMO_THREADS_ACUSACOES;
+	}
+
+	const MansaoColunar* mansao = caso->mansao;
+	TabelaAcusacoes* tabela = (TabelaAcusacoes*)calloc(1, sizeof(TabelaAcusacoes));
+	AvaliacaoAcusacoes* avaliacao = (AvaliacaoAcusacoes*)calloc(1, sizeof(AvaliacaoAcusacoes));
+	TrabalhoAcusacoes* trabalhos = (TrabalhoAcusacoes*)calloc((size_t)totalThreads, sizeof(TrabalhoAcusacoes));
+	bool sucesso = tabela != NULL && avaliacao != NULL && trabalhos != NULL;
+	if (sucesso)
+	{
+		tabela->totalSalas = mansao->totalSalas;
+		tabela->totalSuspeitos = caso->totalSuspeitos;
+		tabela->palavras = (caso->totalSuspeitos + 63) / 64;
+		tabela->pistasRequeridas = pistasRequeridas;
+		tabela->totalThreads = totalThreads;
+		tabela->acusaveis = (uint64_t*)calloc((size_t)tabela->totalSalas * tabela->palavras, sizeof(uint64_t));
+		avaliacao->caso = caso;
+		avaliacao->tabela = tabela;
+		atomic_init(&avaliacao->proximaTarefa, 0);
+		sucesso = tabela->acusaveis != NULL;
+	}
+	for (int t = 0; t < totalThreads && sucesso; t++)
+	{
+		trabalhos[t].avaliacao = avaliacao;
+		trabalhos[t].vistas = (uint32_t*)calloc((size_t)caso->totalPistasDistintas, sizeof(uint32_t));
+		trabalhos[t].capacidadePilha = 1024;
+		trabalhos[t].pilha = (int32_t*)malloc(trabalhos[t].capacidadePilha * sizeof(int32_t));
+		trabalhos[t].sucesso = trabalhos[t].vistas != NULL && trabalhos[t].pilha != NULL;
+		sucesso = trabalhos[t].sucesso;
+	}
+
+	// Divisão(fork): os níveis de cima da mansão, até haver subárvores suficientes para todas as threads.
+	int32_t inicioNivel = 0;
+	sucesso = sucesso && acrescentarDivisaoAcusacoes(avaliacao, 0, -1);
+	int32_t alvo = SUBARVORES_POR_THREAD_ACUSACOES * totalThreads;
+	for (int nivel = 0; sucesso && nivel < PROFUNDIDADE_DIVISAO_ACUSACOES &&
+		avaliacao->totalDivisao - inicioNivel < alvo && avaliacao->totalDivisao > inicioNivel; nivel++)
+	{
+		int32_t fimNivel = avaliacao->totalDivisao;
+		for (int32_t p = inicioNivel; p < fimNivel && sucesso; p++)
+		{
+			int32_t sala = avaliacao->divisaoSala[p];
+			if (mansao->esquerda[sala] != SEM_INDICE_COLUNAR)
+			{
+				sucesso = acrescentarDivisaoAcusacoes(avaliacao, mansao->esquerda[sala], p);
+			}
+			if (sucesso && mansao->direita[sala] != SEM_INDICE_COLUNAR)
+			{
+				sucesso = acrescentarDivisaoAcusacoes(avaliacao, mansao->direita[sala], p);
+			}
+		}
+		inicioNivel = fimNivel;
+	}
+
+	if (sucesso)
+	{
+		avaliacao->primeiraSubarvore = inicioNivel;
+		tabela->salasDivisao = inicioNivel;
+		tabela->totalTarefas = (avaliacao->totalDivisao - inicioNivel) * tabela->palavras;
+
+		// As salas acima das subárvores são poucas: cada uma conta as pistas do seu caminho desde a entrada.
+		TrabalhoAcusacoes* principal = &trabalhos[0];
+		for (int32_t p = 0; p < inicioNivel; p++)
+		{
+			int32_t sala = avaliacao->divisaoSala[p];
+			for (int32_t bloco = 0; bloco < tabela->palavras; bloco++)
+			{
+				percorrerOrigensAcusacoes(principal, p, bloco, true);
+				entrarSalaAcusacoes(principal, sala, bloco);
+				tabela->acusaveis[(size_t)sala * tabela->palavras + bloco] = principal->acusaveis;
+				sairSalaAcusacoes(principal, sala, bloco);
+				percorrerOrigensAcusacoes(principal, p, bloco, false);
+			}
+		}
+
+		// As tarefas(subárvores) são distribuídas entre as threads; a primeira é a thread atual(join ao fim).
+		thrd_t threads[MAXIMO_THREADS_ACUSACOES];
+		int criadas = 0;
+		for (int t = 1; t < totalThreads; t++)
+		{
+			if (thrd_create(&threads[criadas], executarTrabalhoAcusacoes, &trabalhos[t]) == thrd_success)
+			{
+				criadas++;
+			}
+		}
+		executarTrabalhoAcusacoes(&trabalhos[0]);
+		for (int t = 0; t < criadas; t++)
+		{
+			thrd_join(threads[t], NULL);
+		}
+		for (int t = 0; t < totalThreads; t++)
+		{
+			sucesso = sucesso && trabalhos[t].sucesso;
+		}
+	}
+
+	for (int t = 0; trabalhos != NULL && t < totalThreads; t++)
+	{
+		free(trabalhos[t].vistas);
+		free(trabalhos[t].pilha);
+	}
+	free(trabalhos);
+	if (avaliacao != NULL)
+	{
+		free(avaliacao->divisaoSala);
+		free(avaliacao->divisaoOrigem);
+		free(avaliacao);
+	}
+	if (!sucesso)
+	{
+		liberarTabelaAcusacoes(tabela);
+		return NULL;
+	}
+
+	return tabela;
+}
+
+bool acusacaoPermitida(const TabelaAcusacoes* tabela, int32_t sala, int32_t suspeito)
+{
+	if (sala < 0 || sala >= tabela->totalSalas || suspeito < 0 || suspeito >= tabela->totalSuspeitos)
+	{
+		return false;
+	}
+
+	return (tabela->acusaveis[(size_t)sala * tabela->palavras + suspeito / 64] >> (suspeito % 64)) & 1;
+}
+
+void liberarTabelaAcusacoes(TabelaAcusacoes* tabela)
+{
+	if (tabela != NULL)
+	{
+		free(tabela->acusaveis);
+		free(tabela);
+	}
+}
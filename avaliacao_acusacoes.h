@@ -0,0 +1,58 @@
+#ifndef AVALIACAO_ACUSACOES_H
+#define AVALIACAO_ACUSACOES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gerador_mansoes.h"
+
+// Desafio Detective Quest
+// Avaliação paralela(fork-join) de todas as acusações de um caso gerado: a mansão é dividida em subárvores,
+// distribuídas entre as threads junto com blocos de 64 suspeitos.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a quantidade máxima de threads da avaliação das acusações.
+#define MAXIMO_THREADS_ACUSACOES 64
+/// @brief Define quantas subárvores a divisão da mansão procura por thread, para equilibrar a carga das tarefas.
+#define SUBARVORES_POR_THREAD_ACUSACOES 16
+/// @brief Define a profundidade máxima da divisão da mansão em subárvores(uma mansão degenerada não se divide).
+#define PROFUNDIDADE_DIVISAO_ACUSACOES 64
+
+// **** Definições de estruturas. ****
+
+/// @brief Define a tabela das acusações de um caso gerado: para cada sala, os suspeitos que a regra das
+/// pistas requeridas permite acusar ao chegar nela pelo caminho desde a entrada, com as pistas desse caminho.
+/// Um bit por sala e suspeito, em linhas de palavras de 64 bits.
+typedef struct
+{
+	uint64_t* acusaveis; // Uma linha de palavras por sala: bit s ligado, o suspeito s pode ser acusado.
+	int32_t totalSalas;
+	int32_t totalSuspeitos;
+	int32_t palavras; // Palavras de 64 bits por linha.
+	int32_t pistasRequeridas;
+	int32_t totalTarefas; // Tarefas(subárvore e bloco de 64 suspeitos) distribuídas entre as threads.
+	int32_t salasDivisao; // Salas acima das subárvores, avaliadas na divisão.
+	int totalThreads; // Threads efetivamente usadas.
+} TabelaAcusacoes;
+
+// **** Funções da Avaliação Paralela das Acusações ****
+
+/// @brief Avalia todas as acusações de um caso gerado, em paralelo(fork-join): a mansão é dividida em
+/// subárvores, e cada tarefa percorre uma subárvore para um bloco de 64 suspeitos, contando as pistas do caminho.
+/// @param CasoGerado. Ponteiro usado na avaliação. Somente leitura.
+/// @param Inteiro. Pistas de um mesmo suspeito requeridas para a acusação(ex: NUMERO_PISTAS_REQUERIDAS).
+/// @param Inteiro. Quantidade de threads, de 1 a MAXIMO_THREADS_ACUSACOES. Zero para um thread por processador.
+/// @returns TabelaAcusacoes. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+TabelaAcusacoes* avaliarAcusacoes(const CasoGerado* caso, int32_t pistasRequeridas, int totalThreads);
+/// @brief Consulta na tabela se um suspeito pode ser acusado ao chegar a uma sala.
+/// @param TabelaAcusacoes. Ponteiro usado na consulta. Somente leitura.
+/// @param Inteiro. Índice da sala.
+/// @param Inteiro. Índice do suspeito.
+/// @returns Bool. Verdadeiro(true) se a acusação é permitida. Caso contrário, falso(false).
+bool acusacaoPermitida(const TabelaAcusacoes* tabela, int32_t sala, int32_t suspeito);
+/// @brief Libera a memória alocada para a tabela das acusações.
+/// @param TabelaAcusacoes. Ponteiro via referência, usado na operação de liberação.
+void liberarTabelaAcusacoes(TabelaAcusacoes* tabela);
+
+#endif
@@ -0,0 +1,289 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "catalogo_mapeado.h"
+
+// Desafio Detective Quest
+// Implementação do catálogo mapeável.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem abre o catálogo informa as falhas.
+
+// **** Funções do Catálogo Mapeado ****
+
+bool mapearArquivo(const char* caminho, ArquivoMapeado* mapeado)
+{
+	memset(mapeado, 0, sizeof(ArquivoMapeado));
+
+#ifdef _WIN32
+	mapeado->arquivo = CreateFileA(caminho, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	LARGE_INTEGER tamanho;
+	if (mapeado->arquivo == INVALID_HANDLE_VALUE || !GetFileSizeEx(mapeado->arquivo, &tamanho) || tamanho.QuadPart == 0)
+	{
+		if (mapeado->arquivo != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(mapeado->arquivo);
+		}
+		return false;
+	}
+
+	mapeado->mapeamento = CreateFileMappingA(mapeado->arquivo, NULL, PAGE_READONLY, 0, 0, NULL);
+	mapeado->bytes = mapeado->mapeamento != NULL ? (const char*)MapViewOfFile(mapeado->mapeamento, FILE_MAP_READ, 0, 0, 0) : NULL;
+	if (mapeado->bytes == NULL)
+	{
+		if (mapeado->mapeamento != NULL)
+		{
+			CloseHandle(mapeado->mapeamento);
+		}
+		CloseHandle(mapeado->arquivo);
+		return false;
+	}
+	mapeado->tamanho = (size_t)tamanho.QuadPart;
+#else
+	int descritor = open(caminho, O_RDONLY);
+	struct stat estado;
+	if (descritor < 0 || fstat(descritor, &estado) != 0 || estado.st_size == 0)
+	{
+		if (descritor >= 0)
+		{
+			close(descritor);
+		}
+		return false;
+	}
+
+	// O mapeamento continua válido depois que o descritor é fechado.
+	void* bytes = mmap(NULL, (size_t)estado.st_size, PROT_READ, MAP_PRIVATE, descritor, 0);
+	close(descritor);
+	if (bytes == MAP_FAILED)
+	{
+		return false;
+	}
+	mapeado->bytes = (const char*)bytes;
+	mapeado->tamanho = (size_t)estado.st_size;
+#endif
+
+	return true;
+}
+
+bool lerArquivoCopiado(const char* caminho, ArquivoMapeado* mapeado)
+{
+	memset(mapeado, 0, sizeof(ArquivoMapeado));
+	mapeado->copiado = true;
+
+	FILE* arquivo = fopen(caminho, "rb");
+	if (arquivo == NULL)
+	{
+		return false;
+	}
+
+	char* bytes = NULL;
+	long tamanho = fseek(arquivo, 0, SEEK_END) == 0 ? ftell(arquivo) : -1;
+	bool lido = tamanho > 0 && fseek(arquivo, 0, SEEK_SET) == 0 && (bytes = (char*)malloc((size_t)tamanho)) != NULL &&
+		fread(bytes, 1, (size_t)tamanho, arquivo) == (size_t)tamanho;
+	fclose(arquivo);
+	if (!lido)
+	{
+		free(bytes);
+		return false;
+	}
+
+	mapeado->bytes = bytes;
+	mapeado->tamanho = (size_t)tamanho;
+	return true;
+}
+
+void desmapearArquivo(ArquivoMapeado* mapeado)
+{
+	if (mapeado->bytes == NULL)
+		return;
+
+	if (mapeado->copiado)
+	{
+		free((char*)mapeado->bytes);
+	}
+	else
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(mapeado->bytes);
+		CloseHandle(mapeado->mapeamento);
+		CloseHandle(mapeado->arquivo);
+#else
+		munmap((void*)mapeado->bytes, mapeado->tamanho);
+#endif
+	}
+
+	mapeado->bytes = NULL;
+	mapeado->tamanho = 0;
+}
+
+const char* textoVisaoMapeada(const ArquivoMapeado* mapeado, VisaoTexto visao)
+{
+	// A visão é conferida a cada leitura, e não na abertura: só as páginas dos textos lidos são tocadas.
+	if ((size_t)visao.posicao + visao.tamanho >= mapeado->tamanho || mapeado->bytes[visao.posicao + visao.tamanho] != '\0')
+	{
+		return NULL;
+	}
+
+	return mapeado->bytes + visao.posicao;
+}
+
+bool gravarCatalogoMapeavel(const char* caminho, const char* const* pistas, const int32_t* suspeitoPista, int32_t totalPistas,
+	const char* const* suspeitos, int32_t totalSuspeitos)
+{
+	if (totalPistas < 0 || totalSuspeitos < 0)
+	{
+		return false;
+	}
+
+	// Primeira passada: as posições dos textos, a partir do início da região de textos.
+	size_t inicioTextos = sizeof(CabecalhoCatalogoMapeado) + (size_t)totalSuspeitos * sizeof(VisaoTexto) +
+		(size_t)totalPistas * sizeof(EntradaCatalogoMapeado);
+	size_t tamanhoTextos = 0;
+	for (int32_t i = 0; i < totalSuspeitos; i++)
+	{
+		tamanhoTextos += strlen(suspeitos[i]) + 1;
+	}
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		tamanhoTextos += strlen(pistas[i]) + 1;
+	}
+	if (inicioTextos + tamanhoTextos > UINT32_MAX)
+	{
+		return false;
+	}
+
+	FILE* arquivo = fopen(caminho, "wb");
+	if (arquivo == NULL)
+	{
+		return false;
+	}
+
+	CabecalhoCatalogoMapeado cabecalho;
+	memset(&cabecalho, 0, sizeof(cabecalho));
+	memcpy(cabecalho.magica, MAGICA_CATALOGO_MAPEADO, sizeof(cabecalho.magica));
+	cabecalho.versao = VERSAO_CATALOGO_MAPEADO;
+	cabecalho.totalPistas = totalPistas;
+	cabecalho.totalSuspeitos = totalSuspeitos;
+	cabecalho.tamanhoTextos = (uint32_t)tamanhoTextos;
+	bool sucesso = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1;
+
+	uint32_t posicao = (uint32_t)inicioTextos;
+	for (int32_t i = 0; i < totalSuspeitos && sucesso; i++)
+	{
+		VisaoTexto visao = { posicao, (uint32_t)strlen(suspeitos[i]) };
+		sucesso = fwrite(&visao, sizeof(visao), 1, arquivo) == 1;
+		posicao += visao.tamanho + 1;
+	}
+	for (int32_t i = 0; i < totalPistas && sucesso; i++)
+	{
+		EntradaCatalogoMapeado entrada = { { posicao, (uint32_t)strlen(pistas[i]) }, (uint32_t)suspeitoPista[i] };
+		sucesso = fwrite(&entrada, sizeof(entrada), 1, arquivo) == 1;
+		posicao += entrada.pista.tamanho + 1;
+	}
+
+	// Os textos, na mesma ordem, cada um seguido do seu '\0'.
+	for (int32_t i = 0; i < totalSuspeitos && sucesso; i++)
+	{
+		sucesso = fwrite(suspeitos[i], strlen(suspeitos[i]) + 1, 1, arquivo) == 1;
+	}
+	for (int32_t i = 0; i < totalPistas && sucesso; i++)
+	{
+		sucesso = fwrite(pistas[i], strlen(pistas[i]) + 1, 1, arquivo) == 1;
+	}
+
+	return fclose(arquivo) == 0 && sucesso;
+}
+
+CatalogoMapeado* abrirCatalogoMapeado(const char* caminho, bool mapear)
+{
+	CatalogoMapeado* catalogo = (CatalogoMapeado*)calloc(1, sizeof(CatalogoMapeado));
+	if (catalogo == NULL)
+	{
+		return NULL;
+	}
+
+	bool aberto = mapear ? mapearArquivo(caminho, &catalogo->arquivo) : lerArquivoCopiado(caminho, &catalogo->arquivo);
+	if (!aberto)
+	{
+		free(catalogo);
+		return NULL;
+	}
+
+	// Só o cabeçalho e os limites das tabelas são conferidos: nenhuma outra página é tocada.
+	const ArquivoMapeado* arquivo = &catalogo->arquivo;
+	const CabecalhoCatalogoMapeado* cabecalho = (const CabecalhoCatalogoMapeado*)arquivo->bytes;
+	bool valido = arquivo->tamanho >= sizeof(CabecalhoCatalogoMapeado) &&
+		memcmp(cabecalho->magica, MAGICA_CATALOGO_MAPEADO, sizeof(cabecalho->magica)) == 0 &&
+		cabecalho->versao == VERSAO_CATALOGO_MAPEADO && cabecalho->totalPistas >= 0 && cabecalho->totalSuspeitos >= 0 &&
+		sizeof(CabecalhoCatalogoMapeado) + (size_t)cabecalho->totalSuspeitos * sizeof(VisaoTexto) +
+		(size_t)cabecalho->totalPistas * sizeof(EntradaCatalogoMapeado) + cabecalho->tamanhoTextos == arquivo->tamanho;
+	if (!valido)
+	{
+		fecharCatalogoMapeado(catalogo);
+		return NULL;
+	}
+
+	catalogo->totalPistas = cabecalho->totalPistas;
+	catalogo->totalSuspeitos = cabecalho->totalSuspeitos;
+	catalogo->suspeitos = (const VisaoTexto*)(arquivo->bytes + sizeof(CabecalhoCatalogoMapeado));
+	catalogo->entradas = (const EntradaCatalogoMapeado*)(catalogo->suspeitos + catalogo->totalSuspeitos);
+	return catalogo;
+}
+
+const char* pistaCatalogoMapeado(const CatalogoMapeado* catalogo, int32_t entrada)
+{
+	if (entrada < 0 || entrada >= catalogo->totalPistas)
+	{
+		return NULL;
+	}
+
+	return textoVisaoMapeada(&catalogo->arquivo, catalogo->entradas[entrada].pista);
+}
+
+const char* suspeitoCatalogoMapeado(const CatalogoMapeado* catalogo, int32_t entrada)
+{
+	if (entrada < 0 || entrada >= catalogo->totalPistas || catalogo->entradas[entrada].suspeito >= (uint32_t)catalogo->totalSuspeitos)
+	{
+		return NULL;
+	}
+
+	return textoVisaoMapeada(&catalogo->arquivo, catalogo->suspeitos[catalogo->entradas[entrada].suspeito]);
+}
+
+bool carregarCatalogoMapeado(const CatalogoMapeado* catalogo, TabelaHash* tabela)
+{
+	if (!catalogo->arquivo.copiado && !registrarRegiaoMapeada(tabela->textos, catalogo->arquivo.bytes, catalogo->arquivo.tamanho))
+	{
+		return false;
+	}
+
+	bool valido = true;
+	for (int32_t i = 0; i < catalogo->totalPistas; i++)
+	{
+		const char* pista = pistaCatalogoMapeado(catalogo, i);
+		const char* suspeito = suspeitoCatalogoMapeado(catalogo, i);
+		if (pista == NULL || suspeito == NULL)
+		{
+			valido = false;
+			continue;
+		}
+
+		inserirNoHash(pista, suspeito, tabela);
+	}
+
+	return valido;
+}
+
+void fecharCatalogoMapeado(CatalogoMapeado* catalogo)
+{
+	if (catalogo == NULL)
+		return;
+
+	desmapearArquivo(&catalogo->arquivo);
+	free(catalogo);
+}
@@ -0,0 +1,134 @@
+#ifndef CATALOGO_MAPEADO_H
+#define CATALOGO_MAPEADO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+#include "catalogo_pistas.h"
+
+// Desafio Detective Quest
+// Formato em arquivo do catálogo de pistas e suspeitos, gravado uma vez e aberto mapeado na memória
+// (mmap ou MapViewOfFile) ou, como referência, lido por inteiro para um buffer próprio.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a assinatura do cabeçalho do catálogo mapeável.
+#define MAGICA_CATALOGO_MAPEADO "DQCATMAP"
+/// @brief Define a versão do formato do catálogo mapeável.
+#define VERSAO_CATALOGO_MAPEADO 1
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um arquivo mapeado na memória somente para leitura, ou lido por inteiro para a memória.
+typedef struct
+{
+	const char* bytes;
+	size_t tamanho;
+	bool copiado; // Lido com fread para um buffer próprio, em vez de mapeado.
+#ifdef _WIN32
+	HANDLE arquivo;
+	HANDLE mapeamento;
+#endif
+} ArquivoMapeado;
+
+/// @brief Define uma visão de texto em um arquivo mapeado: posição e tamanho, em bytes, de um texto
+/// seguido de '\0' no próprio arquivo, para que as comparações usem os bytes mapeados diretamente.
+typedef struct
+{
+	uint32_t posicao;
+	uint32_t tamanho;
+} VisaoTexto;
+
+/// @brief Define o cabeçalho do catálogo mapeável. Seguem-se as visões dos suspeitos, as entradas
+/// do catálogo e, por fim, os textos.
+typedef struct
+{
+	char magica[8];
+	uint32_t versao;
+	int32_t totalPistas;
+	int32_t totalSuspeitos;
+	uint32_t tamanhoTextos; // Bytes da região de textos, ao fim do arquivo.
+} CabecalhoCatalogoMapeado;
+
+/// @brief Define uma entrada do catálogo mapeável: a pista e o índice do seu suspeito.
+typedef struct
+{
+	VisaoTexto pista;
+	uint32_t suspeito;
+} EntradaCatalogoMapeado;
+
+/// @brief Define um catálogo de pistas e suspeitos aberto sobre um arquivo: as tabelas e os textos
+/// são lidos no próprio arquivo, sem cópias, e só são trazidos do disco quando tocados.
+typedef struct
+{
+	ArquivoMapeado arquivo;
+	const VisaoTexto* suspeitos;
+	const EntradaCatalogoMapeado* entradas;
+	int32_t totalPistas;
+	int32_t totalSuspeitos;
+} CatalogoMapeado;
+
+// **** Funções do Catálogo Mapeado ****
+
+/// @brief Mapeia um arquivo na memória somente para leitura. Para que um heap de textos referencie os textos
+/// do arquivo sem copiá-los, a região deve ser registrada nele(registrarRegiaoMapeada).
+/// @param Texto. Caminho do arquivo.
+/// @param ArquivoMapeado. Ponteiro via referência, para atribuição.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool mapearArquivo(const char* caminho, ArquivoMapeado* mapeado);
+/// @brief Lê um arquivo por inteiro para um buffer próprio, com a mesma interface do arquivo mapeado.
+/// Os textos do buffer não são registrados, então são copiados para o heap ao serem internados.
+/// @param Texto. Caminho do arquivo.
+/// @param ArquivoMapeado. Ponteiro via referência, para atribuição.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool lerArquivoCopiado(const char* caminho, ArquivoMapeado* mapeado);
+/// @brief Desfaz o mapeamento(ou libera o buffer) de um arquivo. Os heaps de textos que registraram a região
+/// devem ser liberados antes, ou esquecê-la(esquecerRegiaoMapeada).
+/// @param ArquivoMapeado. Ponteiro via referência, usado na operação de liberação.
+void desmapearArquivo(ArquivoMapeado* mapeado);
+/// @brief Recupera o texto de uma visão, conferindo se ela cabe no arquivo e termina em '\0'.
+/// @param ArquivoMapeado. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param VisaoTexto. Posição e tamanho do texto.
+/// @returns Texto. Ponteiro para os bytes no próprio arquivo, ou NULL se a visão for inválida.
+const char* textoVisaoMapeada(const ArquivoMapeado* mapeado, VisaoTexto visao);
+/// @brief Grava um catálogo de pistas e suspeitos no formato mapeável.
+/// @param Texto. Caminho do arquivo.
+/// @param Vetor. Pistas do catálogo.
+/// @param Vetor. Índice do suspeito de cada pista.
+/// @param Inteiro. Quantidade de pistas.
+/// @param Vetor. Nomes dos suspeitos.
+/// @param Inteiro. Quantidade de suspeitos.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool gravarCatalogoMapeavel(const char* caminho, const char* const* pistas, const int32_t* suspeitoPista, int32_t totalPistas,
+	const char* const* suspeitos, int32_t totalSuspeitos);
+/// @brief Abre um catálogo mapeável, conferindo apenas o cabeçalho e os limites das tabelas:
+/// os textos são conferidos ao serem lidos.
+/// @param Texto. Caminho do arquivo.
+/// @param Bool. Verdadeiro(true) para mapear o arquivo; falso(false) para lê-lo por inteiro(referência).
+/// @returns CatalogoMapeado. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+CatalogoMapeado* abrirCatalogoMapeado(const char* caminho, bool mapear);
+/// @brief Recupera a pista de uma entrada do catálogo mapeado.
+/// @param CatalogoMapeado. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice da entrada.
+/// @returns Texto. Ponteiro para os bytes no arquivo, ou NULL se a entrada for inválida.
+const char* pistaCatalogoMapeado(const CatalogoMapeado* catalogo, int32_t entrada);
+/// @brief Recupera o suspeito de uma entrada do catálogo mapeado.
+/// @param CatalogoMapeado. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice da entrada.
+/// @returns Texto. Ponteiro para os bytes no arquivo, ou NULL se a entrada for inválida.
+const char* suspeitoCatalogoMapeado(const CatalogoMapeado* catalogo, int32_t entrada);
+/// @brief Carrega as entradas do catálogo mapeado na tabela hash. Com o arquivo mapeado, a região é registrada
+/// no heap de textos da tabela, e os nós referenciam os textos mapeados.
+/// @param CatalogoMapeado. Ponteiro usado na leitura. Somente leitura.
+/// @param TabelaHash. Ponteiro via referência, usado na inserção. Deve ser liberada antes do fechamento do catálogo.
+/// @returns Bool. Verdadeiro(true) se todas as entradas eram válidas. Caso contrário, falso(false).
+bool carregarCatalogoMapeado(const CatalogoMapeado* catalogo, TabelaHash* tabela);
+/// @brief Fecha o catálogo mapeado. As estruturas que referenciam os seus textos devem ser liberadas antes.
+/// @param CatalogoMapeado. Ponteiro via referência, usado na operação de liberação.
+void fecharCatalogoMapeado(CatalogoMapeado* catalogo);
+
+#endif
@@ -0,0 +1,421 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "catalogo_pistas.h"
+
+// Desafio Detective Quest
+// Implementação do catálogo de pistas: leitura sem trava, publicação atômica das cadeias e do índice
+// perfeito, e liberação dos nós e índices antigos após o período de graça dos leitores.
+// As publicações e o anúncio de época dos leitores são sequencialmente consistentes: se o escritor não
+// enxergar a época de um leitor, é garantido que o leitor enxergará o que já foi republicado.
+
+// **** Funções internas do Catálogo de Pistas ****
+
+/// @brief Aguarda o período de graça dos leitores e libera os nós e índices aposentados.
+/// Deve ser chamada com a trava de escrita adquirida.
+static void sincronizarCatalogo(TabelaHash* tabela)
+{
+	if (tabela->nosAposentados == NULL && tabela->indicesAposentados == NULL)
+	{
+		return;
+	}
+
+	// Avança a época; qualquer leitor que entrar a partir daqui já enxerga as publicações novas.
+	unsigned long long novaEpoca = atomic_fetch_add(&tabela->epocaGlobal, 1) + 1;
+
+	for (int i = 0; i < MAXIMO_LEITORES_CATALOGO; i++)
+	{
+		unsigned long long epoca;
+		while ((epoca = atomic_load(&tabela->leitores[i].epoca)) != 0 && epoca < novaEpoca)
+		{
+			thrd_yield(); // Leitor ainda dentro de uma seção iniciada antes da publicação.
+		}
+	}
+
+	while (tabela->nosAposentados != NULL)
+	{
+		NoHash* temp = tabela->nosAposentados;
+		tabela->nosAposentados = temp->proximoAposentado;
+		free(temp);
+	}
+	while (tabela->indicesAposentados != NULL)
+	{
+		IndicePerfeitoCatalogo* temp = tabela->indicesAposentados;
+		tabela->indicesAposentados = temp->proximoAposentado;
+		liberarHashPerfeito(temp->hash);
+		free(temp->nos);
+		free(temp);
+	}
+}
+
+/// @brief Retira o índice perfeito publicado, que passa para a fila de liberação.
+/// Deve ser chamada com a trava de escrita adquirida.
+static void aposentarIndicePerfeito(TabelaHash* tabela)
+{
+	IndicePerfeitoCatalogo* indice = atomic_exchange(&tabela->indicePerfeito, NULL);
+	if (indice != NULL)
+	{
+		indice->proximoAposentado = tabela->indicesAposentados;
+		tabela->indicesAposentados = indice;
+	}
+}
+
+/// @brief Libera uma cadeia de nós ainda não publicada(ou já sem leitores).
+static void liberarCadeiaNos(NoHash* atual, const NoHash* fim)
+{
+	while (atual != fim)
+	{
+		NoHash* temp = atual;
+		atual = atual->proximo;
+		free(temp);
+	}
+}
+
+// **** Funções do Catálogo de Pistas ****
+
+TabelaHash* alocarTabelaHash(size_t capacidadeFiltro)
+{
+	TabelaHash* tabela = (TabelaHash*)malloc(sizeof(TabelaHash));
+	if (tabela == NULL)
+	{
+		return NULL;
+	}
+
+	tabela->textos = criarHeapTextos();
+	tabela->filtroChaves = capacidadeFiltro > 0 ? criarFiltroBloom(capacidadeFiltro, TAXA_FALSOS_POSITIVOS_BLOOM) : NULL;
+	if (tabela->textos == NULL || (capacidadeFiltro > 0 && tabela->filtroChaves == NULL) ||
+		mtx_init(&tabela->travaEscrita, mtx_plain) != thrd_success)
+	{
+		liberarHeapTextos(tabela->textos);
+		liberarFiltroBloom(tabela->filtroChaves);
+		free(tabela);
+		return NULL;
+	}
+
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		atomic_init(&tabela->dados[i], NULL);
+	}
+	atomic_init(&tabela->indicePerfeito, NULL);
+
+	for (int i = 0; i < MAXIMO_LEITORES_CATALOGO; i++)
+	{
+		atomic_init(&tabela->leitores[i].epoca, 0);
+		atomic_init(&tabela->leitores[i].ocupado, false);
+	}
+
+	// A época começa em 1, pois zero é reservado para leitores inativos.
+	atomic_init(&tabela->epocaGlobal, 1);
+	tabela->nosAposentados = NULL;
+	tabela->indicesAposentados = NULL;
+
+	return tabela;
+}
+
+uint32_t funcao_hash(const char* chave)
+{
+	// Soma os bytes sem sinal: com char assinado, os bytes UTF-8 dos acentos tornariam a soma negativa.
+	uint32_t soma = 0;
+	for (const unsigned char* atual = (const unsigned char*)chave; *atual != '\0'; atual++)
+	{
+		soma += *atual;
+	}
+	return soma % TAMANHO_TABELA_HASH;
+}
+
+bool inserirNoHash(const char* pista, const char* suspeito, TabelaHash* tabela)
+{
+	return inserirNoHashIndices(pista, suspeito, -1, -1, tabela);
+}
+
+bool inserirNoHashIndices(const char* pista, const char* suspeito, int32_t indicePista, int32_t indiceSuspeito,
+	TabelaHash* tabela)
+{
+	uint32_t indice = funcao_hash(pista); // Descobre onde armazenar.
+	// Cria um nó.
+	NoHash* novo = (NoHash*)malloc(sizeof(NoHash));
+	if (novo == NULL)
+	{
+		return false;
+	}
+	novo->indicePista = indicePista;
+	novo->indiceSuspeito = indiceSuspeito;
+	novo->proximoAposentado = NULL;
+
+	mtx_lock(&tabela->travaEscrita);
+
+	// O heap de textos é do escritor: os textos já internados não mudam de lugar, então os leitores
+	// podem lê-los sem trava.
+	if (!atribuirTextoCompacto(tabela->textos, &novo->pista, pista) ||
+		!atribuirTextoCompacto(tabela->textos, &novo->suspeito, suspeito))
+	{
+		mtx_unlock(&tabela->travaEscrita);
+		free(novo);
+		return false;
+	}
+
+	// O filtro recebe a pista antes da publicação, e o índice perfeito sai antes: quem encontrar
+	// o nó já passa pelo filtro, e ninguém busca no índice uma lista que mudou.
+	inserirFiltroBloom(tabela->filtroChaves, pista);
+	aposentarIndicePerfeito(tabela);
+
+	// Insere no início da lista (head), já preenchido.
+	novo->proximo = atomic_load_explicit(&tabela->dados[indice], memory_order_relaxed);
+	atomic_store(&tabela->dados[indice], novo);
+
+	sincronizarCatalogo(tabela);
+	mtx_unlock(&tabela->travaEscrita);
+
+	return true;
+}
+
+bool removerNoHash(const char* pista, TabelaHash* tabela)
+{
+	uint32_t indice = funcao_hash(pista);
+
+	mtx_lock(&tabela->travaEscrita);
+
+	NoHash* cabeca = atomic_load_explicit(&tabela->dados[indice], memory_order_relaxed);
+	NoHash* alvo = cabeca;
+	while (alvo != NULL && strcmp(lerTextoCompacto(&alvo->pista), pista) != 0)
+	{
+		alvo = alvo->proximo;
+	}
+
+	if (alvo == NULL)
+	{
+		mtx_unlock(&tabela->travaEscrita);
+		return false; // Não encontrado.
+	}
+
+	// Copiamos os nós anteriores ao alvo; o restante da cadeia é compartilhado.
+	NoHash* novaCabeca = alvo->proximo;
+	NoHash* copiaCauda = NULL;
+	for (NoHash* atual = cabeca; atual != alvo; atual = atual->proximo)
+	{
+		NoHash* copia = (NoHash*)malloc(sizeof(NoHash));
+		if (copia == NULL)
+		{
+			// Desfaz as cópias parciais; a cadeia publicada continua intacta.
+			if (copiaCauda != NULL)
+			{
+				liberarCadeiaNos(novaCabeca, alvo->proximo);
+			}
+			mtx_unlock(&tabela->travaEscrita);
+			return false;
+		}
+
+		// Os textos longos continuam no heap da tabela; a cópia aponta para os mesmos.
+		*copia = *atual;
+		copia->proximoAposentado = NULL;
+		copia->proximo = alvo->proximo;
+		if (copiaCauda == NULL)
+		{
+			novaCabeca = copia;
+		}
+		else
+		{
+			copiaCauda->proximo = copia;
+		}
+		copiaCauda = copia;
+	}
+
+	aposentarIndicePerfeito(tabela);
+	atomic_store(&tabela->dados[indice], novaCabeca);
+
+	// Os nós antigos (prefixo e alvo) ainda podem estar sendo lidos.
+	for (NoHash* atual = cabeca; atual != alvo->proximo; atual = atual->proximo)
+	{
+		atual->proximoAposentado = tabela->nosAposentados;
+		tabela->nosAposentados = atual;
+	}
+
+	sincronizarCatalogo(tabela);
+	mtx_unlock(&tabela->travaEscrita);
+
+	return true;
+}
+
+const NoHash* buscarNoHash(const char* pista, const TabelaHash* tabela, EstatisticasBloom* estatisticas)
+{
+	// O filtro vem antes de tudo: a pista certamente ausente não chega ao índice perfeito nem às listas.
+	if (!consultarFiltroBloom(tabela->filtroChaves, pista, estatisticas))
+	{
+		return NULL; // Ausência garantida pelo filtro.
+	}
+
+	// As publicações são lidas com acquire: o anúncio da época(em entrarLeituraCatalogo) já é seguido
+	// de uma barreira sequencialmente consistente.
+	const NoHash* encontrado = NULL;
+	const IndicePerfeitoCatalogo* indice = atomic_load_explicit(
+		(_Atomic(IndicePerfeitoCatalogo*)*)&tabela->indicePerfeito, memory_order_acquire);
+	if (indice != NULL)
+	{
+		// Um hash, um acesso e uma comparação: a pista fora do catálogo cai em uma posição qualquer.
+		const NoHash* candidato = indice->nos[posicaoHashPerfeito(indice->hash, pista)];
+		encontrado = strcmp(lerTextoCompacto(&candidato->pista), pista) == 0 ? candidato : NULL;
+	}
+	else
+	{
+		// Os nós publicados são imutáveis, então o encadeamento pode ser lido sem barreiras adicionais.
+		const NoHash* atual = atomic_load_explicit((_Atomic(NoHash*)*)&tabela->dados[funcao_hash(pista)],
+			memory_order_acquire);
+		while (atual != NULL && encontrado == NULL)
+		{
+			if (strcmp(lerTextoCompacto(&atual->pista), pista) == 0)
+			{
+				encontrado = atual; // Encontrou.
+			}
+
+			atual = atual->proximo;
+		}
+	}
+
+	if (encontrado == NULL && tabela->filtroChaves != NULL && estatisticas != NULL)
+	{
+		estatisticas->falsosPositivos++; // Aprovada pelo filtro, mas fora do catálogo.
+	}
+
+	return encontrado;
+}
+
+bool indexarTabelaHashPerfeita(TabelaHash* tabela)
+{
+	mtx_lock(&tabela->travaEscrita);
+	aposentarIndicePerfeito(tabela);
+	sincronizarCatalogo(tabela);
+
+	int32_t total = 0;
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		for (const NoHash* atual = atomic_load_explicit(&tabela->dados[i], memory_order_relaxed); atual != NULL;
+			atual = atual->proximo)
+		{
+			total++;
+		}
+	}
+
+	const char** chaves = (const char**)malloc((size_t)(total > 0 ? total : 1) * sizeof(const char*));
+	IndicePerfeitoCatalogo* indice = (IndicePerfeitoCatalogo*)malloc(sizeof(IndicePerfeitoCatalogo));
+	NoHash** nos = (NoHash**)malloc((size_t)(total > 0 ? total : 1) * sizeof(NoHash*));
+	if (total == 0 || chaves == NULL || indice == NULL || nos == NULL)
+	{
+		mtx_unlock(&tabela->travaEscrita);
+		free(chaves);
+		free(indice);
+		free(nos);
+		return false;
+	}
+
+	int32_t k = 0;
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		for (NoHash* atual = atomic_load_explicit(&tabela->dados[i], memory_order_relaxed); atual != NULL;
+			atual = atual->proximo, k++)
+		{
+			chaves[k] = lerTextoCompacto(&atual->pista);
+			nos[k] = atual;
+		}
+	}
+
+	HashPerfeito* hash = construirHashPerfeito(chaves, total, 0x9E3779B97F4A7C15ULL);
+	free(chaves);
+	if (hash == NULL)
+	{
+		mtx_unlock(&tabela->travaEscrita);
+		free(indice);
+		free(nos);
+		return false;
+	}
+
+	// Os nós são reposicionados no próprio vetor, na posição da sua pista: cada ciclo da permutação é
+	// percorrido até voltar ao início.
+	for (int32_t i = 0; i < total; i++)
+	{
+		int32_t destino = posicaoHashPerfeito(hash, lerTextoCompacto(&nos[i]->pista));
+		while (destino != i)
+		{
+			NoHash* temp = nos[destino];
+			nos[destino] = nos[i];
+			nos[i] = temp;
+			destino = posicaoHashPerfeito(hash, lerTextoCompacto(&nos[i]->pista));
+		}
+	}
+
+	// O índice é publicado já preenchido.
+	indice->hash = hash;
+	indice->nos = nos;
+	indice->proximoAposentado = NULL;
+	atomic_store(&tabela->indicePerfeito, indice);
+
+	mtx_unlock(&tabela->travaEscrita);
+	return true;
+}
+
+void descartarIndicePerfeito(TabelaHash* tabela)
+{
+	mtx_lock(&tabela->travaEscrita);
+	aposentarIndicePerfeito(tabela);
+	sincronizarCatalogo(tabela);
+	mtx_unlock(&tabela->travaEscrita);
+}
+
+int registrarLeitorCatalogo(TabelaHash* tabela)
+{
+	for (int i = 0; i < MAXIMO_LEITORES_CATALOGO; i++)
+	{
+		bool esperado = false;
+		if (atomic_compare_exchange_strong(&tabela->leitores[i].ocupado, &esperado, true))
+		{
+			return i;
+		}
+	}
+
+	return -1; // Todos os slots ocupados.
+}
+
+void desregistrarLeitorCatalogo(TabelaHash* tabela, int leitor)
+{
+	if (leitor < 0 || leitor >= MAXIMO_LEITORES_CATALOGO)
+	{
+		return;
+	}
+
+	atomic_store(&tabela->leitores[leitor].epoca, 0);
+	atomic_store(&tabela->leitores[leitor].ocupado, false);
+}
+
+void entrarLeituraCatalogo(TabelaHash* tabela, int leitor)
+{
+	// O anúncio precisa ficar visível antes das leituras das cabeças e do índice: sem a barreira,
+	// a escrita da época poderia ser ultrapassada pelas leituras(store → load), e o escritor
+	// liberaria nós que o leitor ainda vai percorrer.
+	unsigned long long epoca = atomic_load(&tabela->epocaGlobal);
+	atomic_store(&tabela->leitores[leitor].epoca, epoca);
+	atomic_thread_fence(memory_order_seq_cst);
+}
+
+void sairLeituraCatalogo(TabelaHash* tabela, int leitor)
+{
+	atomic_store_explicit(&tabela->leitores[leitor].epoca, 0, memory_order_release);
+}
+
+void liberarTabelaHash(TabelaHash* table)
+{
+	if (table == NULL)
+		return;
+
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		liberarCadeiaNos(atomic_load_explicit(&table->dados[i], memory_order_relaxed), NULL);
+	}
+
+	// Sem leitores ativos, a sincronização libera as filas e o índice sem esperar.
+	aposentarIndicePerfeito(table);
+	sincronizarCatalogo(table);
+
+	liberarFiltroBloom(table->filtroChaves);
+	liberarHeapTextos(table->textos);
+	mtx_destroy(&table->travaEscrita);
+	free(table);
+}
@@ -0,0 +1,157 @@
+#ifndef CATALOGO_PISTAS_H
+#define CATALOGO_PISTAS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+#include "textos_compactos.h"
+#include "filtro_bloom.h"
+#include "hash_perfeito.h"
+
+// Desafio Detective Quest
+// Catálogo pista → suspeito: tabela hash com listas encadeadas, filtro de Bloom das chaves e,
+// para o catálogo fixo, um índice perfeito. Pode ser compartilhado entre várias threads, com
+// recuperação por épocas(estilo RCU): os leitores não usam trava, os escritores são serializados
+// e os nós e índices substituídos só são liberados após o período de graça dos leitores.
+// A thread que escreve(ex: o jogo, com um único catálogo) pode buscar sem se registrar como leitora.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o tamanho máximo do número de itens a integrarem a tabela hash.
+#define TAMANHO_TABELA_HASH 10
+/// @brief Define o número máximo de leitores(threads) registrados ao mesmo tempo no catálogo.
+#define MAXIMO_LEITORES_CATALOGO 64
+/// @brief Define o alinhamento de cada registro de leitor: uma linha de cache, para isolar os contadores.
+#define ALINHAMENTO_LEITOR_CATALOGO 64
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um nó do catálogo, com a pista e o suspeito associados.
+/// Depois de publicado, nenhum campo é alterado; a remoção cria uma nova cadeia.
+struct NoHash
+{
+	TextoCompacto pista;
+	TextoCompacto suspeito;
+	int32_t indicePista; // Identificador denso da pista no catálogo do caso, ou -1.
+	int32_t indiceSuspeito; // Índice do suspeito em SUSPEITOS_CASO, ou -1.
+	struct NoHash* proximo;
+	struct NoHash* proximoAposentado; // Uso exclusivo do escritor, na fila de liberação.
+};
+
+/// @brief Define a struct com alias NoHash, usado na tabela hash.
+typedef struct NoHash NoHash;
+
+/// @brief Define o índice perfeito de um catálogo fixo: o hash e o nó de cada posição,
+/// publicados juntos para que o leitor os obtenha com uma única leitura.
+struct IndicePerfeitoCatalogo
+{
+	HashPerfeito* hash;
+	NoHash** nos; // Nó de cada posição do hash perfeito.
+	struct IndicePerfeitoCatalogo* proximoAposentado; // Uso exclusivo do escritor, na fila de liberação.
+};
+
+/// @brief Define a struct com alias IndicePerfeitoCatalogo, usado na tabela hash.
+typedef struct IndicePerfeitoCatalogo IndicePerfeitoCatalogo;
+
+/// @brief Define o registro de época de um leitor, isolado em sua própria linha de cache.
+/// Época zero indica que o leitor está fora de uma seção de leitura.
+typedef struct
+{
+	_Alignas(ALINHAMENTO_LEITOR_CATALOGO) atomic_ullong epoca;
+	atomic_bool ocupado;
+} SlotLeitor;
+
+/// @brief Define uma tabela hash, usada na associação de pistas e suspeitos.
+/// O filtro de Bloom é consultado antes do índice perfeito e das listas: a pista certamente ausente
+/// é rejeitada sem acessar os nós. As estatísticas das consultas ficam com quem busca.
+/// As cabeças das listas e o índice são publicados de forma atômica; o heap de textos e as filas
+/// de liberação são usados somente pelo escritor, com a trava de escrita adquirida.
+typedef struct
+{
+	_Atomic(NoHash*) dados[TAMANHO_TABELA_HASH];
+	FiltroBloom* filtroChaves; // Filtro sobre as pistas do catálogo, dimensionado pela quantidade de pistas.
+	_Atomic(IndicePerfeitoCatalogo*) indicePerfeito; // Índice do catálogo fixo, ou NULL para buscar nas listas.
+	HeapTextos* textos; // Textos longos dos nós, da própria tabela.
+	atomic_ullong epocaGlobal;
+	SlotLeitor leitores[MAXIMO_LEITORES_CATALOGO];
+	mtx_t travaEscrita;
+	NoHash* nosAposentados;
+	IndicePerfeitoCatalogo* indicesAposentados;
+} TabelaHash;
+
+// **** Funções do Catálogo de Pistas ****
+
+/// @brief Aloca uma tabela hash vazia, com o filtro de Bloom das chaves e sem o índice perfeito.
+/// @param Inteiro. Quantidade de pistas esperada, usada no dimensionamento do filtro, ou zero para não usar o filtro.
+/// @returns TabelaHash. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+TabelaHash* alocarTabelaHash(size_t capacidadeFiltro);
+/// @brief Efetua a criação um valor hash, para uso com as associações sobre as pistas e suspeitos.
+/// Baseado no conteúdo da plataforma.
+/// @param Texto. Ponteiro para um valor de texto, para efetuar o hash.
+/// @returns Inteiro sem sinal. Valor de um índice válido para uso seguro com a tabela.
+uint32_t funcao_hash(const char* chave);
+/// @brief Efetua a inserção de valores de pista e suspeito associados na tabela hash.
+/// Baseado no conteúdo da plataforma.
+/// @param Texto. Ponteiro para o valor de texto da pista a inserir.
+/// @param Texto. Ponteiro para o valor de texto do suspeito a inserir.
+/// @param TabelaHash. Ponteiro via referência, usado para atribuir e recuperar pistas e suspeitos.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool inserirNoHash(const char* pista, const char* suspeito, TabelaHash* tabela);
+/// @brief Efetua a inserção de valores de pista e suspeito associados na tabela hash, guardando no nó
+/// os seus índices no caso: quem coleta a pista não precisa procurá-los pelos textos.
+/// O nó é publicado no início da lista, já preenchido; o índice perfeito, se houver, é descartado.
+/// @param Texto. Ponteiro para o valor de texto da pista a inserir.
+/// @param Texto. Ponteiro para o valor de texto do suspeito a inserir.
+/// @param Inteiro. Índice da pista em PISTAS_CATALOGO_CASO, ou -1.
+/// @param Inteiro. Índice do suspeito em SUSPEITOS_CASO, ou -1.
+/// @param TabelaHash. Ponteiro via referência, usado para atribuir e recuperar pistas e suspeitos.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool inserirNoHashIndices(const char* pista, const char* suspeito, int32_t indicePista, int32_t indiceSuspeito,
+	TabelaHash* tabela);
+/// @brief Efetua a remoção da associação mais recente de uma pista, copiando os nós anteriores a ela em
+/// uma nova cadeia. O índice perfeito, se houver, é descartado, e os nós substituídos são liberados após
+/// o período de graça dos leitores. Os bits da pista no filtro de Bloom permanecem.
+/// @param Texto. Ponteiro para o valor de texto da pista a remover.
+/// @param TabelaHash. Ponteiro via referência, usado na publicação.
+/// @returns Bool. Verdadeiro(true) se a pista foi encontrada e removida. Caso contrário, falso(false).
+bool removerNoHash(const char* pista, TabelaHash* tabela);
+/// @brief Efetua a busca de nós, relativos a pistas e suspeitos associados na tabela hash.
+/// Uma thread que não escreve no catálogo deve buscar dentro de uma seção de leitura.
+/// @param Texto. Ponteiro para o valor de texto da pista a procurar.
+/// @param TabelaHash. Ponteiro via referência, usado para recuperar pistas e suspeitos. Somente leitura.
+/// @param EstatisticasBloom. Ponteiro via referência das estatísticas das consultas ao filtro das chaves,
+/// ou NULL para não contar.
+/// @returns NoHash. Ponteiro do tipo conforme especificado, ou NULL se não encontrado.
+const NoHash* buscarNoHash(const char* pista, const TabelaHash* tabela, EstatisticasBloom* estatisticas);
+/// @brief Cria o índice perfeito de uma tabela hash com pistas distintas: a busca passa a ser um hash,
+/// um acesso ao vetor de nós e uma comparação. Inserções e remoções descartam o índice.
+/// @param TabelaHash. Ponteiro via referência, usado na indexação.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário(pistas repetidas, ou falta de memória), falso(false).
+bool indexarTabelaHashPerfeita(TabelaHash* tabela);
+/// @brief Descarta o índice perfeito de uma tabela hash, que volta a buscar nas listas.
+/// @param TabelaHash. Ponteiro via referência, usado na operação de liberação.
+void descartarIndicePerfeito(TabelaHash* tabela);
+/// @brief Registra uma thread leitora no catálogo.
+/// @param TabelaHash. Ponteiro via referência, usado no registro.
+/// @returns Inteiro. Identificador do leitor, ou -1 se todos os slots estiverem ocupados.
+int registrarLeitorCatalogo(TabelaHash* tabela);
+/// @brief Libera o slot de uma thread leitora, que não deve estar em uma seção de leitura.
+/// @param TabelaHash. Ponteiro via referência, usado na liberação do slot.
+/// @param Inteiro. Identificador retornado por registrarLeitorCatalogo.
+void desregistrarLeitorCatalogo(TabelaHash* tabela, int leitor);
+/// @brief Inicia uma seção de leitura. Os nós obtidos permanecem válidos até sairLeituraCatalogo.
+/// @param TabelaHash. Ponteiro via referência, usado para anunciar a época do leitor.
+/// @param Inteiro. Identificador do leitor.
+void entrarLeituraCatalogo(TabelaHash* tabela, int leitor);
+/// @brief Encerra uma seção de leitura.
+/// @param TabelaHash. Ponteiro via referência, usado para anunciar a saída do leitor.
+/// @param Inteiro. Identificador do leitor.
+void sairLeituraCatalogo(TabelaHash* tabela, int leitor);
+/// @brief Libera a memória alocada para a tabela hash. Nenhum leitor pode estar ativo.
+/// @param TabelaHash. Ponteiro raiz, via referência, usado na operação de liberação.
+void liberarTabelaHash(TabelaHash* table);
+
+#endif
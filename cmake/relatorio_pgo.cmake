@@ -0,0 +1,100 @@
+# Relatório do PGO: mede o Mestre com PGO e o Mestre de release comum na mesma carga de partidas
+# simuladas(com uma semente diferente das do treino) e grava a comparação em Markdown.
+# Executado pelo alvo relatorio_pgo(estágio DQ_PGO=USAR).
+#
+# Variáveis: PROGRAMA_PGO, PROGRAMA_REFERENCIA, LINHAS, RELATORIO e REPETICOES(opcional).
+
+if(NOT REPETICOES)
+    set(REPETICOES 5)
+endif()
+
+if(NOT EXISTS "${PROGRAMA_REFERENCIA}")
+    message(FATAL_ERROR "Executável de referência não encontrado: '${PROGRAMA_REFERENCIA}'.\n"
+        "Compile o preset linux-release, ou informe DQ_PGO_REFERENCIA.")
+endif()
+
+# Executa uma simulação e devolve o tempo de CPU, em décimos de milissegundo: as esperas pelo
+# fsync do diário dependem do disco, não do código.
+function(medir_simulacao programa saida)
+    execute_process(
+        COMMAND "${programa}" --simular-partidas ${LINHAS} 3
+        OUTPUT_QUIET
+        ERROR_VARIABLE resumo
+        RESULT_VARIABLE resultado
+    )
+    if(NOT resultado EQUAL 0 OR NOT resumo MATCHES "CPU: ([0-9]+)\\.([0-9]) ms")
+        message(FATAL_ERROR "Falha na simulação de partidas com ${programa}:\n${resumo}")
+    endif()
+    math(EXPR decimos "${CMAKE_MATCH_1} * 10 + ${CMAKE_MATCH_2}")
+    set(${saida} ${decimos} PARENT_SCOPE)
+endfunction()
+
+# Formata décimos de milissegundo como "123.4".
+function(formatar_decimos valor saida)
+    math(EXPR inteiro "${valor} / 10")
+    math(EXPR fracao "${valor} % 10")
+    set(${saida} "${inteiro}.${fracao}" PARENT_SCOPE)
+endfunction()
+
+# Mediana de uma lista de inteiros.
+function(mediana lista saida)
+    list(SORT lista COMPARE NATURAL)
+    list(LENGTH lista total)
+    math(EXPR meio "${total} / 2")
+    list(GET lista ${meio} valor)
+    set(${saida} ${valor} PARENT_SCOPE)
+endfunction()
+
+# Alterna os executáveis, para que variações da máquina afetem os dois por igual.
+set(temposReferencia "")
+set(temposPgo "")
+foreach(i RANGE 1 ${REPETICOES})
+    medir_simulacao("${PROGRAMA_REFERENCIA}" tempo)
+    list(APPEND temposReferencia ${tempo})
+    medir_simulacao("${PROGRAMA_PGO}" tempo)
+    list(APPEND temposPgo ${tempo})
+endforeach()
+
+mediana("${temposReferencia}" medianaReferencia)
+mediana("${temposPgo}" medianaPgo)
+list(SORT temposReferencia COMPARE NATURAL)
+list(SORT temposPgo COMPARE NATURAL)
+list(GET temposReferencia 0 minimoReferencia)
+list(GET temposPgo 0 minimoPgo)
+
+# Ganho em décimos de ponto percentual, sobre as medianas.
+math(EXPR ganho "(${medianaReferencia} - ${medianaPgo}) * 1000 / ${medianaReferencia}")
+if(ganho LESS 0)
+    math(EXPR ganhoAbsoluto "-(${ganho})")
+    formatar_decimos(${ganhoAbsoluto} textoGanho)
+    set(textoGanho "-${textoGanho}")
+else()
+    formatar_decimos(${ganho} textoGanho)
+endif()
+
+file(SIZE "${PROGRAMA_REFERENCIA}" tamanhoReferencia)
+file(SIZE "${PROGRAMA_PGO}" tamanhoPgo)
+
+foreach(variavel medianaReferencia medianaPgo minimoReferencia minimoPgo)
+    formatar_decimos(${${variavel}} ${variavel}Texto)
+endforeach()
+
+string(TIMESTAMP agora "%Y-%m-%d %H:%M:%S")
+file(WRITE "${RELATORIO}"
+"# Relatório do PGO\n"
+"\n"
+"Gerado em ${agora}. Carga: `--simular-partidas ${LINHAS} 3`, ${REPETICOES} execuções alternadas de cada build.\n"
+"\n"
+"| Build | Mediana de CPU(ms) | Mínimo de CPU(ms) | Tamanho(bytes) |\n"
+"|---|---:|---:|---:|\n"
+"| Release | ${medianaReferenciaTexto} | ${minimoReferenciaTexto} | ${tamanhoReferencia} |\n"
+"| Release + LTO + PGO | ${medianaPgoTexto} | ${minimoPgoTexto} | ${tamanhoPgo} |\n"
+"\n"
+"Ganho do PGO sobre a mediana: ${textoGanho}%.\n"
+"\n"
+"- Release: `${PROGRAMA_REFERENCIA}`\n"
+"- PGO: `${PROGRAMA_PGO}`\n"
+)
+
+file(READ "${RELATORIO}" conteudo)
+message(STATUS "Relatório gravado em ${RELATORIO}:\n\n${conteudo}")
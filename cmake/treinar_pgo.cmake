@@ -0,0 +1,39 @@
+# Treino do PGO: joga partidas simuladas com o Mestre instrumentado, cobrindo navegação, coleta de
+# pistas, buscas, listagens e acusações. Executado pelo alvo treinar_pgo(estágio DQ_PGO=GERAR).
+#
+# Variáveis: PROGRAMA(executável instrumentado), DIRETORIO(perfis), LINHAS(linhas de comando
+# simuladas) e LLVM_PROFDATA(apenas no Clang).
+
+# Perfis de treinos anteriores seriam somados ao novo.
+file(GLOB perfisAntigos "${DIRETORIO}/*.gcda" "${DIRETORIO}/*.profraw" "${DIRETORIO}/default.profdata")
+if(perfisAntigos)
+    file(REMOVE ${perfisAntigos})
+endif()
+
+# Duas sementes: partidas diferentes, mesma distribuição de comandos.
+foreach(semente 1 2)
+    execute_process(
+        COMMAND "${PROGRAMA}" --simular-partidas ${LINHAS} ${semente}
+        WORKING_DIRECTORY "${DIRETORIO}"
+        OUTPUT_QUIET
+        ERROR_VARIABLE resumo
+        RESULT_VARIABLE resultado
+    )
+    if(NOT resultado EQUAL 0)
+        message(FATAL_ERROR "Falha na simulação de partidas(semente ${semente}):\n${resumo}")
+    endif()
+    message(STATUS "Semente ${semente}:${resumo}")
+endforeach()
+
+if(LLVM_PROFDATA)
+    file(GLOB perfisBrutos "${DIRETORIO}/*.profraw")
+    execute_process(
+        COMMAND "${LLVM_PROFDATA}" merge "-output=${DIRETORIO}/default.profdata" ${perfisBrutos}
+        RESULT_VARIABLE resultado
+    )
+    if(NOT resultado EQUAL 0)
+        message(FATAL_ERROR "Falha ao combinar os perfis do Clang.")
+    endif()
+endif()
+
+message(STATUS "Perfil do PGO gravado em ${DIRETORIO}. Configure com DQ_PGO=USAR e recompile.")
@@ -0,0 +1,136 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "conjuntos_evidencias.h"
+
+// Desafio Detective Quest
+// Implementação dos conjuntos de evidências em bitsets.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem cria os conjuntos informa as falhas.
+
+// **** Funções dos Conjuntos de Evidências ****
+
+ConjuntosEvidencias* criarConjuntosEvidencias(int32_t totalPistas, int32_t totalSuspeitos)
+{
+	if (totalPistas < 1 || totalSuspeitos < 1)
+	{
+		return NULL;
+	}
+
+	ConjuntosEvidencias* conjuntos = (ConjuntosEvidencias*)malloc(sizeof(ConjuntosEvidencias));
+	if (conjuntos == NULL)
+	{
+		return NULL;
+	}
+
+	conjuntos->totalPistas = totalPistas;
+	conjuntos->totalSuspeitos = totalSuspeitos;
+	conjuntos->palavras = (totalPistas + 63) / 64;
+	conjuntos->coletadas = (uint64_t*)calloc((size_t)conjuntos->palavras, sizeof(uint64_t));
+	conjuntos->suspeitos = (uint64_t*)calloc((size_t)conjuntos->palavras * (size_t)totalSuspeitos, sizeof(uint64_t));
+	if (conjuntos->coletadas == NULL || conjuntos->suspeitos == NULL)
+	{
+		liberarConjuntosEvidencias(conjuntos);
+		return NULL;
+	}
+
+	return conjuntos;
+}
+
+void limparConjuntosEvidencias(ConjuntosEvidencias* conjuntos)
+{
+	if (conjuntos == NULL)
+	{
+		return;
+	}
+
+	memset(conjuntos->coletadas, 0, (size_t)conjuntos->palavras * sizeof(uint64_t));
+	memset(conjuntos->suspeitos, 0, (size_t)conjuntos->palavras * (size_t)conjuntos->totalSuspeitos * sizeof(uint64_t));
+}
+
+void associarPistaEvidencias(ConjuntosEvidencias* conjuntos, int32_t pista, int32_t suspeito)
+{
+	if (conjuntos == NULL || pista < 0 || pista >= conjuntos->totalPistas || suspeito < 0 || suspeito >= conjuntos->totalSuspeitos)
+	{
+		return;
+	}
+
+	conjuntos->suspeitos[(size_t)suspeito * (size_t)conjuntos->palavras + (size_t)(pista / 64)] |= 1ULL << (pista % 64);
+}
+
+bool marcarPistaColetadaEvidencias(ConjuntosEvidencias* conjuntos, int32_t pista)
+{
+	if (conjuntos == NULL || pista < 0 || pista >= conjuntos->totalPistas)
+	{
+		return false;
+	}
+
+	uint64_t bit = 1ULL << (pista % 64);
+	uint64_t* palavra = &conjuntos->coletadas[pista / 64];
+	bool nova = (*palavra & bit) == 0;
+	*palavra |= bit;
+	return nova;
+}
+
+void desmarcarPistaColetadaEvidencias(ConjuntosEvidencias* conjuntos, int32_t pista)
+{
+	if (conjuntos == NULL || pista < 0 || pista >= conjuntos->totalPistas)
+	{
+		return;
+	}
+
+	conjuntos->coletadas[pista / 64] &= ~(1ULL << (pista % 64));
+}
+
+int32_t contarPistasSuspeitoEvidencias(const ConjuntosEvidencias* conjuntos, int32_t suspeito)
+{
+	if (conjuntos == NULL || suspeito < 0 || suspeito >= conjuntos->totalSuspeitos)
+	{
+		return 0;
+	}
+
+	const uint64_t* coletadas = conjuntos->coletadas;
+	const uint64_t* pistasSuspeito = conjuntos->suspeitos + (size_t)suspeito * (size_t)conjuntos->palavras;
+	int32_t total = 0;
+	for (int32_t i = 0; i < conjuntos->palavras; i++)
+	{
+		total += contarBitsPalavra(coletadas[i] & pistasSuspeito[i]);
+	}
+
+	return total;
+}
+
+int32_t contarPistasSuspeitosEvidencias(const ConjuntosEvidencias* conjuntos, int32_t* contagens, int32_t minimo)
+{
+	if (conjuntos == NULL)
+	{
+		return 0;
+	}
+
+	// Uma única passada pela matriz de suspeitos, linha a linha: as palavras de coletadas ficam na cache.
+	const uint64_t* coletadas = conjuntos->coletadas;
+	const uint64_t* linha = conjuntos->suspeitos;
+	int32_t alcancaram = 0;
+	for (int32_t suspeito = 0; suspeito < conjuntos->totalSuspeitos; suspeito++, linha += conjuntos->palavras)
+	{
+		int32_t total = 0;
+		for (int32_t i = 0; i < conjuntos->palavras; i++)
+		{
+			total += contarBitsPalavra(coletadas[i] & linha[i]);
+		}
+
+		contagens[suspeito] = total;
+		alcancaram += total >= minimo;
+	}
+
+	return alcancaram;
+}
+
+void liberarConjuntosEvidencias(ConjuntosEvidencias* conjuntos)
+{
+	if (conjuntos == NULL)
+		return;
+
+	free(conjuntos->coletadas);
+	free(conjuntos->suspeitos);
+	free(conjuntos);
+}
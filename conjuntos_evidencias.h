@@ -0,0 +1,79 @@
+#ifndef CONJUNTOS_EVIDENCIAS_H
+#define CONJUNTOS_EVIDENCIAS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Desafio Detective Quest
+// Conjuntos de evidências em bitsets: as pistas coletadas de cada suspeito, contadas por popcount.
+// Usados pelo motor do jogo no lugar de um contador por suspeito: a coleta e o desfazer ligam e
+// desligam um bit, e a contagem de todos os suspeitos é uma única passada pela matriz.
+
+// **** Definições de estruturas. ****
+
+/// @brief Define os conjuntos de evidências em bitsets. Cada pista do catálogo tem um identificador denso;
+/// as pistas coletadas formam um bitset, e cada suspeito tem o bitset das pistas que o apontam.
+/// As pistas coletadas de um suspeito são popcount(coletadas AND suspeito), palavra a palavra.
+typedef struct
+{
+	uint64_t* coletadas; // Bit i ligado: pista i coletada.
+	uint64_t* suspeitos; // Uma linha de palavras por suspeito: bit i ligado, a pista i aponta o suspeito.
+	int32_t totalPistas;
+	int32_t totalSuspeitos;
+	int32_t palavras; // Palavras de 64 bits por conjunto.
+} ConjuntosEvidencias;
+
+// **** Funções dos Conjuntos de Evidências ****
+
+/// @brief Conta os bits ligados de uma palavra(popcount). Com suporte do processador(ex: -mpopcnt),
+/// o compilador usa uma única instrução.
+static inline int32_t contarBitsPalavra(uint64_t palavra)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (int32_t)__builtin_popcountll(palavra);
+#else
+	palavra -= (palavra >> 1) & 0x5555555555555555ULL;
+	palavra = (palavra & 0x3333333333333333ULL) + ((palavra >> 2) & 0x3333333333333333ULL);
+	palavra = (palavra + (palavra >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (int32_t)((palavra * 0x0101010101010101ULL) >> 56);
+#endif
+}
+/// @brief Efetua a criação dos conjuntos de evidências, vazios.
+/// @param Inteiro. Quantidade de pistas(identificadores de 0 a totalPistas - 1).
+/// @param Inteiro. Quantidade de suspeitos.
+/// @returns ConjuntosEvidencias. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+ConjuntosEvidencias* criarConjuntosEvidencias(int32_t totalPistas, int32_t totalSuspeitos);
+/// @brief Esvazia os conjuntos: nenhuma pista coletada e nenhuma associação(ex: no início de uma partida).
+/// @param ConjuntosEvidencias. Ponteiro via referência, para atribuição. Pode ser NULL.
+void limparConjuntosEvidencias(ConjuntosEvidencias* conjuntos);
+/// @brief Associa uma pista a um suspeito. Índices inválidos são ignorados.
+/// @param ConjuntosEvidencias. Ponteiro via referência, para atribuição.
+/// @param Inteiro. Identificador da pista.
+/// @param Inteiro. Índice do suspeito.
+void associarPistaEvidencias(ConjuntosEvidencias* conjuntos, int32_t pista, int32_t suspeito);
+/// @brief Marca uma pista como coletada. Índices inválidos são ignorados.
+/// @param ConjuntosEvidencias. Ponteiro via referência, para atribuição.
+/// @param Inteiro. Identificador da pista.
+/// @returns Bool. Verdadeiro(true) se a pista ainda não estava coletada. Caso contrário, falso(false).
+bool marcarPistaColetadaEvidencias(ConjuntosEvidencias* conjuntos, int32_t pista);
+/// @brief Desmarca uma pista coletada(ex: no desfazer). Índices inválidos são ignorados.
+/// @param ConjuntosEvidencias. Ponteiro via referência, para atribuição.
+/// @param Inteiro. Identificador da pista.
+void desmarcarPistaColetadaEvidencias(ConjuntosEvidencias* conjuntos, int32_t pista);
+/// @brief Conta as pistas coletadas que apontam um suspeito: popcount(coletadas AND suspeito).
+/// @param ConjuntosEvidencias. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice do suspeito.
+/// @returns Inteiro. Quantidade de pistas, ou zero para um índice inválido.
+int32_t contarPistasSuspeitoEvidencias(const ConjuntosEvidencias* conjuntos, int32_t suspeito);
+/// @brief Conta as pistas coletadas de todos os suspeitos, em uma única passada.
+/// @param ConjuntosEvidencias. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Vetor. Ponteiro para receber a contagem de cada suspeito, com capacidade para totalSuspeitos.
+/// @param Inteiro. Quantidade mínima de pistas para acusar um suspeito(ex: NUMERO_PISTAS_REQUERIDAS).
+/// @returns Inteiro. Quantidade de suspeitos com o mínimo de pistas.
+int32_t contarPistasSuspeitosEvidencias(const ConjuntosEvidencias* conjuntos, int32_t* contagens, int32_t minimo);
+/// @brief Libera a memória alocada para os conjuntos de evidências.
+/// @param ConjuntosEvidencias. Ponteiro via referência, usado na operação de liberação.
+void liberarConjuntosEvidencias(ConjuntosEvidencias* conjuntos);
+
+#endif
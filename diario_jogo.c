@@ -0,0 +1,427 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+// No windows, _commit, _chsize_s e _getpid; nos demais, fsync, ftruncate e getpid.
+#ifdef _WIN32
+#include <io.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "diario_jogo.h"
+
+// Desafio Detective Quest
+// Implementação do diário de jogo: gravação em grupos e repetição das sessões.
+
+// **** Funções do Diário de Jogo ****
+
+/// @brief Calcula a verificação(FNV-1a) de um registro do diário, sobre os campos anteriores a ela.
+static uint32_t verificacaoRegistroDiario(const RegistroDiario* registro)
+{
+	const unsigned char* bytes = (const unsigned char*)registro;
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < offsetof(RegistroDiario, verificacao); i++)
+	{
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+	return hash;
+}
+
+/// @brief Lê e confere o cabeçalho do diário, deixando o arquivo posicionado no primeiro registro.
+static bool lerCabecalhoDiario(FILE* arquivo)
+{
+	CabecalhoDiario cabecalho;
+	return fseek(arquivo, 0, SEEK_SET) == 0 &&
+		fread(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1 &&
+		memcmp(cabecalho.magica, MAGICA_DIARIO, sizeof(cabecalho.magica)) == 0 &&
+		cabecalho.versao == VERSAO_DIARIO &&
+		cabecalho.tamanhoRegistro == sizeof(RegistroDiario);
+}
+
+/// @brief Descarrega o arquivo e o sincroniza com o disco.
+static bool sincronizarArquivoDiario(FILE* arquivo)
+{
+	if (fflush(arquivo) != 0)
+	{
+		return false;
+	}
+#ifdef _WIN32
+	return _commit(_fileno(arquivo)) == 0;
+#else
+	return fsync(fileno(arquivo)) == 0;
+#endif
+}
+
+/// @brief Trunca o arquivo no tamanho informado, descartando um registro incompleto.
+static bool truncarArquivoDiario(FILE* arquivo, long tamanho)
+{
+	if (fflush(arquivo) != 0)
+	{
+		return false;
+	}
+#ifdef _WIN32
+	return _chsize_s(_fileno(arquivo), tamanho) == 0;
+#else
+	return ftruncate(fileno(arquivo), tamanho) == 0;
+#endif
+}
+
+/// @brief Sorteia o identificador base das sessões de um gravador: o instante, o processo e o endereço
+/// do gravador, misturados. Gravadores simultâneos no mesmo arquivo não repetem identificadores.
+static uint64_t sortearSessaoDiario(const DiarioJogo* diario)
+{
+	struct timespec agora = { 0 };
+	timespec_get(&agora, TIME_UTC);
+#ifdef _WIN32
+	uint64_t processo = (uint64_t)_getpid();
+#else
+	uint64_t processo = (uint64_t)getpid();
+#endif
+
+	uint64_t h = (uint64_t)agora.tv_sec * 1000000000ULL + (uint64_t)agora.tv_nsec;
+	h ^= (processo << 40) ^ (uint64_t)(uintptr_t)diario;
+
+	// Mistura final(SplitMix64): instantes e processos próximos não dão identificadores próximos.
+	h += 0x9E3779B97F4A7C15ULL;
+	h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+	return h ^ (h >> 31);
+}
+
+/// @brief Grava o cabeçalho do diário em um arquivo vazio, aberto para acréscimo.
+static bool gravarCabecalhoDiario(FILE* arquivo)
+{
+	CabecalhoDiario cabecalho;
+	memcpy(cabecalho.magica, MAGICA_DIARIO, sizeof(cabecalho.magica));
+	cabecalho.versao = VERSAO_DIARIO;
+	cabecalho.tamanhoRegistro = sizeof(RegistroDiario);
+
+	return fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1 && sincronizarArquivoDiario(arquivo);
+}
+
+bool abrirDiario(DiarioJogo* diario, const char* caminho, int registrosPorSincronizacao)
+{
+	diario->arquivo = NULL;
+	diario->totalPendentes = 0;
+	diario->registrosPorSincronizacao = registrosPorSincronizacao < 1 ? 1
+		: registrosPorSincronizacao > CAPACIDADE_BUFFER_DIARIO ? CAPACIDADE_BUFFER_DIARIO : registrosPorSincronizacao;
+	diario->sessao = 0;
+	diario->sequencia = 0;
+	diario->sala = 0;
+	diario->registrosGravados = 0;
+	diario->sincronizacoes = 0;
+
+	diario->sessao = sortearSessaoDiario(diario);
+
+	if (caminho == NULL)
+	{
+		return true; // Sem caminho, o diário fica desativado.
+	}
+
+	// Um arquivo novo é criado com exclusividade: entre gravadores simultâneos, apenas um grava o cabeçalho.
+	FILE* novo = fopen(caminho, "wbx");
+	if (novo != NULL)
+	{
+		bool gravado = gravarCabecalhoDiario(novo);
+		if (fclose(novo) != 0 || !gravado)
+		{
+			return false;
+		}
+	}
+
+	long tamanho = -1;
+	bool cabecalhoValido = false;
+	FILE* leitura = fopen(caminho, "rb");
+	if (leitura != NULL)
+	{
+		if (fseek(leitura, 0, SEEK_END) == 0)
+		{
+			tamanho = ftell(leitura);
+		}
+		cabecalhoValido = tamanho >= (long)sizeof(CabecalhoDiario) && lerCabecalhoDiario(leitura);
+		fclose(leitura);
+	}
+	if (tamanho < 0 || (tamanho >= (long)sizeof(CabecalhoDiario) && !cabecalhoValido))
+	{
+		return false; // Não é um diário, ou é de outra versão: não vamos tocar no arquivo.
+	}
+
+	// Os registros são apenas acrescentados(O_APPEND), sem buffer: cada grupo vira uma única escrita no fim
+	// do arquivo, e os grupos de gravadores simultâneos não se sobrepõem.
+	FILE* arquivo = fopen(caminho, "ab");
+	if (arquivo == NULL)
+	{
+		return false;
+	}
+	setvbuf(arquivo, NULL, _IONBF, 0);
+
+	if (tamanho < (long)sizeof(CabecalhoDiario))
+	{
+		// Cabeçalho incompleto, deixado por uma criação interrompida: o diário começa vazio.
+		if (!truncarArquivoDiario(arquivo, 0) || !gravarCabecalhoDiario(arquivo))
+		{
+			fclose(arquivo);
+			return false;
+		}
+		tamanho = sizeof(CabecalhoDiario);
+	}
+
+	long registros = (tamanho - (long)sizeof(CabecalhoDiario)) / (long)sizeof(RegistroDiario);
+	long fimValido = (long)sizeof(CabecalhoDiario) + registros * (long)sizeof(RegistroDiario);
+
+	if (fimValido != tamanho && !truncarArquivoDiario(arquivo, fimValido))
+	{
+		fclose(arquivo);
+		return false;
+	}
+
+	diario->arquivo = arquivo;
+	return true;
+}
+
+bool registrarEventoDiario(DiarioJogo* diario, EventoDiario tipo, int32_t sala, uint8_t direcao,
+	int32_t pista, int32_t suspeito, uint8_t resultado)
+{
+	if (diario->arquivo == NULL)
+	{
+		return true;
+	}
+
+	if (tipo == EventoDiario_INICIO)
+	{
+		// Zero é reservado à "última sessão" da repetição.
+		diario->sessao += diario->sessao == UINT64_MAX ? 2 : 1;
+		diario->sequencia = 0;
+	}
+	if (tipo == EventoDiario_INICIO || tipo == EventoDiario_MOVIMENTO || tipo == EventoDiario_DESFAZER)
+	{
+		diario->sala = sala;
+	}
+
+	RegistroDiario* registro = &diario->pendentes[diario->totalPendentes++];
+	registro->sessao = diario->sessao;
+	registro->sequencia = diario->sequencia++;
+	registro->sala = sala;
+	registro->pista = pista;
+	registro->suspeito = suspeito;
+	registro->tipo = (uint8_t)tipo;
+	registro->direcao = direcao;
+	registro->resultado = resultado;
+	registro->reservado = 0;
+	registro->verificacao = verificacaoRegistroDiario(registro);
+
+	return diario->totalPendentes < diario->registrosPorSincronizacao || sincronizarDiario(diario);
+}
+
+bool sincronizarDiario(DiarioJogo* diario)
+{
+	if (diario->arquivo == NULL)
+	{
+		return false;
+	}
+
+	size_t total = (size_t)diario->totalPendentes;
+	diario->totalPendentes = 0;
+
+	if (fwrite(diario->pendentes, sizeof(RegistroDiario), total, diario->arquivo) != total ||
+		!sincronizarArquivoDiario(diario->arquivo))
+	{
+		fclose(diario->arquivo);
+		diario->arquivo = NULL;
+		return false;
+	}
+
+	diario->registrosGravados += total;
+	diario->sincronizacoes++;
+	return true;
+}
+
+bool fecharDiario(DiarioJogo* diario)
+{
+	if (diario->arquivo == NULL)
+	{
+		return true;
+	}
+
+	if (!sincronizarDiario(diario))
+	{
+		return false; // A falha já fechou o arquivo.
+	}
+
+	bool fechado = fclose(diario->arquivo) == 0;
+	diario->arquivo = NULL;
+	return fechado;
+}
+
+bool aplicarEventoDiario(EstadoRepeticao* estado, const RegistroDiario* registro)
+{
+	if (registro->verificacao != verificacaoRegistroDiario(registro))
+	{
+		return false;
+	}
+
+	// Índices fora das tabelas do caso só aparecem em diários de outro caso.
+	bool salaValida = registro->sala >= 0 && registro->sala < estado->totalSalas;
+	bool suspeitoValido = registro->suspeito >= 0 && registro->suspeito < estado->totalSuspeitos;
+
+	switch ((EventoDiario)registro->tipo)
+	{
+	case EventoDiario_INICIO:
+		if (!suspeitoValido)
+		{
+			return false;
+		}
+		int32_t totalSalas = estado->totalSalas, totalSuspeitos = estado->totalSuspeitos;
+		memset(estado, 0, sizeof(*estado));
+		estado->totalSalas = totalSalas;
+		estado->totalSuspeitos = totalSuspeitos;
+		estado->sessao = registro->sessao;
+		estado->culpado = registro->suspeito;
+		estado->acusado = -1;
+		return true;
+
+	case EventoDiario_MOVIMENTO:
+		if (!salaValida)
+		{
+			return false;
+		}
+		// Como o jogo, guarda o estado anterior ao movimento; cheia, a pilha descarta o mais antigo.
+		if (estado->totalInstantaneos == CAPACIDADE_DESFAZER_DIARIO)
+		{
+			estado->inicioInstantaneos = (estado->inicioInstantaneos + 1) % CAPACIDADE_DESFAZER_DIARIO;
+			estado->totalInstantaneos--;
+		}
+		InstantaneoRepeticao* guardado =
+			&estado->instantaneos[(estado->inicioInstantaneos + estado->totalInstantaneos++) % CAPACIDADE_DESFAZER_DIARIO];
+		guardado->sala = estado->sala;
+		memcpy(guardado->pistasColetadas, estado->pistasColetadas, sizeof(guardado->pistasColetadas));
+		guardado->totalPistas = estado->totalPistas;
+		memcpy(guardado->pistasPorSuspeito, estado->pistasPorSuspeito, sizeof(guardado->pistasPorSuspeito));
+
+		estado->sala = registro->sala;
+		estado->movimentos++;
+		estado->retornos += registro->resultado != 0;
+		return true;
+
+	case EventoDiario_PISTA:
+		if (!salaValida || (registro->suspeito != -1 && !suspeitoValido))
+		{
+			return false;
+		}
+		uint8_t bit = (uint8_t)(1u << (registro->sala & 7));
+		if ((estado->pistasColetadas[registro->sala >> 3] & bit) == 0)
+		{
+			estado->pistasColetadas[registro->sala >> 3] |= bit;
+			estado->totalPistas++;
+			if (suspeitoValido)
+			{
+				estado->pistasPorSuspeito[registro->suspeito]++;
+			}
+		}
+		return true;
+
+	case EventoDiario_ACUSACAO:
+		if (!suspeitoValido)
+		{
+			return false;
+		}
+		estado->acusacoes++;
+		estado->acusado = registro->suspeito;
+		estado->resolvida = estado->resolvida || registro->resultado != 0;
+		return true;
+
+	case EventoDiario_FIM:
+		estado->encerrada = true;
+		estado->desfecho = registro->resultado;
+		return true;
+
+	case EventoDiario_DESFAZER:
+	{
+		if (estado->totalInstantaneos == 0)
+		{
+			return false;
+		}
+		const InstantaneoRepeticao* restaurado =
+			&estado->instantaneos[(estado->inicioInstantaneos + estado->totalInstantaneos - 1) % CAPACIDADE_DESFAZER_DIARIO];
+		if (restaurado->sala != registro->sala)
+		{
+			return false; // O diário diverge da pilha reconstruída.
+		}
+		estado->totalInstantaneos--;
+		estado->sala = restaurado->sala;
+		memcpy(estado->pistasColetadas, restaurado->pistasColetadas, sizeof(estado->pistasColetadas));
+		estado->totalPistas = restaurado->totalPistas;
+		memcpy(estado->pistasPorSuspeito, restaurado->pistasPorSuspeito, sizeof(estado->pistasPorSuspeito));
+		estado->desfeitos++;
+		return true;
+	}
+
+	default:
+		return false;
+	}
+}
+
+bool repetirDiario(FILE* arquivo, uint64_t sessao, int32_t totalSalas, int32_t totalSuspeitos,
+	EstadoRepeticao* estado, EstatisticasRepeticao* estatisticas)
+{
+	memset(estado, 0, sizeof(*estado));
+	estado->totalSalas = totalSalas < MAXIMO_SALAS_DIARIO ? totalSalas : MAXIMO_SALAS_DIARIO;
+	estado->totalSuspeitos = totalSuspeitos < MAXIMO_SUSPEITOS_DIARIO ? totalSuspeitos : MAXIMO_SUSPEITOS_DIARIO;
+	estado->culpado = -1;
+	estado->acusado = -1;
+	memset(estatisticas, 0, sizeof(*estatisticas));
+
+	if (!lerCabecalhoDiario(arquivo))
+	{
+		return false;
+	}
+
+	RegistroDiario* bloco = (RegistroDiario*)malloc(CAPACIDADE_BUFFER_DIARIO * sizeof(RegistroDiario));
+	if (bloco == NULL)
+	{
+		return false;
+	}
+
+	bool encontrada = false;
+	size_t lidos;
+	uint64_t atual = sessao;
+
+	// Sem sessão informada, cada início descarta o estado anterior: no fim, resta a última sessão.
+	// Os registros de outras sessões, intercalados por gravadores simultâneos, são ignorados.
+	while ((lidos = fread(bloco, sizeof(RegistroDiario), CAPACIDADE_BUFFER_DIARIO, arquivo)) > 0)
+	{
+		estatisticas->lidos += lidos;
+
+		for (size_t i = 0; i < lidos; i++)
+		{
+			const RegistroDiario* registro = &bloco[i];
+
+			if (sessao == 0 && registro->tipo == EventoDiario_INICIO &&
+				registro->verificacao == verificacaoRegistroDiario(registro))
+			{
+				atual = registro->sessao;
+			}
+			if (registro->sessao != atual)
+			{
+				continue;
+			}
+
+			if (!aplicarEventoDiario(estado, registro))
+			{
+				estatisticas->invalidos++;
+				continue;
+			}
+
+			estatisticas->eventos++;
+			if (registro->tipo == EventoDiario_INICIO)
+			{
+				estatisticas->sessoes++;
+				encontrada = true;
+			}
+		}
+	}
+
+	free(bloco);
+	return encontrada;
+}
@@ -0,0 +1,186 @@
+#ifndef DIARIO_JOGO_H
+#define DIARIO_JOGO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "motor_jogo.h"
+
+// Desafio Detective Quest
+// Diário de jogo: os eventos de cada sessão são gravados por acréscimo(O_APPEND) em um arquivo de registros
+// de tamanho fixo, em grupos com um único fsync, e a sessão pode ser reconstruída lendo o arquivo em blocos.
+// Cada grupo é uma única escrita e cada sessão tem um identificador sorteado, então vários processos podem
+// gravar no mesmo arquivo. Salas, pistas e suspeitos são índices das tabelas do caso de quem grava; o diário
+// não as conhece, e as falhas são devolvidas a quem grava, sem nada exibir.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a assinatura do cabeçalho do diário de jogo.
+#define MAGICA_DIARIO "DQDIARIO"
+/// @brief Define a versão do formato dos registros do diário de jogo.
+#define VERSAO_DIARIO 1
+/// @brief Define a capacidade, em registros, do buffer de gravação do diário.
+#define CAPACIDADE_BUFFER_DIARIO 4096
+/// @brief Define a quantidade máxima de salas de um caso reconstruído a partir do diário.
+#define MAXIMO_SALAS_DIARIO 256
+/// @brief Define a quantidade máxima de suspeitos de um caso reconstruído a partir do diário.
+#define MAXIMO_SUSPEITOS_DIARIO 64
+/// @brief Define a quantidade de estados guardados na repetição do desfazer. É a mesma do motor do jogo,
+/// que descarta o movimento mais antigo na mesma hora.
+#define CAPACIDADE_DESFAZER_DIARIO CAPACIDADE_DESFAZER_MOTOR
+
+// **** Definições de estruturas. ****
+
+/// @brief Define os tipos de evento do diário de jogo.
+typedef enum
+{
+	EventoDiario_INICIO = 1, // Nova sessão. suspeito: verdadeiro culpado.
+	EventoDiario_MOVIMENTO = 2, // sala: destino. resultado: 1 se voltou à entrada(sem saída).
+	EventoDiario_PISTA = 3, // sala: origem da pista coletada. pista/suspeito: associação do catálogo.
+	EventoDiario_ACUSACAO = 4, // suspeito: acusado. resultado: 1 se era o culpado.
+	EventoDiario_FIM = 5, // resultado: DesfechoSessao.
+	EventoDiario_DESFAZER = 6, // sala: a do estado restaurado, guardado antes do último movimento.
+} EventoDiario;
+
+/// @brief Define como uma sessão do jogo foi encerrada.
+typedef enum
+{
+	DesfechoSessao_SAIR = 0,
+	DesfechoSessao_JOGAR_NOVAMENTE = 1,
+} DesfechoSessao;
+
+/// @brief Define o cabeçalho do arquivo do diário de jogo.
+typedef struct
+{
+	char magica[8];
+	uint32_t versao;
+	uint32_t tamanhoRegistro;
+} CabecalhoDiario;
+
+/// @brief Define um registro(de tamanho fixo) do diário de jogo. Salas, pistas e suspeitos são
+/// índices das tabelas estáticas do caso; -1 indica ausência. Gravado na ordem de bytes do host.
+typedef struct
+{
+	uint64_t sessao;
+	uint32_t sequencia; // Ordem do evento dentro da sessão.
+	int32_t sala;
+	int32_t pista; // Índice no catálogo do caso.
+	int32_t suspeito; // Índice na lista de suspeitos do caso.
+	uint8_t tipo; // EventoDiario.
+	uint8_t direcao; // Direção do movimento, conforme quem grava.
+	uint8_t resultado;
+	uint8_t reservado;
+	uint32_t verificacao; // Hash dos campos anteriores, para detectar registros corrompidos.
+} RegistroDiario;
+
+_Static_assert(sizeof(CabecalhoDiario) == 16, "Cabeçalho do diário deve ter 16 bytes.");
+_Static_assert(sizeof(RegistroDiario) == 32, "Registro do diário deve ter 32 bytes.");
+
+/// @brief Define o gravador do diário de jogo: os registros são acumulados em memória e
+/// gravados(apenas por acréscimo) em grupos, com um único fsync por grupo.
+typedef struct
+{
+	FILE* arquivo; // NULL quando o diário está desativado.
+	RegistroDiario pendentes[CAPACIDADE_BUFFER_DIARIO];
+	int totalPendentes;
+	int registrosPorSincronizacao;
+	uint64_t sessao; // Sessão atual. Sorteada na abertura, e seguida a cada início.
+	uint32_t sequencia;
+	int32_t sala; // Sala atual da sessão, usada nos registros de pistas.
+	unsigned long long registrosGravados;
+	unsigned long long sincronizacoes;
+} DiarioJogo;
+
+/// @brief Define a parte da sessão reconstruída que o desfazer restaura, guardada antes de cada movimento.
+typedef struct
+{
+	int32_t sala;
+	uint8_t pistasColetadas[MAXIMO_SALAS_DIARIO / 8];
+	int32_t totalPistas;
+	int32_t pistasPorSuspeito[MAXIMO_SUSPEITOS_DIARIO];
+} InstantaneoRepeticao;
+
+/// @brief Define o estado de uma sessão, reconstruído a partir do diário.
+typedef struct
+{
+	int32_t totalSalas; // Do caso de quem grava: índices fora dele invalidam o registro.
+	int32_t totalSuspeitos;
+	uint64_t sessao;
+	int32_t culpado;
+	int32_t sala;
+	uint8_t pistasColetadas[MAXIMO_SALAS_DIARIO / 8]; // Bit por sala cuja pista foi coletada.
+	int32_t totalPistas;
+	int32_t pistasPorSuspeito[MAXIMO_SUSPEITOS_DIARIO];
+	int32_t movimentos;
+	int32_t retornos;
+	int32_t acusacoes;
+	int32_t acusado;
+	bool resolvida;
+	bool encerrada;
+	uint8_t desfecho;
+	int32_t desfeitos;
+	InstantaneoRepeticao instantaneos[CAPACIDADE_DESFAZER_DIARIO]; // Pilha circular, com a mesma capacidade da do jogo.
+	int32_t inicioInstantaneos;
+	int32_t totalInstantaneos;
+} EstadoRepeticao;
+
+/// @brief Define as contagens de uma repetição do diário.
+typedef struct
+{
+	unsigned long long eventos; // Registros aplicados ao estado.
+	unsigned long long lidos;
+	unsigned long long invalidos; // Registros com verificação ou índices inválidos.
+	unsigned long long sessoes;
+} EstatisticasRepeticao;
+
+// **** Funções do Diário de Jogo ****
+
+/// @brief Abre(ou cria) o diário para acréscimo. Um registro incompleto no fim do arquivo,
+/// deixado por uma gravação interrompida, é descartado.
+/// @param DiarioJogo. Ponteiro via referência, para atribuição.
+/// @param Texto. Caminho do arquivo, ou NULL para deixar o diário desativado.
+/// @param Inteiro. Quantidade de registros por grupo gravado com fsync(1 a CAPACIDADE_BUFFER_DIARIO).
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false) e o diário fica desativado.
+bool abrirDiario(DiarioJogo* diario, const char* caminho, int registrosPorSincronizacao);
+/// @brief Acrescenta um evento ao diário. Um evento de início abre uma nova sessão.
+/// Sem efeito se o diário estiver desativado.
+/// @param DiarioJogo. Ponteiro via referência, para atribuição.
+/// @param EventoDiario. Tipo do evento.
+/// @param Inteiro. Índice da sala, ou -1.
+/// @param Inteiro. Direção do movimento, conforme quem grava.
+/// @param Inteiro. Índice da pista no catálogo, ou -1.
+/// @param Inteiro. Índice do suspeito, ou -1.
+/// @param Inteiro. Resultado do evento, conforme o tipo.
+/// @returns Bool. Falso(false) se o grupo completado pelo evento não pôde ser gravado; o diário fica desativado.
+/// Caso contrário, verdadeiro(true).
+bool registrarEventoDiario(DiarioJogo* diario, EventoDiario tipo, int32_t sala, uint8_t direcao,
+	int32_t pista, int32_t suspeito, uint8_t resultado);
+/// @brief Grava os registros pendentes e sincroniza o arquivo com o disco(fsync).
+/// @param DiarioJogo. Ponteiro via referência, usado na gravação.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário(ou com o diário desativado), falso(false);
+/// depois de uma falha de gravação, o diário fica desativado.
+bool sincronizarDiario(DiarioJogo* diario);
+/// @brief Sincroniza e fecha o diário.
+/// @param DiarioJogo. Ponteiro via referência, usado na operação de liberação.
+/// @returns Bool. Verdadeiro(true) se os registros pendentes foram gravados, ou se o diário já estava desativado.
+/// Caso contrário, falso(false).
+bool fecharDiario(DiarioJogo* diario);
+/// @brief Aplica um registro do diário ao estado de uma sessão.
+/// @param EstadoRepeticao. Ponteiro via referência, para atribuição, com as dimensões do caso.
+/// @param RegistroDiario. Ponteiro do registro. Somente leitura.
+/// @returns Bool. Verdadeiro(true) se o registro é válido. Caso contrário, falso(false).
+bool aplicarEventoDiario(EstadoRepeticao* estado, const RegistroDiario* registro);
+/// @brief Reconstrói o estado de uma sessão a partir de um diário, lido em blocos.
+/// @param FILE. Arquivo do diário, posicionado no início.
+/// @param Inteiro. Sessão desejada, ou zero para a última sessão iniciada no diário.
+/// @param Inteiro. Quantidade de salas do caso(até MAXIMO_SALAS_DIARIO).
+/// @param Inteiro. Quantidade de suspeitos do caso(até MAXIMO_SUSPEITOS_DIARIO).
+/// @param EstadoRepeticao. Ponteiro via referência, para receber o estado.
+/// @param EstatisticasRepeticao. Ponteiro via referência, para receber as contagens.
+/// @returns Bool. Verdadeiro(true) se a sessão foi encontrada. Caso contrário, falso(false).
+bool repetirDiario(FILE* arquivo, uint64_t sessao, int32_t totalSalas, int32_t totalSuspeitos,
+	EstadoRepeticao* estado, EstatisticasRepeticao* estatisticas);
+
+#endif
@@ -0,0 +1,3429 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <threads.h>
+#include <signal.h>
+// Se estivermos no windows, vamos incluir usar uma saída de console com padrão adequado para utf-8.
+#ifdef _WIN32
+#include <Windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#endif
+
+#include "motor_jogo.h"
+#include "diario_jogo.h"
+#include "grafo_mansao.h"
+#include "histograma_latencia.h"
+#include "textos_compactos.h"
+#include "arvore_pistas.h"
+#include "filtro_bloom.h"
+#include "catalogo_pistas.h"
+#include "conjuntos_evidencias.h"
+#include "indice_sufixos.h"
+#include "mansao_colunar.h"
+#include "gerador_mansoes.h"
+#include "nos_indexados.h"
+#include "pontuacao_suspeitos.h"
+#include "armazem_salas.h"
+#include "catalogo_mapeado.h"
+#include "indice_salas.h"
+#include "avaliacao_acusacoes.h"
+#include "jogo_mestre.h"
+
+// Desafio Detective Quest
+// Ferramentas de diagnóstico do nível Mestre: as medições de desempenho das estruturas, as conferências do jogo
+// com partidas geradas e os utilitários(geração de mansões e repetição do diário), escolhidos na linha de comando.
+
+// **** Declarações das funções. ****
+
+// **** Funções do Catálogo Concorrente ****
+
+/// @brief Mede a vazão de leitura do catálogo de pistas com várias threads leitoras
+/// e uma thread editora fazendo alterações ocasionais.
+/// @param Inteiro. Número de threads leitoras.
+/// @param Inteiro. Duração da medição em milissegundos.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirCatalogoConcorrente(int numeroLeitores, int duracaoMs);
+
+// **** Funções do Índice de Sufixos ****
+
+/// @brief Confere o índice de sufixos: o vetor construído pelo SA-IS deve ser uma permutação das posições do
+/// texto em ordem lexicográfica, e as buscas por trecho e por prefixo devem encontrar as mesmas pistas que uma
+/// varredura ingênua(strstr e strncmp). Usa as pistas de um caso gerado e pistas repetitivas, de alfabeto
+/// pequeno, que exercitam a recursão do SA-IS.
+/// @param Inteiro. Quantidade de pistas de cada conjunto.
+/// @param Inteiro. Semente dos sorteios.
+/// @returns Inteiro. EXIT_SUCCESS, se o índice igualou a varredura em todas as buscas. Caso contrário, EXIT_FAILURE.
+int conferirIndiceSufixos(int32_t totalPistas, uint64_t semente);
+
+// **** Funções de Medição da Paginação de Pistas ****
+
+/// @brief Mede o tempo de paginação(select + listagem) sobre uma árvore de pistas sintéticas.
+/// @param Inteiro. Quantidade de pistas da árvore.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirPaginacaoPistas(int totalPistas);
+/// @brief Confere as consultas por posição da árvore de pistas(rank, select, páginas e intervalos) com
+/// um vetor ordenado pelas chaves de colação, sobre as pistas de um caso gerado, inseridas em ordem sorteada.
+/// @param Inteiro. Quantidade de pistas da árvore.
+/// @param Inteiro. Semente dos sorteios.
+/// @returns Inteiro. EXIT_SUCCESS, se a árvore igualou o vetor em todas as consultas. Caso contrário, EXIT_FAILURE.
+int conferirPosicoesPistas(int32_t totalPistas, uint64_t semente);
+
+// **** Funções da Colação de Pistas ****
+
+/// @brief Confere a colação pt-BR: uma lista de textos em ordem de dicionário(acentos e caixa só desempatam)
+/// deve sair em ordem pela comparação das chaves com memcmp e com compararChavesColacao, e pela árvore de pistas,
+/// com os textos inseridos em ordem sorteada.
+/// @param Inteiro. Semente dos sorteios.
+/// @returns Inteiro. EXIT_SUCCESS, se todas as ordens igualaram a lista. Caso contrário, EXIT_FAILURE.
+int conferirColacaoPistas(uint64_t semente);
+
+// **** Funções da Mansão Colunar ****
+
+/// @brief Mede as varreduras da mansão colunar e da mansão encadeada sobre uma mansão sintética.
+/// @param Inteiro. Quantidade de salas.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirMansaoColunar(int32_t totalSalas);
+
+// **** Funções dos Nós Indexados ****
+
+/// @brief Monta as salas, as pistas coletadas e o catálogo de um caso gerado nas duas representações
+/// (nós com ponteiros e nós indexados), confere se elas coincidem e exibe a memória de cada estrutura.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Quantidade de pistas coletadas(distintas).
+/// @param Inteiro. Quantidade de associações do catálogo.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int relatorioMemoriaNos(int32_t totalSalas, int32_t totalPistas, int32_t totalCatalogo);
+
+// **** Funções do Gerador de Mansões ****
+
+/// @brief Gera um caso conforme os argumentos da linha de comando e exibe as medições.
+/// @param Inteiro. Quantidade de argumentos, a partir da quantidade de salas.
+/// @param Vetor. Argumentos: salas, formato, semente, densidade, suspeitos, distribuição e threads.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int executarGeradorMansao(int argc, char* argv[]);
+
+// **** Funções da Pontuação de Suspeitos ****
+
+/// @brief Mede a atualização incremental da pontuação contra o recálculo completo a cada pista,
+/// e a aplicação de evidências em lote, conferindo a soma mantida incrementalmente.
+/// @param Inteiro. Quantidade de suspeitos.
+/// @param Inteiro. Quantidade de pistas.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirPontuacaoSuspeitos(int32_t totalSuspeitos, long long totalPistas);
+
+// **** Funções dos Conjuntos de Evidências ****
+
+/// @brief Mede a contagem das pistas coletadas de todos os suspeitos com a tabela hash e a árvore de pistas
+/// (varrendo o catálogo) e com os bitsets, conferindo se as contagens coincidem.
+/// @param Inteiro. Quantidade de pistas do catálogo.
+/// @param Inteiro. Quantidade de suspeitos.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirConjuntosEvidencias(int32_t totalPistas, int32_t totalSuspeitos);
+
+// **** Funções do Grafo da Mansão ****
+
+/// @brief Converte uma mansão colunar em grafo, com a esquerda e a direita como as saídas de cada sala.
+/// @param MansaoColunar. Ponteiro usado na conversão. Somente leitura.
+/// @returns MansaoGrafo. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+MansaoGrafo* converterColunarGrafo(const MansaoColunar* mansao);
+/// @brief Mede a construção e o percurso em largura de um grafo da mansão sintético(uma mansão gerada
+/// mais portas sorteadas), comparando com listas de adjacência encadeadas.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Quantidade de portas extras por sala.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirMansaoGrafo(int32_t totalSalas, int32_t portasPorSala);
+/// @brief Mede o cálculo das distâncias sobre um grafo da mansão sintético: apenas de cima para baixo,
+/// com a troca de direção em uma thread e com a troca de direção em várias threads, conferindo as distâncias.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Quantidade de portas extras por sala.
+/// @param Inteiro. Quantidade de threads.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirDistanciasGrafo(int32_t totalSalas, int32_t portasPorSala, int totalThreads);
+
+// **** Funções do Armazém de Salas Paginado ****
+
+/// @brief Mede o armazém paginado em partidas simuladas(descidas da raiz até uma folha) sobre uma mansão
+/// gerada e gravada em disco, comparando com a leitura de todas as salas antes da partida.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Capacidade do cache, em páginas.
+/// @param Inteiro. Quantidade de partidas.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirArmazemSalas(int32_t totalSalas, int32_t capacidadePaginas, int32_t partidas);
+
+// **** Funções do Catálogo Mapeado ****
+
+/// @brief Mede a carga de um catálogo gerado e gravado em disco, lido por inteiro e copiado para o heap
+/// de textos, ou mapeado e referenciado sem cópias, na tabela hash e na árvore de pistas.
+/// @param Inteiro. Quantidade de pistas.
+/// @param Inteiro. Quantidade de suspeitos.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirCatalogoMapeado(int32_t totalPistas, int32_t totalSuspeitos);
+
+// **** Funções do Hash Perfeito ****
+
+/// @brief Mede a construção, o tamanho e as consultas do hash perfeito sobre um catálogo gerado,
+/// comparando com as listas encadeadas da tabela hash, e confere que as chaves fora do catálogo são rejeitadas.
+/// @param Inteiro. Quantidade de pistas.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirHashPerfeito(int32_t totalPistas);
+
+// **** Funções do Motor do Jogo ****
+
+/// @brief Joga partidas automáticas no motor do jogo, sem interface(coleta, movimento aleatório e
+/// acusação assim que liberada), medindo o tempo por comando.
+/// @param Inteiro. Quantidade de partidas.
+/// @param Inteiro. Semente das partidas.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirMotorJogo(int32_t partidas, uint64_t semente);
+
+// **** Funções do Índice de Salas por Nome ****
+
+/// @brief Mede a montagem, as buscas por nome e a complementação do índice sobre uma mansão gerada,
+/// comparando com a varredura das salas.
+/// @param Inteiro. Quantidade de salas.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirIndiceSalas(int32_t totalSalas);
+
+// **** Funções das Versões da Árvore de Pistas ****
+
+/// @brief Mede as ramificações da árvore persistente de pistas: cada versão é um instantâneo da base mais
+/// uma pista, e compartilha com ela os nós fora do caminho da inserção(conferido pelos nós alocados).
+/// Compara com a cópia completa da árvore.
+/// @param Inteiro. Quantidade de pistas da árvore base.
+/// @param Inteiro. Quantidade de versões ramificadas da base.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirVersoesPistas(int32_t totalPistas, int32_t totalVersoes);
+
+// **** Funções da Avaliação Paralela das Acusações ****
+
+/// @brief Mede a avaliação das acusações sobre uma mansão gerada, com uma thread e com várias,
+/// conferindo as duas tabelas entre si e uma amostra das salas com a contagem pelo caminho.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Quantidade de suspeitos.
+/// @param Inteiro. Quantidade de threads. Zero para um thread por processador.
+/// @param Inteiro. Pistas requeridas para a acusação.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirAcusacoes(int32_t totalSalas, int32_t totalSuspeitos, int totalThreads, int32_t pistasRequeridas);
+
+// **** Funções dos Histogramas de Latência ****
+
+/// @brief Mede o custo do registro de uma latência e confere os percentis do histograma com os exatos.
+/// @param Inteiro. Quantidade de latências sintéticas.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirHistogramaLatencia(int32_t totalAmostras);
+
+// **** Funções do Diário de Jogo ****
+
+/// @brief Exibe o estado reconstruído de uma sessão.
+/// @param EstadoRepeticao. Ponteiro usado na recuperação de informações. Somente leitura.
+void exibirEstadoRepeticao(const EstadoRepeticao* estado);
+/// @brief Repete um diário de jogo, conforme os argumentos da linha de comando, e exibe o estado e a vazão.
+/// @param Inteiro. Quantidade de argumentos, a partir do arquivo.
+/// @param Vetor. Argumentos: arquivo e sessão.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int executarRepeticaoDiario(int argc, char* argv[]);
+/// @brief Mede a gravação em grupo e a repetição de um diário sintético, com partidas aleatórias.
+/// @param Inteiro. Quantidade de eventos.
+/// @param Inteiro. Quantidade de registros por grupo gravado com fsync.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int medirDiario(long long totalEventos, int registrosPorSincronizacao);
+
+// **** Funções da Simulação de Partidas ****
+
+/// @brief Confere os lotes de comandos diante das perguntas s/n: joga partidas automáticas só com lotes de
+/// movimentos sorteados(ex: "eedde") e respostas "s", e verifica que os movimentos que restavam no lote quando
+/// uma acusação foi liberada continuam executados, em vez de consumidos como resposta.
+/// A saída do jogo segue em stdout; o resultado é exibido em stderr.
+/// @param Inteiro. Quantidade de linhas de comando simuladas.
+/// @param Inteiro. Semente dos sorteios.
+/// @returns Inteiro. EXIT_SUCCESS, se todos os movimentos foram executados. Caso contrário, EXIT_FAILURE.
+int conferirLotesComandos(long long totalLinhas, uint64_t semente);
+/// @brief Confere a repetição do diário diante do desfazer: joga partidas automáticas com movimentos,
+/// saídas e desfazer sorteados e, antes de cada linha de comandos, reconstrói a sessão pelo diário e a
+/// compara com a partida em andamento(sala atual e pistas coletadas de cada suspeito).
+/// A saída do jogo segue em stdout; o resultado é exibido em stderr.
+/// @param Inteiro. Quantidade de linhas de comando simuladas.
+/// @param Inteiro. Semente dos sorteios.
+/// @returns Inteiro. EXIT_SUCCESS, se a repetição igualou o jogo em todas as linhas. Caso contrário, EXIT_FAILURE.
+int conferirDesfazerDiario(long long totalLinhas, uint64_t semente);
+
+// **** Funções de Ferramentas por Linha de Comando ****
+
+/// @brief Executa uma ferramenta de diagnóstico, conforme os argumentos da linha de comando.
+/// @param Inteiro. Quantidade de argumentos.
+/// @param Vetor. Argumentos recebidos pelo programa.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int executarFerramenta(int argc, char* argv[]);
+
+/// @brief Ponto de entrada das ferramentas de diagnóstico.
+/// @param Inteiro. Quantidade de argumentos.
+/// @param Vetor. Argumentos recebidos: a ferramenta e os seus parâmetros.
+/// @returns Inteiro. Zero, em caso de sucesso. Ex: EXIT_SUCCESS. 
+/// Ou diferente de Zero, em caso de falha. Ex: EXIT_FAILURE.
+int main(int argc, char* argv[]) {
+
+#ifdef _WIN32
+	// Plataforma Windows.
+	SetConsoleOutputCP(CP_UTF8);
+#endif
+	// Inicializa o gerador de números aleatórios.
+	srand((unsigned int)time(NULL));
+
+	// Como no jogo: as conferências executam o jogo, que descarrega a saída antes de cada leitura.
+	setvbuf(stdout, NULL, _IOFBF, TAMANHO_BUFFER_SAIDA);
+
+	return executarFerramenta(argc, argv);
+}
+
+// **** Implementação das funções. ****
+
+// **** Funções do Catálogo Concorrente ****
+
+/// @brief Define os parâmetros de uma thread leitora na medição do catálogo concorrente.
+typedef struct
+{
+	TabelaHash* tabela;
+	const char** chaves;
+	int totalChaves;
+	atomic_bool* parar;
+	unsigned long long consultas;
+	unsigned long long encontradas;
+} ParametrosLeitorCatalogo;
+
+/// @brief Define os parâmetros da thread editora na medição do catálogo concorrente.
+typedef struct
+{
+	TabelaHash* tabela;
+	const char** chaves;
+	int totalChaves;
+	atomic_bool* parar;
+	unsigned long long edicoes;
+} ParametrosEditorCatalogo;
+
+/// @brief Recupera o instante atual em segundos, para as medições de desempenho.
+/// @returns Real. Valor em segundos.
+static double instanteAtual()
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/// @brief Laço de uma thread leitora na medição do catálogo concorrente.
+/// @param Parâmetros. Ponteiro para ParametrosLeitorCatalogo.
+/// @returns Inteiro. Zero.
+static int executarLeitorCatalogo(void* argumento)
+{
+	ParametrosLeitorCatalogo* parametros = (ParametrosLeitorCatalogo*)argumento;
+	int leitor = registrarLeitorCatalogo(parametros->tabela);
+	if (leitor < 0)
+	{
+		return 0;
+	}
+
+	unsigned long long consultas = 0, encontradas = 0;
+	int indice = 0;
+
+	while (!atomic_load_explicit(parametros->parar, memory_order_relaxed))
+	{
+		entrarLeituraCatalogo(parametros->tabela, leitor);
+		const NoHash* no = buscarNoHash(parametros->chaves[indice], parametros->tabela, NULL);
+		if (no != NULL && lerTextoCompacto(&no->suspeito)[0] != '\0')
+		{
+			encontradas++;
+		}
+		sairLeituraCatalogo(parametros->tabela, leitor);
+
+		consultas++;
+		if (++indice == parametros->totalChaves)
+		{
+			indice = 0;
+		}
+	}
+
+	desregistrarLeitorCatalogo(parametros->tabela, leitor);
+
+	parametros->consultas = consultas;
+	parametros->encontradas = encontradas;
+	return 0;
+}
+
+/// @brief Laço da thread editora: remove e reinsere uma pista por milissegundo, e volta a indexar o catálogo.
+/// @param Parâmetros. Ponteiro para ParametrosEditorCatalogo.
+/// @returns Inteiro. Zero.
+static int executarEditorCatalogo(void* argumento)
+{
+	ParametrosEditorCatalogo* parametros = (ParametrosEditorCatalogo*)argumento;
+	struct timespec pausa = { 0, 1000000 };
+	int indice = 0;
+
+	while (!atomic_load_explicit(parametros->parar, memory_order_relaxed))
+	{
+		const char* pista = parametros->chaves[indice];
+		if (removerNoHash(pista, parametros->tabela))
+		{
+			inserirNoHash(pista, "Editor", parametros->tabela);
+			indexarTabelaHashPerfeita(parametros->tabela);
+			parametros->edicoes++;
+		}
+
+		indice = (indice + 1) % parametros->totalChaves;
+		thrd_sleep(&pausa, NULL);
+	}
+
+	return 0;
+}
+
+int medirCatalogoConcorrente(int numeroLeitores, int duracaoMs)
+{
+	if (numeroLeitores < 1 || numeroLeitores > MAXIMO_LEITORES_CATALOGO - 1)
+	{
+		printf("\n  ❌  Número de leitores deve estar entre 1 e %d.\n", MAXIMO_LEITORES_CATALOGO - 1);
+		return EXIT_FAILURE;
+	}
+
+	// O próprio catálogo do jogo, com o filtro e o índice perfeito, é compartilhado entre as threads.
+	TabelaHash* tabela = CriarTabelaHash(SUSPEITOS_CASO);
+	if (tabela == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+
+	// Metade das consultas acerta o catálogo e metade erra, como nas buscas de pistas durante o jogo.
+	const char* chaves[] = {
+		"Há uma cápsula de projétil no chão.", "Pegadas de lama no tapete.",
+		"Têm um vaso quebrado com um punhal dentro.", "Um bilhete rasgado.",
+		"Há um colar despedaçado.", "Uma luva esquecida.",
+		"Têm uma mancha de sangue.", "O relógio parou às três.",
+		"A janela está quebrada.", "Cheiro de pólvora.",
+		"O café ainda está quente no copo.", "Uma chave sem dono.",
+	};
+	int totalChaves = (int)(sizeof(chaves) / sizeof(chaves[0]));
+
+	ParametrosLeitorCatalogo* parametros = (ParametrosLeitorCatalogo*)calloc((size_t)numeroLeitores, sizeof(ParametrosLeitorCatalogo));
+	thrd_t* threads = (thrd_t*)calloc((size_t)numeroLeitores, sizeof(thrd_t));
+	if (parametros == NULL || threads == NULL)
+	{
+		free(parametros);
+		free(threads);
+		liberarTabelaHash(tabela);
+		printf("\n  ❌  Erro ao alocar memória para as threads leitoras.\n");
+		return EXIT_FAILURE;
+	}
+
+	atomic_bool parar;
+	atomic_init(&parar, false);
+
+	ParametrosEditorCatalogo editor = { tabela, chaves, totalChaves, &parar, 0 };
+	thrd_t threadEditor;
+
+	double inicio = instanteAtual();
+
+	int criadas = 0;
+	for (; criadas < numeroLeitores; criadas++)
+	{
+		parametros[criadas] = (ParametrosLeitorCatalogo){ tabela, chaves, totalChaves, &parar, 0, 0 };
+		if (thrd_create(&threads[criadas], executarLeitorCatalogo, &parametros[criadas]) != thrd_success)
+		{
+			break;
+		}
+	}
+	bool editorCriado = thrd_create(&threadEditor, executarEditorCatalogo, &editor) == thrd_success;
+
+	struct timespec duracao = { duracaoMs / 1000, (long)(duracaoMs % 1000) * 1000000L };
+	thrd_sleep(&duracao, NULL);
+	atomic_store(&parar, true);
+
+	for (int i = 0; i < criadas; i++)
+	{
+		thrd_join(threads[i], NULL);
+	}
+	if (editorCriado)
+	{
+		thrd_join(threadEditor, NULL);
+	}
+
+	double decorrido = instanteAtual() - inicio;
+
+	unsigned long long totalConsultas = 0, totalEncontradas = 0;
+	for (int i = 0; i < criadas; i++)
+	{
+		totalConsultas += parametros[i].consultas;
+		totalEncontradas += parametros[i].encontradas;
+	}
+
+	printf("\n===== Catálogo concorrente: %d leitor(es), %.2f s =====\n", criadas, decorrido);
+	printf(" • Consultas: %llu (%llu encontradas)\n", totalConsultas, totalEncontradas);
+	printf(" • Vazão total: %.2f milhões de consultas/s\n", (double)totalConsultas / decorrido / 1e6);
+	printf(" • Vazão por leitor: %.2f milhões de consultas/s\n",
+		criadas > 0 ? (double)totalConsultas / decorrido / 1e6 / criadas : 0.0);
+	printf(" • Edições publicadas: %llu\n", editor.edicoes);
+
+	free(parametros);
+	free(threads);
+	liberarTabelaHash(tabela);
+
+	return criadas == numeroLeitores ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Índice de Sufixos ****
+
+/// @brief Confere o vetor de sufixos e as buscas de um índice sobre uma lista de pistas.
+/// @returns Inteiro. Quantidade de divergências, ou -1 se o índice não pôde ser construído.
+static long long conferirBuscasIndice(const char** pistas, int32_t totalPistas, uint64_t semente, uint64_t fluxo, int totalBuscas)
+{
+	IndiceSufixos* indice = criarIndiceSufixos(pistas, totalPistas);
+	int* resultados = (int*)malloc(sizeof(int) * (size_t)totalPistas);
+	bool* marcadas = (bool*)calloc((size_t)(indice != NULL ? indice->tamanho : 1), sizeof(bool));
+	if (indice == NULL || resultados == NULL || marcadas == NULL)
+	{
+		liberarIndiceSufixos(indice);
+		free(resultados);
+		free(marcadas);
+		return -1;
+	}
+
+	// O vetor de sufixos é uma permutação das posições, em ordem estritamente crescente dos sufixos.
+	// O texto só termina no fim, e strcmp compara os bytes sem sinal: é a ordem do índice.
+	long long divergencias = 0;
+	for (int32_t i = 0; i < indice->tamanho; i++)
+	{
+		int32_t posicao = indice->sufixos[i];
+		if (posicao < 0 || posicao >= indice->tamanho || marcadas[posicao])
+		{
+			divergencias++;
+			continue;
+		}
+		marcadas[posicao] = true;
+		if (i > 0 && indice->sufixos[i - 1] >= 0 && indice->sufixos[i - 1] < indice->tamanho &&
+			strcmp((const char*)indice->texto + indice->sufixos[i - 1], (const char*)indice->texto + posicao) >= 0)
+		{
+			divergencias++;
+		}
+	}
+
+	// Trechos e prefixos tirados de pistas sorteadas; um em cada quatro tem o último byte trocado,
+	// e costuma não existir. A resposta do índice é comparada, como conjunto, com a varredura.
+	char trecho[16];
+	for (int b = 0; b < totalBuscas; b++)
+	{
+		uint64_t sorteio = sortearGeracao(semente, fluxo, (uint64_t)b);
+		const char* origem = pistas[reduzirSorteio(sorteio, (uint32_t)totalPistas)];
+		size_t comprimento = strlen(origem);
+		bool apenasPrefixo = (sorteio & 1) != 0;
+		size_t inicio = apenasPrefixo || comprimento == 0 ? 0 : (size_t)((sorteio >> 8) % comprimento);
+		size_t tamanho = 1 + (size_t)((sorteio >> 4) % 8);
+		if (tamanho > comprimento - inicio)
+		{
+			tamanho = comprimento - inicio;
+		}
+		if (tamanho == 0)
+		{
+			continue;
+		}
+		memcpy(trecho, origem + inicio, tamanho);
+		trecho[tamanho] = '\0';
+		if (((sorteio >> 2) & 3) == 0)
+		{
+			trecho[tamanho - 1] = (char)('0' + (sorteio >> 40) % 75);
+		}
+
+		int total = buscarTrechoIndice(indice, trecho, apenasPrefixo, resultados, totalPistas);
+		memset(marcadas, 0, sizeof(bool) * (size_t)totalPistas);
+		for (int i = 0; i < total; i++)
+		{
+			marcadas[resultados[i]] = true;
+		}
+
+		int esperado = 0;
+		for (int32_t p = 0; p < totalPistas; p++)
+		{
+			bool contem = apenasPrefixo ? strncmp(pistas[p], trecho, tamanho) == 0 : strstr(pistas[p], trecho) != NULL;
+			esperado += contem;
+			divergencias += contem != marcadas[p];
+		}
+		divergencias += total != esperado;
+	}
+
+	liberarIndiceSufixos(indice);
+	free(resultados);
+	free(marcadas);
+	return divergencias;
+}
+
+int conferirIndiceSufixos(int32_t totalPistas, uint64_t semente)
+{
+	const int totalBuscas = 500;
+	const int tamanhoRepetitivas = 40;
+
+	if (totalPistas < 1 || totalPistas > MAXIMO_PISTAS_DISTINTAS)
+	{
+		printf("\n  ❌  Quantidade de pistas inválida(de 1 a %d).\n", MAXIMO_PISTAS_DISTINTAS);
+		return EXIT_FAILURE;
+	}
+
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, 1024, semente);
+	parametros.totalPistasDistintas = totalPistas;
+	CasoGerado* caso = gerarCaso(&parametros);
+	const char** repetitivas = (const char**)malloc(sizeof(const char*) * (size_t)totalPistas);
+	char* textosRepetitivos = (char*)malloc((size_t)totalPistas * (tamanhoRepetitivas + 1));
+	if (caso == NULL || repetitivas == NULL || textosRepetitivos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a conferência.\n");
+		liberarCasoGerado(caso);
+		free(repetitivas);
+		free(textosRepetitivos);
+		return EXIT_FAILURE;
+	}
+
+	// Pistas de "a" e "b" com repetições longas: muitas substrings LMS iguais, resolvidas na recursão.
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		uint64_t sorteio = sortearGeracao(semente, 5, (uint64_t)i);
+		char* texto = textosRepetitivos + (size_t)i * (tamanhoRepetitivas + 1);
+		int comprimento = 1 + (int)(sorteio % tamanhoRepetitivas);
+		int periodo = 1 + (int)((sorteio >> 8) % 3);
+		for (int j = 0; j < comprimento; j++)
+		{
+			texto[j] = (sorteio >> (16 + j % periodo)) & 1 ? 'a' : 'b';
+		}
+		texto[comprimento] = '\0';
+		repetitivas[i] = texto;
+	}
+
+	double inicio = instanteAtual();
+	long long divergenciasCaso = conferirBuscasIndice(caso->mansao->textos + caso->primeiraPista, totalPistas, semente, 6, totalBuscas);
+	long long divergenciasRepetitivas = conferirBuscasIndice(repetitivas, totalPistas, semente, 7, totalBuscas);
+	double decorrido = instanteAtual() - inicio;
+	bool conferido = divergenciasCaso == 0 && divergenciasRepetitivas == 0;
+
+	printf("\n===== Conferência do índice de sufixos: %d pistas por conjunto, %d buscas cada =====\n", totalPistas, totalBuscas);
+	printf(" • Divergências(pistas do caso): %lld\n", divergenciasCaso);
+	printf(" • Divergências(pistas repetitivas): %lld\n", divergenciasRepetitivas);
+	printf(" • Tempo: %.2f s\n", decorrido);
+	printf(" • Conferência do índice: %s\n", conferido ? "ok" : "FALHOU");
+	if (divergenciasCaso < 0 || divergenciasRepetitivas < 0)
+	{
+		printf("\n  ❌  Erro ao construir o índice de sufixos.\n");
+	}
+
+	liberarCasoGerado(caso);
+	free(repetitivas);
+	free(textosRepetitivos);
+	return conferido ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções de Medição da Paginação de Pistas ****
+
+int medirPaginacaoPistas(int totalPistas)
+{
+	if (totalPistas < 1)
+	{
+		printf("\n  ❌  Quantidade de pistas inválida.\n");
+		return EXIT_FAILURE;
+	}
+
+	char texto[TAMANHO_MAX_PISTA];
+	Pista* raiz = NULL;
+	HeapTextos* textos = criarHeapTextos();
+	if (textos == NULL)
+	{
+		return EXIT_FAILURE;
+	}
+
+	double inicio = instanteAtual();
+	for (int i = 0; i < totalPistas; i++)
+	{
+		// Inserção em ordem crescente: o pior caso de uma BST sem balanceamento.
+		snprintf(texto, sizeof(texto), "Pista %09d", i);
+		raiz = inserirPista(textos, raiz, texto);
+	}
+	double construcao = instanteAtual() - inicio;
+
+	const int totalPaginas = 10000;
+	const int tamanhoPagina = 50;
+	const Pista** pagina = (const Pista**)malloc(sizeof(const Pista*) * (size_t)tamanhoPagina);
+	if (pagina == NULL)
+	{
+		liberarPista(raiz);
+		liberarHeapTextos(textos);
+		return EXIT_FAILURE;
+	}
+
+	unsigned long long verificacao = 0;
+	inicio = instanteAtual();
+	for (int i = 0; i < totalPaginas; i++)
+	{
+		int posicao = (int)(((unsigned long long)i * 2654435761ULL) % (unsigned long long)totalPistas);
+		int total = listarPistasPorPosicao(raiz, posicao, tamanhoPagina, pagina);
+		verificacao += (unsigned long long)total;
+	}
+	double paginacao = instanteAtual() - inicio;
+
+	inicio = instanteAtual();
+	for (int i = 0; i < totalPaginas; i++)
+	{
+		snprintf(texto, sizeof(texto), "Pista %09d", (int)(((unsigned long long)i * 40503ULL) % (unsigned long long)totalPistas));
+		verificacao += (unsigned long long)posicaoPista(raiz, texto);
+	}
+	double ranks = instanteAtual() - inicio;
+
+	printf("\n===== Paginação de pistas: %d pistas, altura %d =====\n", totalPistas, raiz->altura);
+	printf(" • Construção: %.3f s\n", construcao);
+	printf(" • Página de %d pistas: %.2f µs em média\n", tamanhoPagina, paginacao / totalPaginas * 1e6);
+	printf(" • Rank de uma pista: %.2f µs em média\n", ranks / totalPaginas * 1e6);
+	printf(" • Verificação: %llu\n", verificacao);
+
+	free(pagina);
+	liberarPista(raiz);
+	liberarHeapTextos(textos);
+	return EXIT_SUCCESS;
+}
+
+/// @brief Define uma pista da referência da conferência das posições: o texto e a sua chave de colação.
+typedef struct
+{
+	const char* texto;
+	unsigned char chave[TAMANHO_MAX_CHAVE_COLACAO];
+	size_t tamanhoChave;
+} ReferenciaPosicao;
+
+/// @brief Compara duas pistas da referência pelas chaves de colação, com memcmp(qsort e bsearch).
+static int compararReferenciasPosicao(const void* a, const void* b)
+{
+	const ReferenciaPosicao* x = (const ReferenciaPosicao*)a;
+	const ReferenciaPosicao* y = (const ReferenciaPosicao*)b;
+	int comparacao = memcmp(x->chave, y->chave, x->tamanhoChave < y->tamanhoChave ? x->tamanhoChave : y->tamanhoChave);
+	if (comparacao != 0)
+	{
+		return comparacao;
+	}
+
+	return x->tamanhoChave == y->tamanhoChave ? 0 : (x->tamanhoChave < y->tamanhoChave ? -1 : 1);
+}
+
+/// @brief Confere uma lista de pistas da árvore com um trecho da referência, na mesma ordem.
+static bool conferirListaPosicoes(const Pista* const* lista, int total, const ReferenciaPosicao* referencia, int esperado)
+{
+	if (total != esperado)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < total; i++)
+	{
+		if (strcmp(lista[i]->pista, referencia[i].texto) != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int conferirPosicoesPistas(int32_t totalPistas, uint64_t semente)
+{
+	const int totalConsultas = 2000;
+
+	if (totalPistas < 2 || totalPistas > MAXIMO_PISTAS_DISTINTAS)
+	{
+		printf("\n  ❌  Quantidade de pistas inválida(de 2 a %d).\n", MAXIMO_PISTAS_DISTINTAS);
+		return EXIT_FAILURE;
+	}
+
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, 1024, semente);
+	parametros.totalPistasDistintas = totalPistas;
+	CasoGerado* caso = gerarCaso(&parametros);
+	ReferenciaPosicao* referencia = (ReferenciaPosicao*)malloc(sizeof(ReferenciaPosicao) * (size_t)totalPistas);
+	const Pista** lista = (const Pista**)malloc(sizeof(const Pista*) * (size_t)totalPistas);
+	HeapTextos* textos = criarHeapTextos();
+	if (caso == NULL || referencia == NULL || lista == NULL || textos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a conferência.\n");
+		liberarCasoGerado(caso);
+		free(referencia);
+		free(lista);
+		liberarHeapTextos(textos);
+		return EXIT_FAILURE;
+	}
+	const char* const* pistas = caso->mansao->textos + caso->primeiraPista;
+
+	// A referência é o vetor das pistas embaralhado(Fisher-Yates): a árvore recebe as pistas nessa ordem,
+	// e o vetor é ordenado à parte, pelas mesmas chaves de colação.
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		referencia[i].texto = pistas[i];
+		referencia[i].tamanhoChave = montarChaveColacao(pistas[i], referencia[i].chave, TAMANHO_MAX_CHAVE_COLACAO);
+	}
+	for (int32_t i = totalPistas - 1; i > 0; i--)
+	{
+		uint32_t j = reduzirSorteio(sortearGeracao(semente, 1, (uint64_t)i), (uint32_t)i + 1);
+		ReferenciaPosicao troca = referencia[i];
+		referencia[i] = referencia[j];
+		referencia[j] = troca;
+	}
+
+	Pista* raiz = NULL;
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		raiz = inserirPista(textos, raiz, referencia[i].texto);
+	}
+	qsort(referencia, (size_t)totalPistas, sizeof(ReferenciaPosicao), compararReferenciasPosicao);
+
+	// Rank e select de todas as posições, e os limites fora da árvore.
+	unsigned long long divergencias = 0;
+	divergencias += tamanhoPista(raiz) != totalPistas;
+	divergencias += selecionarPista(raiz, -1) != NULL || selecionarPista(raiz, totalPistas) != NULL;
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		const Pista* selecionada = selecionarPista(raiz, i);
+		divergencias += selecionada == NULL || strcmp(selecionada->pista, referencia[i].texto) != 0;
+		divergencias += posicaoPista(raiz, referencia[i].texto) != i;
+	}
+
+	// Páginas de posições e tamanhos sorteados, inclusive as que passam do fim.
+	for (int c = 0; c < totalConsultas; c++)
+	{
+		uint64_t sorteio = sortearGeracao(semente, 2, (uint64_t)c);
+		int inicio = (int)reduzirSorteio(sorteio, (uint32_t)totalPistas);
+		int quantidade = 1 + (int)(sorteio % 64);
+		int esperado = totalPistas - inicio < quantidade ? totalPistas - inicio : quantidade;
+		int total = listarPistasPorPosicao(raiz, inicio, quantidade, lista);
+		divergencias += !conferirListaPosicoes(lista, total, referencia + inicio, esperado);
+	}
+
+	// Intervalos [de, ate) entre pistas sorteadas, com limites abertos(NULL) e vazios(de >= ate).
+	for (int c = 0; c < totalConsultas; c++)
+	{
+		uint64_t sorteio = sortearGeracao(semente, 3, (uint64_t)c);
+		int de = (int)reduzirSorteio(sorteio, (uint32_t)totalPistas + 1);
+		int ate = (int)reduzirSorteio(sorteio << 32, (uint32_t)totalPistas + 1);
+		const char* textoDe = de < totalPistas ? referencia[de].texto : NULL;
+		const char* textoAte = ate < totalPistas ? referencia[ate].texto : NULL;
+		if (textoDe == NULL)
+		{
+			de = 0; // Sem limite inferior, o intervalo começa na primeira pista.
+		}
+		int esperado = ate > de ? ate - de : 0;
+		int total = listarPistasPorIntervalo(raiz, textoDe, textoAte, lista, totalPistas);
+		divergencias += !conferirListaPosicoes(lista, total, referencia + de, esperado);
+	}
+
+	// O rank de uma pista ausente é a posição em que ela entraria(limite inferior na referência).
+	for (int c = 0; c < totalConsultas; c++)
+	{
+		ReferenciaPosicao ausente;
+		char texto[TAMANHO_MAX_PISTA];
+		snprintf(texto, sizeof(texto), "%s(ausente)", referencia[reduzirSorteio(sortearGeracao(semente, 4, (uint64_t)c), (uint32_t)totalPistas)].texto);
+		ausente.texto = texto;
+		ausente.tamanhoChave = montarChaveColacao(texto, ausente.chave, TAMANHO_MAX_CHAVE_COLACAO);
+		int esperado = 0;
+		for (int fim = totalPistas; esperado < fim;)
+		{
+			int meio = esperado + (fim - esperado) / 2;
+			if (compararReferenciasPosicao(&referencia[meio], &ausente) < 0)
+			{
+				esperado = meio + 1;
+			}
+			else
+			{
+				fim = meio;
+			}
+		}
+		divergencias += buscarPista(raiz, texto) != NULL || posicaoPista(raiz, texto) != esperado;
+	}
+
+	printf("\n===== Conferência das posições da árvore de pistas: %d pistas, altura %d =====\n", totalPistas, raiz->altura);
+	printf(" • Rank e select: %d posições | Páginas: %d | Intervalos: %d | Pistas ausentes: %d\n",
+		totalPistas, totalConsultas, totalConsultas, totalConsultas);
+	printf(" • Divergências: %llu\n", divergencias);
+	printf(" • Conferência das posições: %s\n", divergencias == 0 ? "ok" : "FALHOU");
+
+	liberarPista(raiz);
+	liberarHeapTextos(textos);
+	liberarCasoGerado(caso);
+	free(referencia);
+	free(lista);
+	return divergencias == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções da Colação de Pistas ****
+
+/// @brief Textos em ordem de colação pt-BR, do menor para o maior: letras sem acento e sem caixa,
+/// depois acentos(nenhum, agudo, grave, circunflexo, til, trema, anel, cedilha), depois caixa(minúscula primeiro).
+/// Espaços e pontuação vêm antes dos dígitos, e os dígitos antes das letras.
+static const char* const TEXTOS_COLACAO_ORDENADOS[] = {
+	"a", "A", "á", "Á", "à", "â", "ã", "Ã", "a b", "a1", "a2", "ab", "Ab", "abacate", "Abacate", "abacaxi",
+	"ábaco", "abóbora", "açaí", "ação", "acaso", "cafe", "Cafe", "café", "Café", "cafés", "coração", "corações",
+	"Corredor", "e", "é", "É", "ê", "ele", "pão", "Pão", "papel", "Pista 10", "pista 2", "Pista 2", "sótão",
+	"sotaque", "útil", "Zé", "zebra", "€ 5"
+};
+
+int conferirColacaoPistas(uint64_t semente)
+{
+	const int totalTextos = (int)(sizeof(TEXTOS_COLACAO_ORDENADOS) / sizeof(TEXTOS_COLACAO_ORDENADOS[0]));
+
+	unsigned char bufferPrimeira[TAMANHO_MAX_CHAVE_COLACAO];
+	unsigned char bufferSegunda[TAMANHO_MAX_CHAVE_COLACAO];
+	const char* embaralhados[sizeof(TEXTOS_COLACAO_ORDENADOS) / sizeof(TEXTOS_COLACAO_ORDENADOS[0])];
+	const Pista* lista[sizeof(TEXTOS_COLACAO_ORDENADOS) / sizeof(TEXTOS_COLACAO_ORDENADOS[0])];
+	int divergencias = 0;
+
+	// Cada par de textos, nas duas comparações: memcmp direto e a comparação pelo prefixo de 8 bytes.
+	for (int i = 0; i < totalTextos; i++)
+	{
+		for (int j = 0; j < totalTextos; j++)
+		{
+			ChaveColacao primeira, segunda;
+			prepararChaveConsulta(TEXTOS_COLACAO_ORDENADOS[i], &primeira, bufferPrimeira);
+			prepararChaveConsulta(TEXTOS_COLACAO_ORDENADOS[j], &segunda, bufferSegunda);
+			int esperado = i < j ? -1 : (i > j ? 1 : 0);
+
+			int comparacao = memcmp(primeira.bytes, segunda.bytes, primeira.tamanho < segunda.tamanho ? primeira.tamanho : segunda.tamanho);
+			if (comparacao == 0)
+			{
+				comparacao = primeira.tamanho == segunda.tamanho ? 0 : (primeira.tamanho < segunda.tamanho ? -1 : 1);
+			}
+			int rapida = compararChavesColacao(&primeira, &segunda);
+			bool divergente = (comparacao > 0) - (comparacao < 0) != esperado || (rapida > 0) - (rapida < 0) != esperado;
+			if (divergente && j == i + 1)
+			{
+				printf("  ❌  Fora de ordem: '%s' e '%s'.\n", TEXTOS_COLACAO_ORDENADOS[i], TEXTOS_COLACAO_ORDENADOS[j]);
+			}
+			divergencias += divergente;
+		}
+
+		// O tamanho da chave não depende do destino: medir(NULL) e montar dão o mesmo resultado.
+		divergencias += montarChaveColacao(TEXTOS_COLACAO_ORDENADOS[i], NULL, 0) !=
+			montarChaveColacao(TEXTOS_COLACAO_ORDENADOS[i], bufferSegunda, sizeof(bufferSegunda));
+	}
+
+	// A árvore, montada em ordem sorteada, devolve a lista em ordem.
+	for (int i = 0; i < totalTextos; i++)
+	{
+		embaralhados[i] = TEXTOS_COLACAO_ORDENADOS[i];
+	}
+	for (int i = totalTextos - 1; i > 0; i--)
+	{
+		uint32_t j = reduzirSorteio(sortearGeracao(semente, 8, (uint64_t)i), (uint32_t)i + 1);
+		const char* troca = embaralhados[i];
+		embaralhados[i] = embaralhados[j];
+		embaralhados[j] = troca;
+	}
+
+	HeapTextos* textos = criarHeapTextos();
+	if (textos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a conferência.\n");
+		return EXIT_FAILURE;
+	}
+	Pista* raiz = NULL;
+	for (int i = 0; i < totalTextos; i++)
+	{
+		raiz = inserirPista(textos, raiz, embaralhados[i]);
+	}
+	int total = listarPistasPorPosicao(raiz, 0, totalTextos, lista);
+	divergencias += total != totalTextos;
+	for (int i = 0; i < total && i < totalTextos; i++)
+	{
+		divergencias += strcmp(lista[i]->pista, TEXTOS_COLACAO_ORDENADOS[i]) != 0;
+	}
+
+	printf("\n===== Conferência da colação pt-BR: %d textos =====\n", totalTextos);
+	printf(" • Pares comparados: %d | Divergências: %d\n", totalTextos * totalTextos, divergencias);
+	printf(" • Conferência da colação: %s\n", divergencias == 0 ? "ok" : "FALHOU");
+
+	liberarPista(raiz);
+	liberarHeapTextos(textos);
+	return divergencias == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções da Mansão Colunar ****
+
+int medirMansaoColunar(int32_t totalSalas)
+{
+	if (totalSalas < 1)
+	{
+		printf("\n  ❌  Quantidade de salas inválida.\n");
+		return EXIT_FAILURE;
+	}
+
+	// Mansão procedural aleatória, já em ordem de nível, com dois terços das salas guardando uma pista.
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, totalSalas, 0x9E3779B97F4A7C15ULL);
+	parametros.densidadePistas = 2.0 / 3.0;
+	parametros.totalPistasDistintas = 64;
+	CasoGerado* caso = gerarCaso(&parametros);
+	MansaoColunar* colunar = caso != NULL ? caso->mansao : NULL;
+	Sala* encadeada = (Sala*)calloc((size_t)totalSalas, sizeof(Sala));
+	int32_t* percurso = (int32_t*)malloc((size_t)totalSalas * sizeof(int32_t));
+	HeapTextos* textos = criarHeapTextos();
+	if (colunar == NULL || encadeada == NULL || percurso == NULL || textos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		liberarCasoGerado(caso);
+		free(encadeada);
+		free(percurso);
+		liberarHeapTextos(textos);
+		return EXIT_FAILURE;
+	}
+
+	// Metade das pistas já coletadas. A mansão encadeada não tem marcas: a pista coletada é apagada da sala.
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		colunar->marcas[i] = (uint8_t)((uint32_t)(i * 2654435761u) >> 31) * MARCA_SALA_PISTA_COLETADA;
+
+		Sala* sala = &encadeada[i];
+		bool pendente = colunar->pista[i] != SEM_INDICE_COLUNAR && (colunar->marcas[i] & MARCA_SALA_PISTA_COLETADA) == 0;
+		sala->esquerda = colunar->esquerda[i] != SEM_INDICE_COLUNAR ? &encadeada[colunar->esquerda[i]] : NULL;
+		sala->direita = colunar->direita[i] != SEM_INDICE_COLUNAR ? &encadeada[colunar->direita[i]] : NULL;
+		atribuirTextoCompacto(textos, &sala->nome, colunar->textos[colunar->nome[i]]);
+		atribuirTextoCompacto(textos, &sala->pista, pendente ? colunar->textos[colunar->pista[i]] : "");
+	}
+
+	// Referência da banda de memória: leitura sequencial de uma coluna, sem nenhuma outra operação.
+	double inicio = instanteAtual();
+	int64_t soma = 0;
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		soma += colunar->esquerda[i];
+	}
+	double referencia = instanteAtual() - inicio;
+
+	inicio = instanteAtual();
+	int alturaEncadeada = altura(&encadeada[0]);
+	double tempoAlturaEncadeada = instanteAtual() - inicio;
+
+	inicio = instanteAtual();
+	int alturaColunas = alturaColunar(colunar);
+	double tempoAlturaColunar = instanteAtual() - inicio;
+
+	inicio = instanteAtual();
+	int32_t pendentesEncadeada = 0;
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		pendentesEncadeada += lerTextoCompacto(&encadeada[i].pista)[0] != '\0';
+	}
+	double tempoPendentesEncadeada = instanteAtual() - inicio;
+
+	inicio = instanteAtual();
+	int32_t pendentesColunas = contarPistasPendentesColunar(colunar);
+	double tempoPendentesColunar = instanteAtual() - inicio;
+
+	inicio = instanteAtual();
+	int32_t percorridas = percorrerMansaoColunar(colunar, OrdemPercurso_EM, percurso);
+	double tempoPercurso = instanteAtual() - inicio;
+
+	// Bytes efetivamente lidos por cada varredura, para estimar a banda alcançada.
+	double salas = (double)totalSalas;
+	double gb = 1e9;
+	printf("\n===== Mansão colunar: %d salas =====\n", totalSalas);
+	printf(" • Referência(leitura sequencial de uma coluna): %.3f s, %.2f GB/s\n",
+		referencia, salas * sizeof(int32_t) / referencia / gb);
+	printf(" • Altura encadeada: %d em %.3f s, %.2f GB/s em nós de %zu bytes\n",
+		alturaEncadeada, tempoAlturaEncadeada, salas * sizeof(Sala) / tempoAlturaEncadeada / gb, sizeof(Sala));
+	printf(" • Altura colunar: %d em %.3f s, %.2f GB/s nas colunas de saídas\n",
+		alturaColunas, tempoAlturaColunar, salas * 2 * sizeof(int32_t) / tempoAlturaColunar / gb);
+	printf(" • Pistas pendentes, encadeada: %d em %.3f s, %.2f GB/s\n",
+		pendentesEncadeada, tempoPendentesEncadeada, salas * sizeof(Sala) / tempoPendentesEncadeada / gb);
+	printf(" • Pistas pendentes, colunar: %d em %.3f s, %.2f GB/s\n",
+		pendentesColunas, tempoPendentesColunar, salas * (sizeof(int32_t) + sizeof(uint8_t)) / tempoPendentesColunar / gb);
+	printf(" • Percurso em ordem, colunar: %d salas em %.3f s\n", percorridas, tempoPercurso);
+	printf(" • Verificação: %lld\n", (long long)(soma + percurso[percorridas > 0 ? percorridas - 1 : 0]));
+
+	bool consistente = alturaEncadeada == alturaColunas && pendentesEncadeada == pendentesColunas && percorridas == totalSalas;
+	if (!consistente)
+	{
+		printf("\n  ❌  As duas representações divergiram.\n");
+	}
+
+	liberarCasoGerado(caso);
+	free(encadeada);
+	free(percurso);
+	liberarHeapTextos(textos);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções dos Nós Indexados ****
+
+/// @brief Estima o custo de uma alocação individual(malloc): um cabeçalho de 8 bytes e blocos
+/// múltiplos de 16, com o mínimo de 32 bytes, como no alocador do glibc em 64 bits.
+/// @param Inteiro. Tamanho solicitado, em bytes.
+/// @returns Inteiro. Bytes efetivamente ocupados no heap.
+static size_t custoAlocacao(size_t tamanho)
+{
+	size_t bloco = (tamanho + sizeof(size_t) + 15) & ~(size_t)15;
+	return bloco < 32 ? 32 : bloco;
+}
+
+/// @brief Exibe uma linha do relatório de memória: bytes dos nós, dos textos e por item, antes e depois.
+static void exibirLinhaRelatorioMemoria(const char* estrutura, const char* item, int64_t quantidade,
+	size_t nosAntes, size_t textosAntes, size_t nosDepois, size_t textosDepois)
+{
+	double itens = quantidade > 0 ? (double)quantidade : 1.0;
+	double totalAntes = (double)(nosAntes + textosAntes);
+	double totalDepois = (double)(nosDepois + textosDepois);
+	printf("\n • %s: %lld\n", estrutura, (long long)quantidade);
+	printf("     Ponteiros: nós %.1f + textos %.1f = %.1f bytes/%s (%.2f MiB)\n",
+		nosAntes / itens, textosAntes / itens, totalAntes / itens, item, totalAntes / (1024.0 * 1024.0));
+	printf("     Indexados: nós %.1f + textos %.1f = %.1f bytes/%s (%.2f MiB)\n",
+		nosDepois / itens, textosDepois / itens, totalDepois / itens, item, totalDepois / (1024.0 * 1024.0));
+	printf("     Redução: %.1f%% nos nós, %.1f%% no total\n",
+		nosAntes > 0 ? 100.0 * (1.0 - (double)nosDepois / nosAntes) : 0.0,
+		totalAntes > 0 ? 100.0 * (1.0 - totalDepois / totalAntes) : 0.0);
+}
+
+/// @brief Acumula um texto em uma impressão digital(FNV-1a), usada para conferir as duas representações.
+static uint64_t acumularImpressaoTexto(uint64_t impressao, const char* texto)
+{
+	for (const unsigned char* c = (const unsigned char*)(texto != NULL ? texto : ""); *c != '\0'; c++)
+	{
+		impressao = (impressao ^ *c) * 0x100000001B3ULL;
+	}
+	return (impressao ^ 0xFF) * 0x100000001B3ULL; // Separa textos consecutivos.
+}
+
+int relatorioMemoriaNos(int32_t totalSalas, int32_t totalPistas, int32_t totalCatalogo)
+{
+	if (totalSalas < 1 || totalPistas < 1 || totalCatalogo < 1 ||
+		totalPistas > MAXIMO_PISTAS_DISTINTAS || totalCatalogo > MAXIMO_PISTAS_DISTINTAS)
+	{
+		printf("\n  ❌  Quantidades inválidas(pistas e catálogo: de 1 a %d).\n", MAXIMO_PISTAS_DISTINTAS);
+		return EXIT_FAILURE;
+	}
+
+	// O caso gerado fornece os textos das duas representações; os seus textos não usam um heap de textos.
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, totalSalas, 0x9E3779B97F4A7C15ULL);
+	parametros.totalPistasDistintas = totalPistas > totalCatalogo ? totalPistas : totalCatalogo;
+	CasoGerado* caso = gerarCaso(&parametros);
+	Sala** salas = (Sala**)calloc((size_t)totalSalas, sizeof(Sala*));
+	if (caso == NULL || salas == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o relatório.\n");
+		liberarCasoGerado(caso);
+		free(salas);
+		return EXIT_FAILURE;
+	}
+
+	const MansaoColunar* mansao = caso->mansao;
+	const char* const* pistas = caso->mansao->textos + caso->primeiraPista;
+	uint32_t passoAmostra = (uint32_t)(totalPistas > 1000 ? totalPistas / 1000 : 1);
+	uint32_t passoCatalogo = (uint32_t)(totalCatalogo > 1000 ? totalCatalogo / 1000 : 1);
+	bool sucesso = true;
+
+	// Cada estrutura é montada e medida com o seu próprio heap de textos, para que não aproveite os textos de outra.
+	// Nós com ponteiros: um malloc por sala, por pista e por associação.
+	HeapTextos* textosSalas = criarHeapTextos();
+	sucesso = textosSalas != NULL;
+	for (int32_t i = 0; i < totalSalas && sucesso; i++)
+	{
+		int32_t pista = mansao->pista[i];
+		salas[i] = criarSala(textosSalas, mansao->textos[mansao->nome[i]], pista != SEM_INDICE_COLUNAR ? mansao->textos[pista] : "");
+		sucesso = salas[i] != NULL;
+	}
+	for (int32_t i = 0; i < totalSalas && sucesso; i++)
+	{
+		salas[i]->esquerda = mansao->esquerda[i] != SEM_INDICE_COLUNAR ? salas[mansao->esquerda[i]] : NULL;
+		salas[i]->direita = mansao->direita[i] != SEM_INDICE_COLUNAR ? salas[mansao->direita[i]] : NULL;
+	}
+	size_t salasNosAntes = (size_t)totalSalas * custoAlocacao(sizeof(Sala));
+	size_t salasTextosAntes = sucesso ? bytesHeapTextos(textosSalas) : 0;
+	int alturaSalas = sucesso ? altura(salas[0]) : 0;
+	// As salas são liberadas pelo vetor: uma mansão degenerada estouraria a pilha em uma liberação recursiva.
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		free(salas[i]);
+	}
+	liberarHeapTextos(textosSalas);
+
+	HeapTextos* textosPistas = criarHeapTextos();
+	sucesso = sucesso && textosPistas != NULL;
+	Pista* arvore = NULL;
+	for (int32_t i = 0; i < totalPistas && sucesso; i++)
+	{
+		arvore = inserirPista(textosPistas, arvore, pistas[i]);
+	}
+	int totalArvore = tamanhoPista(arvore);
+	int alturaPistas = arvore != NULL ? arvore->altura : 0;
+	size_t pistasNosAntes = (size_t)totalArvore * custoAlocacao(sizeof(Pista));
+	size_t pistasTextosAntes = sucesso ? bytesHeapTextos(textosPistas) : 0;
+	uint64_t impressaoPistas = 0xCBF29CE484222325ULL;
+	for (int32_t i = 0; i < totalArvore; i += passoAmostra)
+	{
+		const Pista* selecionada = selecionarPista(arvore, i);
+		impressaoPistas = acumularImpressaoTexto(impressaoPistas, selecionada != NULL ? selecionada->pista : NULL);
+	}
+	liberarPista(arvore);
+	liberarHeapTextos(textosPistas);
+
+	TabelaHash* catalogo = alocarTabelaHash(0);
+	sucesso = sucesso && catalogo != NULL;
+	for (int32_t i = 0; i < totalCatalogo && sucesso; i++)
+	{
+		inserirNoHash(pistas[i], caso->suspeitos[caso->suspeitoPista[i]], catalogo);
+	}
+	size_t catalogoNosAntes = custoAlocacao(sizeof(TabelaHash)) + (size_t)totalCatalogo * custoAlocacao(sizeof(NoHash));
+	size_t catalogoTextosAntes = sucesso && catalogo->textos != NULL ? bytesHeapTextos(catalogo->textos) : 0;
+	uint64_t impressaoCatalogo = 0xCBF29CE484222325ULL;
+	for (int32_t i = 0; i < totalCatalogo && sucesso; i += passoCatalogo)
+	{
+		const NoHash* no = buscarNoHash(pistas[i], catalogo, NULL);
+		impressaoCatalogo = acumularImpressaoTexto(impressaoCatalogo, no != NULL ? lerTextoCompacto(&no->suspeito) : NULL);
+	}
+	liberarTabelaHash(catalogo);
+
+	// Nós indexados. As salas já estão na mansão colunar do caso: índices de 32 bits e textos sem repetições.
+	size_t salasNosDepois = (size_t)totalSalas * (4 * sizeof(int32_t) + sizeof(uint8_t));
+	size_t salasTextosDepois = (size_t)mansao->totalTextos * sizeof(const char*);
+	for (int32_t i = 0; i < mansao->totalTextos; i++)
+	{
+		salasTextosDepois += strlen(mansao->textos[i]) + 1;
+	}
+	int alturaSalasIndexadas = alturaColunar(mansao);
+
+	ArvorePistasIndexada* arvoreIndexada = criarArvorePistasIndexada();
+	sucesso = sucesso && arvoreIndexada != NULL;
+	for (int32_t i = 0; i < totalPistas && sucesso; i++)
+	{
+		sucesso = inserirPistaIndexada(arvoreIndexada, pistas[i]);
+	}
+	size_t pistasNosDepois = sucesso ? custoAlocacao(sizeof(ArvorePistasIndexada)) + (size_t)arvoreIndexada->capacidade *
+		(sizeof(NoPistaIndexado) + sizeof(const char*) + sizeof(const ChaveColacao*)) : 0;
+	size_t pistasTextosDepois = sucesso ? bytesHeapTextos(arvoreIndexada->heapTextos) : 0;
+	uint64_t impressaoPistasIndexadas = 0xCBF29CE484222325ULL;
+	for (uint32_t i = 0; sucesso && i < arvoreIndexada->total; i += passoAmostra)
+	{
+		impressaoPistasIndexadas = acumularImpressaoTexto(impressaoPistasIndexadas, selecionarPistaIndexada(arvoreIndexada, i));
+	}
+	for (int32_t i = 0; i < totalPistas && sucesso; i += passoAmostra)
+	{
+		sucesso = buscarPistaIndexada(arvoreIndexada, pistas[i]) != SEM_NO_INDEXADO;
+	}
+	uint32_t totalArvoreIndexada = sucesso ? arvoreIndexada->total : 0;
+	uint32_t alturaPistasIndexadas = sucesso ? alturaArvorePistasIndexada(arvoreIndexada) : 0;
+	liberarArvorePistasIndexada(arvoreIndexada);
+
+	TabelaHashIndexada* catalogoIndexado = criarTabelaHashIndexada();
+	sucesso = sucesso && catalogoIndexado != NULL;
+	for (int32_t i = 0; i < totalCatalogo && sucesso; i++)
+	{
+		sucesso = inserirNoHashIndexado(pistas[i], caso->suspeitos[caso->suspeitoPista[i]], catalogoIndexado);
+	}
+	size_t catalogoNosDepois = sucesso ? custoAlocacao(sizeof(TabelaHashIndexada)) +
+		(size_t)catalogoIndexado->capacidade * (sizeof(NoHashIndexado) + sizeof(const char*)) +
+		(size_t)catalogoIndexado->capacidadeSuspeitos * sizeof(const char*) : 0;
+	size_t catalogoTextosDepois = sucesso ? bytesHeapTextos(catalogoIndexado->heapTextos) : 0;
+	uint64_t impressaoCatalogoIndexado = 0xCBF29CE484222325ULL;
+	for (int32_t i = 0; i < totalCatalogo && sucesso; i += passoCatalogo)
+	{
+		impressaoCatalogoIndexado = acumularImpressaoTexto(impressaoCatalogoIndexado,
+			suspeitoNoHashIndexado(catalogoIndexado, buscarNoHashIndexado(pistas[i], catalogoIndexado)));
+	}
+	liberarTabelaHashIndexada(catalogoIndexado);
+
+	if (sucesso)
+	{
+		printf("\n===== Memória dos nós: ponteiros x índices de 32 bits =====\n");
+		printf(" • Nós: Sala %zu, Pista %zu e NoHash %zu bytes(+ cabeçalho do malloc) x "
+			"sala colunar %zu, NoPistaIndexado %zu e NoHashIndexado %zu bytes(em pools)\n",
+			sizeof(Sala), sizeof(Pista), sizeof(NoHash), 4 * sizeof(int32_t) + sizeof(uint8_t),
+			sizeof(NoPistaIndexado), sizeof(NoHashIndexado));
+		exibirLinhaRelatorioMemoria("Salas", "sala", totalSalas,
+			salasNosAntes, salasTextosAntes, salasNosDepois, salasTextosDepois);
+		exibirLinhaRelatorioMemoria("Pistas coletadas", "pista", totalArvore,
+			pistasNosAntes, pistasTextosAntes, pistasNosDepois, pistasTextosDepois);
+		exibirLinhaRelatorioMemoria("Catálogo", "associação", totalCatalogo,
+			catalogoNosAntes, catalogoTextosAntes, catalogoNosDepois, catalogoTextosDepois);
+		printf("\n ℹ️  Textos: curtos dentro dos nós e longos no heap de textos da estrutura(ponteiros), ou todos internados "
+			"(indexados); o heap é contado em blocos de %d bytes. Pools contados pela capacidade reservada.\n",
+			TAMANHO_BLOCO_HEAP_TEXTOS);
+	}
+
+	bool consistente = sucesso && alturaSalas == alturaSalasIndexadas &&
+		(uint32_t)totalArvore == totalArvoreIndexada && (uint32_t)alturaPistas == alturaPistasIndexadas &&
+		impressaoPistas == impressaoPistasIndexadas && impressaoCatalogo == impressaoCatalogoIndexado;
+	if (!sucesso)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para as estruturas indexadas.\n");
+	}
+	else if (!consistente)
+	{
+		printf("\n  ❌  As duas representações divergiram.\n");
+	}
+
+	liberarCasoGerado(caso);
+	free(salas);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Gerador de Mansões ****
+
+int executarGeradorMansao(int argc, char* argv[])
+{
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, argc > 0 ? atoi(argv[0]) : 1000000, argc > 2 ? strtoull(argv[2], NULL, 10) : 42);
+
+	if (argc > 1)
+	{
+		if (strcmp(argv[1], "completa") == 0)
+		{
+			parametros.formato = FormatoMansao_COMPLETA;
+		}
+		else if (strcmp(argv[1], "degenerada") == 0)
+		{
+			parametros.formato = FormatoMansao_DEGENERADA;
+		}
+		else if (strcmp(argv[1], "aleatoria") != 0)
+		{
+			printf("\n  ❌  Formato inválido: use completa, degenerada ou aleatoria.\n");
+			return EXIT_FAILURE;
+		}
+	}
+	if (argc > 3)
+	{
+		parametros.densidadePistas = atof(argv[3]);
+	}
+	if (argc > 4)
+	{
+		parametros.totalSuspeitos = atoi(argv[4]);
+	}
+	if (argc > 5)
+	{
+		if (strcmp(argv[5], "zipf") == 0)
+		{
+			parametros.distribuicao = DistribuicaoPistas_ZIPF;
+		}
+		else if (strcmp(argv[5], "uniforme") != 0)
+		{
+			printf("\n  ❌  Distribuição inválida: use uniforme ou zipf.\n");
+			return EXIT_FAILURE;
+		}
+	}
+	if (argc > 6)
+	{
+		parametros.totalThreads = atoi(argv[6]);
+	}
+
+	double inicio = instanteAtual();
+	CasoGerado* caso = gerarCaso(&parametros);
+	double geracao = instanteAtual() - inicio;
+
+	if (caso == NULL)
+	{
+		printf("\n  ❌  Não foi possível gerar o caso com esses parâmetros.\n");
+		return EXIT_FAILURE;
+	}
+
+	printf("\n===== Mansão gerada: %d salas, semente %llu =====\n", caso->mansao->totalSalas, (unsigned long long)parametros.semente);
+	printf(" • Geração: %.3f s(%d thread(s))\n", geracao,
+		parametros.totalThreads > 0 ? parametros.totalThreads : contarProcessadores());
+	printf(" • Altura: %d\n", alturaColunar(caso->mansao));
+	printf(" • Salas com pista: %lld, %d pistas distintas, %d suspeitos\n",
+		(long long)caso->salasComPista, caso->totalPistasDistintas, caso->totalSuspeitos);
+	printf(" • Impressão digital: %016llx\n", (unsigned long long)impressaoDigitalCaso(caso));
+
+	// Casos pequenos são exibidos por completo, em pré-ordem.
+	if (caso->mansao->totalSalas <= 32)
+	{
+		int32_t salas[32];
+		int32_t total = percorrerMansaoColunar(caso->mansao, OrdemPercurso_PRE, salas);
+		for (int32_t i = 0; i < total; i++)
+		{
+			const char* pista = pistaSalaGerada(caso, salas[i]);
+			printf(" • %s", caso->mansao->textos[caso->mansao->nome[salas[i]]]);
+			if (pista != NULL)
+			{
+				printf(": %s ➜ %s", pista, suspeitoSalaGerada(caso, salas[i]));
+			}
+			printf("\n");
+		}
+	}
+
+	liberarCasoGerado(caso);
+	return EXIT_SUCCESS;
+}
+
+// **** Funções da Pontuação de Suspeitos ****
+
+int medirPontuacaoSuspeitos(int32_t totalSuspeitos, long long totalPistas)
+{
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+	const int rodadasEvidencias = 200;
+
+	if (totalSuspeitos < 1 || totalPistas < 1)
+	{
+		printf("\n  ❌  Quantidades inválidas.\n");
+		return EXIT_FAILURE;
+	}
+
+	PontuacaoSuspeitos incremental, completa;
+	bool iniciadas = iniciarPontuacaoSuspeitos(&incremental, totalSuspeitos);
+	iniciadas = iniciarPontuacaoSuspeitos(&completa, totalSuspeitos) && iniciadas;
+	float* evidencias = (float*)malloc((size_t)totalSuspeitos * sizeof(float));
+	if (!iniciadas || evidencias == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		liberarPontuacaoSuspeitos(&incremental);
+		liberarPontuacaoSuspeitos(&completa);
+		free(evidencias);
+		return EXIT_FAILURE;
+	}
+
+	// Cada pista aponta de um a três suspeitos sorteados. A referência repete a mesma atualização, mas
+	// recalcula a soma com todos os suspeitos a cada pista, e por isso mede apenas as primeiras pistas.
+	long long totalReferencia = totalPistas < 2000 ? totalPistas : 2000;
+	double tempoIncremental = 0.0, tempoReferencia = 0.0;
+	for (int fase = 0; fase < 2; fase++)
+	{
+		PontuacaoSuspeitos* pontuacao = fase == 0 ? &incremental : &completa;
+		long long pistas = fase == 0 ? totalPistas : totalReferencia;
+
+		double inicio = instanteAtual();
+		for (long long i = 0; i < pistas; i++)
+		{
+			uint64_t sorteio = sortearGeracao(semente, 0, (uint64_t)i);
+			int32_t apontados = 1 + (int32_t)reduzirSorteio(sorteio, 3);
+			int32_t suspeitos[3];
+			for (int32_t j = 0; j < apontados; j++)
+			{
+				suspeitos[j] = (int32_t)reduzirSorteio(sortearGeracao(semente, 1 + (uint64_t)j, (uint64_t)i), (uint32_t)totalSuspeitos);
+			}
+
+			registrarPistaPontuacao(pontuacao, suspeitos, apontados, RAZAO_VEROSSIMILHANCA_PISTA);
+			if (fase == 1)
+			{
+				recalcularSomaPontuacao(pontuacao);
+			}
+		}
+		if (fase == 0)
+		{
+			tempoIncremental = instanteAtual() - inicio;
+		}
+		else
+		{
+			tempoReferencia = instanteAtual() - inicio;
+		}
+	}
+
+	// A soma mantida incrementalmente deve coincidir com a recalculada do zero.
+	double somaIncremental = incremental.somaPesos, referenciaIncremental = incremental.referencia;
+	unsigned long long recalculosIncremental = incremental.recalculos;
+	recalcularSomaPontuacao(&incremental);
+	double esperada = incremental.somaPesos * exp(incremental.referencia - referenciaIncremental);
+	double erroRelativo = fabs(somaIncremental - esperada) / esperada;
+
+	// Evidências em lote: uma pontuação por suspeito, somada ao vetor denso inteiro.
+	for (int32_t i = 0; i < totalSuspeitos; i++)
+	{
+		evidencias[i] = (float)((double)reduzirSorteio(sortearGeracao(semente, 4, (uint64_t)i), 2001) / 10000.0 - 0.1);
+	}
+	double inicio = instanteAtual();
+	for (int rodada = 0; rodada < rodadasEvidencias; rodada++)
+	{
+		aplicarEvidenciasPontuacao(&completa, evidencias);
+	}
+	double tempoEvidencias = instanteAtual() - inicio;
+
+	printf("\n===== Pontuação bayesiana: %d suspeitos =====\n", totalSuspeitos);
+	printf(" • Incremental: %lld pistas em %.1f ms, %.1f ns por pista(%llu recálculo(s) completo(s))\n",
+		totalPistas, tempoIncremental * 1000.0, tempoIncremental * 1e9 / (double)totalPistas, recalculosIncremental);
+	printf(" • Recalculando tudo a cada pista: %lld pistas em %.1f ms, %.1f ns por pista(%.0fx mais lento)\n",
+		totalReferencia, tempoReferencia * 1000.0, tempoReferencia * 1e9 / (double)totalReferencia,
+		tempoIncremental > 0 ? (tempoReferencia / (double)totalReferencia) / (tempoIncremental / (double)totalPistas) : 0.0);
+	printf(" • Evidências em lote(vetor denso): %d rodadas em %.1f ms, %.2f ns por suspeito\n",
+		rodadasEvidencias, tempoEvidencias * 1000.0, tempoEvidencias * 1e9 / ((double)rodadasEvidencias * totalSuspeitos));
+	printf(" • Erro relativo da soma incremental: %.2e\n", erroRelativo);
+
+	int32_t classificacao[MAXIMO_CLASSIFICACAO_SUSPEITOS];
+	int32_t total = classificarSuspeitos(&incremental, classificacao, 5);
+	for (int32_t i = 0; i < total; i++)
+	{
+		printf("     %d. suspeito %d: %.3f%%\n", i + 1, classificacao[i], 100.0 * probabilidadeSuspeito(&incremental, classificacao[i]));
+	}
+
+	bool consistente = erroRelativo < 1e-6;
+	if (!consistente)
+	{
+		printf("\n  ❌  A soma incremental divergiu da recalculada.\n");
+	}
+
+	liberarPontuacaoSuspeitos(&incremental);
+	liberarPontuacaoSuspeitos(&completa);
+	free(evidencias);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções dos Conjuntos de Evidências ****
+
+int medirConjuntosEvidencias(int32_t totalPistas, int32_t totalSuspeitos)
+{
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+
+	if (totalPistas < 1 || totalPistas > MAXIMO_PISTAS_DISTINTAS || totalSuspeitos < 1)
+	{
+		printf("\n  ❌  Quantidades inválidas(pistas: de 1 a %d).\n", MAXIMO_PISTAS_DISTINTAS);
+		return EXIT_FAILURE;
+	}
+
+	// O caso gerado fornece as pistas distintas e o suspeito de cada uma(o catálogo).
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, 1024, semente);
+	parametros.totalPistasDistintas = totalPistas;
+	parametros.totalSuspeitos = totalSuspeitos;
+	CasoGerado* caso = gerarCaso(&parametros);
+	TabelaHash* catalogo = alocarTabelaHash(0);
+	ConjuntosEvidencias* conjuntos = criarConjuntosEvidencias(totalPistas, totalSuspeitos);
+	int32_t* contagensArvore = (int32_t*)calloc((size_t)totalSuspeitos, sizeof(int32_t));
+	int32_t* contagensBits = (int32_t*)calloc((size_t)totalSuspeitos, sizeof(int32_t));
+	HeapTextos* textos = criarHeapTextos();
+	if (caso == NULL || catalogo == NULL || conjuntos == NULL || contagensArvore == NULL || contagensBits == NULL ||
+		textos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		liberarCasoGerado(caso);
+		liberarTabelaHash(catalogo);
+		liberarConjuntosEvidencias(conjuntos);
+		free(contagensArvore);
+		free(contagensBits);
+		liberarHeapTextos(textos);
+		return EXIT_FAILURE;
+	}
+
+	// Metade das pistas coletadas: na árvore de pistas, para a contagem do jogo, e no bitset.
+	const char* const* pistas = caso->mansao->textos + caso->primeiraPista;
+	Pista* arvore = NULL;
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		inserirNoHash(pistas[i], caso->suspeitos[caso->suspeitoPista[i]], catalogo);
+		associarPistaEvidencias(conjuntos, i, caso->suspeitoPista[i]);
+		if (sortearGeracao(semente, 1, (uint64_t)i) & 1)
+		{
+			arvore = inserirPista(textos, arvore, pistas[i]);
+			marcarPistaColetadaEvidencias(conjuntos, i);
+		}
+	}
+
+	// Contagem com a tabela hash e a árvore, varrendo o catálogo para cada suspeito.
+	double inicio = instanteAtual();
+	for (int32_t suspeito = 0; suspeito < totalSuspeitos; suspeito++)
+	{
+		const char* nome = caso->suspeitos[suspeito];
+		for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+		{
+			for (const NoHash* atual = catalogo->dados[i]; atual != NULL; atual = atual->proximo)
+			{
+				if (strcmp(lerTextoCompacto(&atual->suspeito), nome) == 0 &&
+					buscarPista(arvore, lerTextoCompacto(&atual->pista)) != NULL)
+				{
+					contagensArvore[suspeito]++;
+				}
+			}
+		}
+	}
+	double tempoArvore = instanteAtual() - inicio;
+
+	// Contagem com os bitsets, repetida até um tempo mensurável.
+	int rodadas = 0;
+	int32_t alcancaram = 0;
+	inicio = instanteAtual();
+	double tempoBits;
+	do
+	{
+		alcancaram = contarPistasSuspeitosEvidencias(conjuntos, contagensBits, NUMERO_PISTAS_REQUERIDAS);
+		rodadas++;
+		tempoBits = instanteAtual() - inicio;
+	} while (tempoBits < 0.2);
+	tempoBits /= rodadas;
+
+	bool consistente = true;
+	int64_t coletadas = 0;
+	for (int32_t suspeito = 0; suspeito < totalSuspeitos; suspeito++)
+	{
+		consistente = consistente && contagensArvore[suspeito] == contagensBits[suspeito];
+		coletadas += contagensBits[suspeito];
+	}
+
+	printf("\n===== Conjuntos de evidências: %d pistas, %d suspeitos =====\n", totalPistas, totalSuspeitos);
+	printf(" • Pistas coletadas: %lld | Suspeitos com %d ou mais pistas: %d\n",
+		(long long)coletadas, NUMERO_PISTAS_REQUERIDAS, alcancaram);
+	printf(" • Tabela hash + árvore: %.3f ms para todos os suspeitos, %.1f us por suspeito\n",
+		tempoArvore * 1000.0, tempoArvore * 1e6 / totalSuspeitos);
+	printf(" • Bitsets(popcount): %.3f ms para todos os suspeitos, %.1f ns por suspeito(%d palavras de 64 bits)\n",
+		tempoBits * 1000.0, tempoBits * 1e9 / totalSuspeitos, conjuntos->palavras);
+	printf(" • Aceleração: %.0fx\n", tempoBits > 0 ? tempoArvore / tempoBits : 0.0);
+	if (!consistente)
+	{
+		printf("\n  ❌  As duas contagens divergiram.\n");
+	}
+
+	liberarPista(arvore);
+	liberarHeapTextos(textos);
+	liberarTabelaHash(catalogo);
+	liberarConjuntosEvidencias(conjuntos);
+	liberarCasoGerado(caso);
+	free(contagensArvore);
+	free(contagensBits);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Grafo da Mansão ****
+
+MansaoGrafo* converterColunarGrafo(const MansaoColunar* mansao)
+{
+	if (mansao == NULL || mansao->totalSalas < 1)
+	{
+		return NULL;
+	}
+
+	int32_t total = 0;
+	for (int32_t i = 0; i < mansao->totalSalas; i++)
+	{
+		total += (mansao->esquerda[i] != SEM_INDICE_COLUNAR) + (mansao->direita[i] != SEM_INDICE_COLUNAR);
+	}
+
+	int32_t* origens = (int32_t*)malloc((size_t)(total > 0 ? total : 1) * sizeof(int32_t));
+	int32_t* destinos = (int32_t*)malloc((size_t)(total > 0 ? total : 1) * sizeof(int32_t));
+	if (origens == NULL || destinos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o grafo da mansão.\n");
+		free(origens);
+		free(destinos);
+		return NULL;
+	}
+
+	int32_t arestas = 0;
+	for (int32_t i = 0; i < mansao->totalSalas; i++)
+	{
+		if (mansao->esquerda[i] != SEM_INDICE_COLUNAR)
+		{
+			origens[arestas] = i;
+			destinos[arestas++] = mansao->esquerda[i];
+		}
+		if (mansao->direita[i] != SEM_INDICE_COLUNAR)
+		{
+			origens[arestas] = i;
+			destinos[arestas++] = mansao->direita[i];
+		}
+	}
+
+	MansaoGrafo* grafo = construirMansaoGrafo(mansao->totalSalas, origens, destinos, arestas);
+	free(origens);
+	free(destinos);
+	return grafo;
+}
+
+/// @brief Gera as arestas de um grafo da mansão sintético: as saídas de uma mansão procedural aleatória
+/// (a árvore de salas, que alcança todas a partir da sala 0), seguidas de portas sorteadas entre salas quaisquer.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Quantidade de portas extras por sala.
+/// @param Vetor. Ponteiro via referência, para receber as salas de origem. Liberado por quem chama.
+/// @param Vetor. Ponteiro via referência, para receber as salas de destino. Liberado por quem chama.
+/// @returns Inteiro. Quantidade de arestas, ou -1 em caso de falha.
+static int32_t gerarArestasSinteticas(int32_t totalSalas, int32_t portasPorSala, int32_t** origens, int32_t** destinos)
+{
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+
+	*origens = NULL;
+	*destinos = NULL;
+	if (totalSalas < 1 || portasPorSala < 0 || (int64_t)totalSalas * (portasPorSala + 1) > INT32_MAX)
+	{
+		printf("\n  ❌  Quantidades inválidas.\n");
+		return -1;
+	}
+
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, totalSalas, semente);
+	CasoGerado* caso = gerarCaso(&parametros);
+	MansaoGrafo* arvore = caso != NULL ? converterColunarGrafo(caso->mansao) : NULL;
+	liberarCasoGerado(caso);
+	int32_t totalArestas = arvore != NULL ? arvore->totalSaidas + totalSalas * portasPorSala : 0;
+	*origens = (int32_t*)malloc((size_t)(totalArestas > 0 ? totalArestas : 1) * sizeof(int32_t));
+	*destinos = (int32_t*)malloc((size_t)(totalArestas > 0 ? totalArestas : 1) * sizeof(int32_t));
+	if (arvore == NULL || *origens == NULL || *destinos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o grafo sintético.\n");
+		liberarMansaoGrafo(arvore);
+		free(*origens);
+		free(*destinos);
+		*origens = NULL;
+		*destinos = NULL;
+		return -1;
+	}
+
+	int32_t arestas = 0;
+	for (int32_t sala = 0; sala < totalSalas; sala++)
+	{
+		for (int32_t i = 0; i < totalSaidasGrafo(arvore, sala); i++)
+		{
+			(*origens)[arestas] = sala;
+			(*destinos)[arestas++] = seguirSaidaGrafo(arvore, sala, i);
+		}
+	}
+	for (int64_t i = 0; arestas < totalArestas; i++)
+	{
+		(*origens)[arestas] = (int32_t)reduzirSorteio(sortearGeracao(semente, 20, (uint64_t)i), (uint32_t)totalSalas);
+		(*destinos)[arestas++] = (int32_t)reduzirSorteio(sortearGeracao(semente, 21, (uint64_t)i), (uint32_t)totalSalas);
+	}
+
+	liberarMansaoGrafo(arvore);
+	return totalArestas;
+}
+
+/// @brief Define uma porta de uma lista de adjacência encadeada, a referência da medição do grafo.
+typedef struct PortaEncadeada
+{
+	int32_t destino;
+	struct PortaEncadeada* proxima;
+} PortaEncadeada;
+
+int medirMansaoGrafo(int32_t totalSalas, int32_t portasPorSala)
+{
+	int32_t* origens;
+	int32_t* destinos;
+	int32_t totalArestas = gerarArestasSinteticas(totalSalas, portasPorSala, &origens, &destinos);
+	if (totalArestas < 0)
+	{
+		return EXIT_FAILURE;
+	}
+
+	int32_t* percurso = (int32_t*)malloc((size_t)totalSalas * sizeof(int32_t));
+	PortaEncadeada** listas = (PortaEncadeada**)calloc((size_t)totalSalas, sizeof(PortaEncadeada*));
+	if (percurso == NULL || listas == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		free(origens);
+		free(destinos);
+		free(percurso);
+		free(listas);
+		return EXIT_FAILURE;
+	}
+
+	double inicio = instanteAtual();
+	MansaoGrafo* grafo = construirMansaoGrafo(totalSalas, origens, destinos, totalArestas);
+	double tempoConstrucao = instanteAtual() - inicio;
+
+	// Referência: listas encadeadas com um nó alocado por porta, na ordem inversa da inserção.
+	inicio = instanteAtual();
+	bool listasCompletas = true;
+	for (int32_t i = 0; i < totalArestas && listasCompletas; i++)
+	{
+		PortaEncadeada* porta = (PortaEncadeada*)malloc(sizeof(PortaEncadeada));
+		listasCompletas = porta != NULL;
+		if (porta != NULL)
+		{
+			porta->destino = destinos[i];
+			porta->proxima = listas[origens[i]];
+			listas[origens[i]] = porta;
+		}
+	}
+	double tempoConstrucaoListas = instanteAtual() - inicio;
+
+	inicio = instanteAtual();
+	int32_t alcancadas = percorrerMansaoGrafo(grafo, 0, percurso);
+	double tempoPercurso = instanteAtual() - inicio;
+
+	// O mesmo percurso em largura, sobre as listas encadeadas.
+	int32_t alcancadasListas = -1;
+	double tempoPercursoListas = 0.0;
+	uint64_t* visitadas = (uint64_t*)calloc(((size_t)totalSalas + 63) / 64, sizeof(uint64_t));
+	if (listasCompletas && visitadas != NULL)
+	{
+		inicio = instanteAtual();
+		int32_t proxima = 0;
+		alcancadasListas = 0;
+		percurso[alcancadasListas++] = 0;
+		visitadas[0] |= 1;
+		while (proxima < alcancadasListas)
+		{
+			for (const PortaEncadeada* porta = listas[percurso[proxima++]]; porta != NULL; porta = porta->proxima)
+			{
+				uint64_t bit = 1ULL << (porta->destino % 64);
+				if ((visitadas[porta->destino / 64] & bit) == 0)
+				{
+					visitadas[porta->destino / 64] |= bit;
+					percurso[alcancadasListas++] = porta->destino;
+				}
+			}
+		}
+		tempoPercursoListas = instanteAtual() - inicio;
+	}
+
+	printf("\n===== Grafo da mansão: %d salas, %d saídas(%d portas extras por sala) =====\n",
+		totalSalas, totalArestas, portasPorSala);
+	printf(" • Construção CSR: %.1f ms | Listas encadeadas: %.1f ms\n",
+		tempoConstrucao * 1000.0, tempoConstrucaoListas * 1000.0);
+	printf(" • Memória CSR: %.1f MB | Listas encadeadas: %.1f MB(sem o cabeçalho do malloc)\n",
+		((double)totalSalas + 1 + totalArestas) * sizeof(int32_t) / 1e6,
+		((double)totalSalas * sizeof(PortaEncadeada*) + (double)totalArestas * sizeof(PortaEncadeada)) / 1e6);
+	printf(" • Percurso em largura, CSR: %d salas em %.1f ms, %.1f milhões de saídas/s\n",
+		alcancadas, tempoPercurso * 1000.0, tempoPercurso > 0 ? totalArestas / tempoPercurso / 1e6 : 0.0);
+	printf(" • Percurso em largura, listas encadeadas: %d salas em %.1f ms(%.1fx mais lento)\n",
+		alcancadasListas, tempoPercursoListas * 1000.0, tempoPercurso > 0 ? tempoPercursoListas / tempoPercurso : 0.0);
+
+	bool consistente = grafo != NULL && alcancadas == totalSalas && alcancadasListas == totalSalas;
+	if (!consistente)
+	{
+		printf("\n  ❌  O percurso não alcançou todas as salas.\n");
+	}
+
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		while (listas[i] != NULL)
+		{
+			PortaEncadeada* proxima = listas[i]->proxima;
+			free(listas[i]);
+			listas[i] = proxima;
+		}
+	}
+	free(visitadas);
+	free(listas);
+	free(percurso);
+	free(origens);
+	free(destinos);
+	liberarMansaoGrafo(grafo);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int medirDistanciasGrafo(int32_t totalSalas, int32_t portasPorSala, int totalThreads)
+{
+	int32_t* origens;
+	int32_t* destinos;
+	int32_t totalArestas = gerarArestasSinteticas(totalSalas, portasPorSala, &origens, &destinos);
+	if (totalArestas < 0)
+	{
+		return EXIT_FAILURE;
+	}
+
+	// O grafo das entradas é o das saídas com as arestas invertidas.
+	MansaoGrafo* grafo = construirMansaoGrafo(totalSalas, origens, destinos, totalArestas);
+	MansaoGrafo* entradas = construirMansaoGrafo(totalSalas, destinos, origens, totalArestas);
+	free(origens);
+	free(destinos);
+	int32_t* distancias[3];
+	for (int i = 0; i < 3; i++)
+	{
+		distancias[i] = (int32_t*)malloc((size_t)totalSalas * sizeof(int32_t));
+	}
+	if (grafo == NULL || entradas == NULL || distancias[0] == NULL || distancias[1] == NULL || distancias[2] == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		liberarMansaoGrafo(grafo);
+		liberarMansaoGrafo(entradas);
+		for (int i = 0; i < 3; i++)
+		{
+			free(distancias[i]);
+		}
+		return EXIT_FAILURE;
+	}
+
+	const char* descricoes[3] = { "Apenas de cima para baixo", "Com troca de direção", "Com troca de direção" };
+	const MansaoGrafo* grafosEntradas[3] = { NULL, entradas, entradas };
+	const int threads[3] = { 1, 1, totalThreads };
+	int32_t alcancadas[3];
+
+	printf("\n===== Distâncias no grafo da mansão: %d salas, %d saídas =====\n", totalSalas, totalArestas);
+	for (int i = 0; i < 3; i++)
+	{
+		EstatisticasDistancias estatisticas = { 0 };
+		double inicio = instanteAtual();
+		alcancadas[i] = calcularDistanciasGrafo(grafo, grafosEntradas[i], 0, distancias[i], threads[i], &estatisticas);
+		double tempo = instanteAtual() - inicio;
+
+		printf(" • %s(%d thread(s)): %.1f ms, %.1f milhões de saídas/s | %d níveis, %d de baixo para cima | %.1f%% das saídas examinadas\n",
+			descricoes[i], estatisticas.totalThreads, tempo * 1000.0, tempo > 0 ? totalArestas / tempo / 1e6 : 0.0,
+			estatisticas.niveis, estatisticas.niveisBaixoParaCima,
+			totalArestas > 0 ? 100.0 * (double)estatisticas.arestasExaminadas / totalArestas : 0.0);
+	}
+
+	bool consistente = alcancadas[0] == totalSalas && alcancadas[1] == totalSalas && alcancadas[2] == totalSalas &&
+		memcmp(distancias[0], distancias[1], (size_t)totalSalas * sizeof(int32_t)) == 0 &&
+		memcmp(distancias[0], distancias[2], (size_t)totalSalas * sizeof(int32_t)) == 0;
+	if (!consistente)
+	{
+		printf("\n  ❌  As distâncias divergiram entre as buscas.\n");
+	}
+
+	liberarMansaoGrafo(grafo);
+	liberarMansaoGrafo(entradas);
+	for (int i = 0; i < 3; i++)
+	{
+		free(distancias[i]);
+	}
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Armazém de Salas Paginado ****
+
+int medirArmazemSalas(int32_t totalSalas, int32_t capacidadePaginas, int32_t partidas)
+{
+	const char* caminho = "detective_quest_salas.paginas";
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+
+	if (totalSalas < 1 || capacidadePaginas < 1 || partidas < 1)
+	{
+		printf("\n  ❌  Quantidades inválidas.\n");
+		return EXIT_FAILURE;
+	}
+
+	// Mansão procedural aleatória, gravada em disco; a mansão colunar fica para conferir as descidas.
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, totalSalas, semente);
+	CasoGerado* caso = gerarCaso(&parametros);
+	if (caso == NULL || !gravarSalasPaginadas(caso->mansao, caminho))
+	{
+		printf("\n  ❌  Erro ao gerar e gravar o arquivo de salas.\n");
+		liberarCasoGerado(caso);
+		remove(caminho);
+		return EXIT_FAILURE;
+	}
+	const MansaoColunar* colunar = caso->mansao;
+
+	// Referência: todas as salas lidas antes da partida, como criarSalas faz com as salas do caso.
+	double inicio = instanteAtual();
+	FILE* arquivo = fopen(caminho, "rb");
+	RegistroSalaPaginada* todas = (RegistroSalaPaginada*)malloc((size_t)totalSalas * sizeof(RegistroSalaPaginada));
+	bool lidas = arquivo != NULL && todas != NULL && fseek(arquivo, (long)sizeof(CabecalhoSalasPaginadas), SEEK_SET) == 0 &&
+		fread(todas, sizeof(RegistroSalaPaginada), (size_t)totalSalas, arquivo) == (size_t)totalSalas;
+	double tempoCompleta = instanteAtual() - inicio;
+	if (arquivo != NULL)
+	{
+		fclose(arquivo);
+	}
+	free(todas);
+
+	inicio = instanteAtual();
+	ArmazemSalas* armazem = abrirArmazemSalas(caminho, capacidadePaginas);
+	double tempoAbertura = instanteAtual() - inicio;
+	if (armazem == NULL)
+	{
+		printf("\n  ❌  Não foi possível abrir o arquivo de salas '%s'.\n", caminho);
+		liberarCasoGerado(caso);
+		remove(caminho);
+		return EXIT_FAILURE;
+	}
+	size_t memoriaAbertura = memoriaResidenteArmazem(armazem);
+
+	// Cada partida desce da primeira sala até uma folha, por saídas sorteadas, lendo o nome e a pista
+	// de cada sala. A descida que sai de uma folha volta à primeira sala e encerra a partida.
+	int64_t passos = 0, somaArmazem = 0;
+	bool falhou = false;
+	inicio = instanteAtual();
+	for (int32_t partida = 0; partida < partidas && !falhou; partida++)
+	{
+		int32_t atual = 0;
+		for (uint64_t passo = 0;; passo++)
+		{
+			const RegistroSalaPaginada* sala = obterSalaArmazem(armazem, atual);
+			if (sala == NULL)
+			{
+				falhou = true;
+				break;
+			}
+			somaArmazem += (int64_t)sala->nome[0] + sala->pista[0];
+
+			bool esquerda = (sortearGeracao(semente, 30 + (uint64_t)partida, passo) & 1) != 0;
+			int32_t proxima = explorarSalaArmazem(armazem, atual, esquerda);
+			passos++;
+			if (proxima <= 0)
+			{
+				falhou = proxima < 0;
+				break;
+			}
+			atual = proxima;
+		}
+	}
+	double tempoPartidas = instanteAtual() - inicio;
+
+	// As mesmas descidas sobre a mansão colunar em memória, para conferir.
+	int64_t passosColunar = 0, somaColunar = 0;
+	for (int32_t partida = 0; partida < partidas; partida++)
+	{
+		int32_t atual = 0;
+		for (uint64_t passo = 0;; passo++)
+		{
+			int32_t pista = colunar->pista[atual];
+			somaColunar += (int64_t)colunar->textos[colunar->nome[atual]][0] + (pista != SEM_INDICE_COLUNAR ? colunar->textos[pista][0] : 0);
+
+			bool esquerda = (sortearGeracao(semente, 30 + (uint64_t)partida, passo) & 1) != 0;
+			int32_t proxima = esquerda ? colunar->esquerda[atual] : colunar->direita[atual];
+			passosColunar++;
+			if (proxima == SEM_INDICE_COLUNAR)
+			{
+				break;
+			}
+			atual = proxima;
+		}
+	}
+
+	double tamanhoArquivo = (double)posicaoPaginaSalas(0) + (double)totalSalas * sizeof(RegistroSalaPaginada);
+	unsigned long long consultas = armazem->acertos + armazem->faltas;
+	printf("\n===== Armazém de salas paginado: %d salas, %d página(s) de %d salas, cache de %d página(s) =====\n",
+		totalSalas, armazem->totalPaginas, SALAS_POR_PAGINA, armazem->capacidade);
+	printf(" • Todas as salas antes da partida: %.1f ms, %.1f MB\n", tempoCompleta * 1000.0, tamanhoArquivo / 1e6);
+	printf(" • Abertura do armazém: %.3f ms, %.1f KB residentes\n", tempoAbertura * 1000.0, (double)memoriaAbertura / 1e3);
+	printf(" • %d partida(s), %lld salas visitadas: %.1f ms, %.0f ns por sala\n",
+		partidas, (long long)passos, tempoPartidas * 1000.0, passos > 0 ? tempoPartidas * 1e9 / (double)passos : 0.0);
+	printf(" • Cache: %.1f%% de acertos | %llu falta(s) | %llu despejo(s) | %llu página(s) antecipada(s)\n",
+		consultas > 0 ? 100.0 * (double)armazem->acertos / (double)consultas : 0.0, armazem->faltas, armazem->despejos, armazem->antecipadas);
+	printf(" • Memória residente ao fim: %.1f KB(%.3f%% do arquivo)\n",
+		(double)memoriaResidenteArmazem(armazem) / 1e3, 100.0 * (double)memoriaResidenteArmazem(armazem) / tamanhoArquivo);
+
+	bool consistente = lidas && !falhou && passos == passosColunar && somaArmazem == somaColunar;
+	if (falhou)
+	{
+		printf("\n  ❌  Erro ao ler uma página do arquivo de salas.\n");
+	}
+	else if (!consistente)
+	{
+		printf("\n  ❌  As salas do armazém divergiram das salas geradas.\n");
+	}
+
+	fecharArmazemSalas(armazem);
+	liberarCasoGerado(caso);
+	remove(caminho);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Catálogo Mapeado ****
+
+/// @brief Recupera a quantidade de faltas de página do processo até agora, ou -1 se não houver suporte.
+static long long faltasPaginaProcesso()
+{
+#ifdef _WIN32
+	return -1;
+#else
+	struct rusage uso;
+	return getrusage(RUSAGE_SELF, &uso) == 0 ? (long long)uso.ru_minflt + uso.ru_majflt : -1;
+#endif
+}
+
+int medirCatalogoMapeado(int32_t totalPistas, int32_t totalSuspeitos)
+{
+	const char* caminho = "detective_quest_catalogo.mapa";
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+
+	if (totalPistas < 1 || totalPistas > MAXIMO_PISTAS_DISTINTAS || totalSuspeitos < 1)
+	{
+		printf("\n  ❌  Quantidades inválidas(pistas: de 1 a %d).\n", MAXIMO_PISTAS_DISTINTAS);
+		return EXIT_FAILURE;
+	}
+
+	// O caso gerado fornece o catálogo, gravado em disco e descartado em seguida.
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, 1024, semente);
+	parametros.totalPistasDistintas = totalPistas;
+	parametros.totalSuspeitos = totalSuspeitos;
+	CasoGerado* caso = gerarCaso(&parametros);
+	bool gravado = caso != NULL && gravarCatalogoMapeavel(caminho, caso->mansao->textos + caso->primeiraPista,
+		caso->suspeitoPista, totalPistas, caso->suspeitos, totalSuspeitos);
+	liberarCasoGerado(caso);
+	if (!gravado)
+	{
+		printf("\n  ❌  Erro ao gerar e gravar o catálogo.\n");
+		remove(caminho);
+		return EXIT_FAILURE;
+	}
+
+	int32_t passoConsulta = totalPistas > 1000 ? totalPistas / 1000 : 1;
+	const char* rotulos[2] = { "Cópia(fread + heap)", "Mapeado(sem cópias)" };
+	double tempoCarga[2] = { 0 }, tempoArvore[2] = { 0 }, tempoConsultas[2] = { 0 };
+	long long faltas[2] = { 0 };
+	size_t heapCatalogo[2] = { 0 }, heapArvore[2] = { 0 }, tamanhoArquivo = 0;
+	uint64_t impressao[2] = { 0xCBF29CE484222325ULL, 0xCBF29CE484222325ULL };
+	int32_t consultas = 0;
+	bool sucesso = true;
+
+	for (int modo = 0; modo < 2 && sucesso; modo++)
+	{
+		// Carga do catálogo na tabela hash: a cópia lê o arquivo inteiro e copia os textos para o heap;
+		// o mapeamento só traz do disco as páginas tocadas, e os nós apontam para elas.
+		long long faltasAntes = faltasPaginaProcesso();
+		double inicio = instanteAtual();
+		CatalogoMapeado* catalogo = abrirCatalogoMapeado(caminho, modo == 1);
+		if (catalogo == NULL)
+		{
+			printf("\n  ❌  Não foi possível abrir o catálogo mapeado '%s'.\n", caminho);
+		}
+		TabelaHash* tabela = alocarTabelaHash(0);
+		sucesso = catalogo != NULL && tabela != NULL && carregarCatalogoMapeado(catalogo, tabela);
+		tempoCarga[modo] = instanteAtual() - inicio;
+		faltas[modo] = faltasAntes >= 0 ? faltasPaginaProcesso() - faltasAntes : -1;
+		heapCatalogo[modo] = tabela != NULL && tabela->textos != NULL ? bytesHeapTextos(tabela->textos) : 0;
+		tamanhoArquivo = catalogo != NULL ? catalogo->arquivo.tamanho : 0;
+
+		// A árvore de pistas guarda o texto internado no próprio heap: no modo mapeado, o endereço no arquivo.
+		HeapTextos* textosArvore = sucesso ? criarHeapTextos() : NULL;
+		sucesso = textosArvore != NULL && (catalogo->arquivo.copiado ||
+			registrarRegiaoMapeada(textosArvore, catalogo->arquivo.bytes, catalogo->arquivo.tamanho));
+		Pista* arvore = NULL;
+		inicio = instanteAtual();
+		for (int32_t i = 0; i < totalPistas && sucesso; i++)
+		{
+			arvore = inserirPista(textosArvore, arvore, pistaCatalogoMapeado(catalogo, i));
+		}
+		tempoArvore[modo] = instanteAtual() - inicio;
+		heapArvore[modo] = textosArvore != NULL ? bytesHeapTextos(textosArvore) : 0;
+
+		// Consultas: as comparações da tabela hash e da árvore usam os bytes onde os textos estão.
+		consultas = 0;
+		inicio = instanteAtual();
+		for (int32_t i = 0; i < totalPistas && sucesso; i += passoConsulta, consultas++)
+		{
+			const char* pista = pistaCatalogoMapeado(catalogo, i);
+			const NoHash* no = buscarNoHash(pista, tabela, NULL);
+			impressao[modo] = acumularImpressaoTexto(impressao[modo], no != NULL ? lerTextoCompacto(&no->suspeito) : NULL);
+			impressao[modo] = impressao[modo] * 31 + (uint64_t)posicaoPista(arvore, pista);
+		}
+		tempoConsultas[modo] = instanteAtual() - inicio;
+
+		// Os nós e os heaps de textos são liberados antes do mapeamento.
+		liberarPista(arvore);
+		if (textosArvore != NULL)
+		{
+			liberarHeapTextos(textosArvore);
+		}
+		liberarTabelaHash(tabela);
+		fecharCatalogoMapeado(catalogo);
+	}
+	remove(caminho);
+
+	if (!sucesso)
+	{
+		printf("\n  ❌  Erro ao carregar o catálogo.\n");
+		return EXIT_FAILURE;
+	}
+
+	printf("\n===== Catálogo mapeado: %d pistas, %d suspeitos, arquivo de %.1f MB =====\n",
+		totalPistas, totalSuspeitos, (double)tamanhoArquivo / 1e6);
+	for (int modo = 0; modo < 2; modo++)
+	{
+		printf(" • %s\n", rotulos[modo]);
+		printf("     Catálogo na tabela hash: %.1f ms, heap de textos de %.1f MB, ", tempoCarga[modo] * 1000.0,
+			(double)heapCatalogo[modo] / 1e6);
+		if (faltas[modo] >= 0)
+		{
+			printf("%lld falta(s) de página\n", faltas[modo]);
+		}
+		else
+		{
+			printf("faltas de página indisponíveis\n");
+		}
+		printf("     Árvore de pistas: %.1f ms, mais %.1f MB no heap de textos(chaves de colação e conjunto de textos)\n",
+			tempoArvore[modo] * 1000.0, (double)heapArvore[modo] / 1e6);
+		printf("     %d consulta(s) na tabela hash e na árvore: %.1f us por consulta\n",
+			consultas, consultas > 0 ? tempoConsultas[modo] * 1e6 / consultas : 0.0);
+	}
+
+	bool consistente = impressao[0] == impressao[1];
+	if (!consistente)
+	{
+		printf("\n  ❌  As consultas divergiram entre a cópia e o mapeamento.\n");
+	}
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Hash Perfeito ****
+
+int medirHashPerfeito(int32_t totalPistas)
+{
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+
+	if (totalPistas < 1 || totalPistas > MAXIMO_PISTAS_DISTINTAS)
+	{
+		printf("\n  ❌  Quantidade inválida(pistas: de 1 a %d).\n", MAXIMO_PISTAS_DISTINTAS);
+		return EXIT_FAILURE;
+	}
+
+	// As pistas geradas além do catálogo são as chaves estrangeiras: o índice deve rejeitar todas.
+	int32_t totalEstrangeiras = totalPistas <= MAXIMO_PISTAS_DISTINTAS / 2 ? totalPistas : MAXIMO_PISTAS_DISTINTAS - totalPistas;
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, 1024, semente);
+	parametros.totalPistasDistintas = totalPistas + totalEstrangeiras;
+	CasoGerado* caso = gerarCaso(&parametros);
+	TabelaHash* catalogo = alocarTabelaHash(0);
+	uint64_t* ocupadas = (uint64_t*)calloc(((size_t)totalPistas + 63) / 64, sizeof(uint64_t));
+	if (caso == NULL || catalogo == NULL || ocupadas == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		liberarCasoGerado(caso);
+		liberarTabelaHash(catalogo);
+		free(ocupadas);
+		return EXIT_FAILURE;
+	}
+	const char* const* pistas = caso->mansao->textos + caso->primeiraPista;
+	const char* const* estrangeiras = pistas + totalPistas;
+
+	// Construção isolada, e conferência de que as posições formam uma permutação de [0, pistas).
+	double inicio = instanteAtual();
+	HashPerfeito* hash = construirHashPerfeito(pistas, totalPistas, semente);
+	double tempoConstrucao = instanteAtual() - inicio;
+	bool consistente = hash != NULL;
+	for (int32_t i = 0; i < totalPistas && consistente; i++)
+	{
+		int32_t posicao = posicaoHashPerfeito(hash, pistas[i]);
+		consistente = posicao >= 0 && posicao < totalPistas && (ocupadas[posicao / 64] & (1ULL << (posicao % 64))) == 0;
+		if (consistente)
+		{
+			ocupadas[posicao / 64] |= 1ULL << (posicao % 64);
+		}
+	}
+
+	// Consultas no catálogo: pelas listas encadeadas(uma amostra, que as listas são longas) e pelo índice.
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		inserirNoHash(pistas[i], caso->suspeitos[caso->suspeitoPista[i]], catalogo);
+	}
+	int32_t passoAmostra = totalPistas > 1000 ? totalPistas / 1000 : 1;
+	int32_t amostra = 0;
+	uint64_t impressaoListas = 0, impressaoIndice = 0;
+	inicio = instanteAtual();
+	for (int32_t i = 0; i < totalPistas; i += passoAmostra, amostra++)
+	{
+		impressaoListas = impressaoListas * 31 + (uintptr_t)buscarNoHash(pistas[i], catalogo, NULL);
+	}
+	double tempoListas = instanteAtual() - inicio;
+
+	consistente = consistente && indexarTabelaHashPerfeita(catalogo);
+	for (int32_t i = 0; i < totalPistas && consistente; i += passoAmostra)
+	{
+		impressaoIndice = impressaoIndice * 31 + (uintptr_t)buscarNoHash(pistas[i], catalogo, NULL);
+	}
+	consistente = consistente && impressaoIndice == impressaoListas && buscarNoHash("pista fora do catálogo", catalogo, NULL) == NULL;
+
+	// Uma chave estrangeira também cai em uma posição válida: quem rejeita é a comparação com a chave guardada.
+	// As quase iguais(uma pista do catálogo com um espaço a mais) só diferem no último byte.
+	char quaseIgual[TAMANHO_MAX_PISTA + 1];
+	int32_t rejeitadas = 0;
+	for (int32_t i = 0; i < totalEstrangeiras && consistente; i++)
+	{
+		int32_t posicao = posicaoHashPerfeito(hash, estrangeiras[i]);
+		snprintf(quaseIgual, sizeof(quaseIgual), "%s ", pistas[i % totalPistas]);
+		consistente = posicao >= 0 && posicao < totalPistas;
+		rejeitadas += buscarNoHash(estrangeiras[i], catalogo, NULL) == NULL && buscarNoHash(quaseIgual, catalogo, NULL) == NULL;
+	}
+	consistente = consistente && rejeitadas == totalEstrangeiras;
+
+	int rodadas = 0;
+	int64_t encontradas = 0;
+	double tempoIndice;
+	inicio = instanteAtual();
+	do
+	{
+		for (int32_t i = 0; i < totalPistas && consistente; i++)
+		{
+			encontradas += buscarNoHash(pistas[i], catalogo, NULL) != NULL;
+		}
+		rodadas++;
+		tempoIndice = instanteAtual() - inicio;
+	} while (tempoIndice < 0.2 && consistente);
+	consistente = consistente && encontradas == (int64_t)rodadas * totalPistas;
+
+	printf("\n===== Hash perfeito mínimo: %d pistas =====\n", totalPistas);
+	if (hash != NULL)
+	{
+		printf(" • Construção: %.1f ms, %.0f ns por pista\n", tempoConstrucao * 1000.0, tempoConstrucao * 1e9 / totalPistas);
+		printf(" • Tamanho: %.2f bits por pista(%u baldes, pilotos de %u bits, %u posições excedentes remapeadas)\n",
+			bitsPorChaveHashPerfeito(hash), hash->totalBaldes, hash->bitsPiloto, hash->totalPosicoes - hash->totalChaves);
+	}
+	printf(" • Listas encadeadas(%d baldes): %.1f us por consulta(%d consultas)\n",
+		TAMANHO_TABELA_HASH, amostra > 0 ? tempoListas * 1e6 / amostra : 0.0, amostra);
+	printf(" • Índice perfeito: %.0f ns por consulta(um hash, um acesso e uma comparação)\n",
+		tempoIndice * 1e9 / ((double)rodadas * totalPistas));
+	printf(" • Chaves fora do catálogo: %d rejeitadas de %d(e as quase iguais)\n", rejeitadas, totalEstrangeiras);
+	if (!consistente)
+	{
+		printf("\n  ❌  O índice perfeito divergiu das listas, aceitou uma chave fora do catálogo, ou as posições não formam uma permutação.\n");
+	}
+
+	liberarHashPerfeito(hash);
+	liberarTabelaHash(catalogo);
+	liberarCasoGerado(caso);
+	free(ocupadas);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Motor do Jogo ****
+
+int medirMotorJogo(int32_t partidas, uint64_t semente)
+{
+	// Limite de comandos por partida: o passeio aleatório pode não liberar o culpado tão cedo.
+	const int32_t maximoComandos = 512;
+
+	if (partidas < 1)
+	{
+		printf("\n  ❌  Quantidade inválida(partidas: ao menos 1).\n");
+		return EXIT_FAILURE;
+	}
+
+	DescricaoSalaMotor salas[TOTAL_SALAS_CASO];
+	int32_t grupos[TOTAL_CATALOGO_CASO];
+	DescricaoCasoMotor caso;
+	descreverCasoMotor(salas, grupos, &caso);
+
+	MotorJogo* motor = NULL;
+	StatusMotor status = criarMotorJogo(&caso, semente, &motor);
+	if (status != StatusMotor_OK)
+	{
+		printf("\n  ❌  Erro ao tentar criar o motor do jogo: %s\n", descreverStatusMotor(status));
+		return EXIT_FAILURE;
+	}
+
+	int64_t comandos = 0, eventos = 0, acertos = 0, erros = 0, resolvidas = 0;
+	bool consistente = true;
+	double inicio = instanteAtual();
+	EventoMotor evento;
+	for (int32_t partida = 0; partida < partidas && consistente; partida++)
+	{
+		consistente = reiniciarMotorJogo(motor, semente + (uint64_t)partida) == StatusMotor_OK;
+		for (int32_t passo = 0; passo < maximoComandos && !encerradoMotorJogo(motor); passo++)
+		{
+			coletarPistaMotorJogo(motor);
+			comandos++;
+
+			// A acusação vai para o primeiro suspeito liberado nesta coleta.
+			int32_t liberado = SEM_INDICE_MOTOR;
+			while (proximoEventoMotorJogo(motor, &evento))
+			{
+				eventos++;
+				if (evento.tipo == EventoMotor_ACUSACAO_LIBERADA && liberado == SEM_INDICE_MOTOR)
+				{
+					liberado = evento.suspeito;
+				}
+			}
+			if (liberado != SEM_INDICE_MOTOR)
+			{
+				bool culpado = false;
+				consistente = consistente && acusarMotorJogo(motor, liberado, &culpado) == StatusMotor_OK;
+				comandos++;
+				acertos += culpado;
+				erros += !culpado;
+				if (culpado)
+				{
+					resolvidas++;
+					break;
+				}
+			}
+
+			DirecaoMotor direcao = (sortearGeracao(semente, (uint64_t)partida, (uint64_t)passo) & 1) != 0 ?
+				DirecaoMotor_DIREITA : DirecaoMotor_ESQUERDA;
+			status = moverMotorJogo(motor, direcao);
+			consistente = consistente && (status == StatusMotor_OK || status == StatusMotor_SEM_SAIDA);
+			comandos++;
+		}
+		while (proximoEventoMotorJogo(motor, &evento))
+		{
+			eventos++;
+		}
+	}
+	double tempo = instanteAtual() - inicio;
+
+	printf("\n===== Motor do jogo: %d partidas automáticas =====\n", partidas);
+	printf(" • Comandos: %lld(%.0f ns por comando, %.1f por partida)\n", (long long)comandos,
+		comandos > 0 ? tempo * 1e9 / (double)comandos : 0.0, (double)comandos / partidas);
+	printf(" • Eventos consumidos: %lld\n", (long long)eventos);
+	printf(" • Acusações: %lld corretas, %lld erradas; partidas resolvidas: %lld\n",
+		(long long)acertos, (long long)erros, (long long)resolvidas);
+	if (!consistente)
+	{
+		printf("\n  ❌  O motor recusou um comando válido.\n");
+	}
+
+	liberarMotorJogo(motor);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Índice de Salas por Nome ****
+
+int medirIndiceSalas(int32_t totalSalas)
+{
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+	const int32_t totalConsultas = 4096;
+	const int32_t totalVarreduras = 8;
+
+	if (totalSalas < 1)
+	{
+		printf("\n  ❌  Quantidade inválida(salas: ao menos 1).\n");
+		return EXIT_FAILURE;
+	}
+
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, totalSalas, semente);
+	CasoGerado* caso = gerarCaso(&parametros);
+	const char** consultas = (const char**)malloc((size_t)totalConsultas * sizeof(const char*));
+	char(*prefixos)[TAMANHO_MAX_NOME] = (char(*)[TAMANHO_MAX_NOME])malloc((size_t)totalConsultas * TAMANHO_MAX_NOME);
+	if (caso == NULL || consultas == NULL || prefixos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		liberarCasoGerado(caso);
+		free(consultas);
+		free(prefixos);
+		return EXIT_FAILURE;
+	}
+	const MansaoColunar* mansao = caso->mansao;
+
+	double inicio = instanteAtual();
+	IndiceSalas* indice = criarIndiceSalas(mansao->textos, mansao->totalTextos, mansao->nome, mansao->totalSalas);
+	double tempoMontagem = instanteAtual() - inicio;
+	if (indice == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar montar o índice das salas.\n");
+		liberarCasoGerado(caso);
+		free(consultas);
+		free(prefixos);
+		return EXIT_FAILURE;
+	}
+
+	// Conferência: cada sala está entre as do seu nome, que vêm em ordem de índice(amostra nas mansões grandes).
+	bool consistente = buscarSalasPorNome(indice, "sala inexistente", NULL) == 0;
+	int32_t passoAmostra = totalSalas > 1000000 ? totalSalas / 1000000 : 1;
+	for (int32_t i = 0; i < totalSalas && consistente; i += passoAmostra)
+	{
+		const int32_t* salas;
+		int32_t total = buscarSalasPorNome(indice, mansao->textos[mansao->nome[i]], &salas);
+		int32_t a = 0, b = total;
+		while (a < b)
+		{
+			int32_t meio = a + (b - a) / 2;
+			if (salas[meio] < i)
+			{
+				a = meio + 1;
+			}
+			else
+			{
+				b = meio;
+			}
+		}
+		consistente = a < total && salas[a] == i;
+	}
+
+	// Consultas com os nomes e prefixos(de 3 a 8 bytes) de salas sorteadas.
+	for (int32_t i = 0; i < totalConsultas; i++)
+	{
+		uint64_t sorteio = sortearGeracao(semente, 1, (uint64_t)i);
+		consultas[i] = mansao->textos[mansao->nome[reduzirSorteio(sorteio, (uint32_t)totalSalas)]];
+		copiarTextoLimitado(prefixos[i], 4 + (sorteio & 7) % 6, consultas[i]);
+	}
+
+	int64_t buscas = 0, encontradas = 0;
+	double tempoBuscas;
+	inicio = instanteAtual();
+	do
+	{
+		for (int32_t i = 0; i < totalConsultas; i++)
+		{
+			encontradas += buscarSalasPorNome(indice, consultas[i], NULL) > 0;
+		}
+		buscas += totalConsultas;
+		tempoBuscas = instanteAtual() - inicio;
+	} while (tempoBuscas < 0.2);
+	consistente = consistente && encontradas == buscas;
+
+	int64_t complementacoes = 0, nomesComplementados = 0;
+	double tempoComplementacao;
+	char comum[TAMANHO_MAX_NOME];
+	inicio = instanteAtual();
+	do
+	{
+		for (int32_t i = 0; i < totalConsultas; i++)
+		{
+			int32_t primeiro;
+			nomesComplementados += completarNomeSala(indice, prefixos[i], &primeiro, comum, sizeof(comum));
+		}
+		complementacoes += totalConsultas;
+		tempoComplementacao = instanteAtual() - inicio;
+	} while (tempoComplementacao < 0.2);
+
+	// Sem o índice, achar uma sala pelo nome é percorrer as salas até ela: poucas varreduras bastam.
+	int64_t varridas = 0;
+	inicio = instanteAtual();
+	for (int32_t v = 0; v < totalVarreduras; v++)
+	{
+		for (int32_t i = 0; i < totalSalas; i++)
+		{
+			if (strcmp(mansao->textos[mansao->nome[i]], consultas[v]) == 0)
+			{
+				varridas += i + 1;
+				break;
+			}
+		}
+	}
+	double tempoVarredura = instanteAtual() - inicio;
+
+	double nsBusca = tempoBuscas * 1e9 / (double)buscas;
+	double nsVarredura = tempoVarredura * 1e9 / totalVarreduras;
+	printf("\n===== Índice de salas por nome: %d salas =====\n", totalSalas);
+	printf(" • Nomes distintos: %d(%.1f salas por nome)\n", indice->totalNomes, (double)totalSalas / indice->totalNomes);
+	printf(" • Montagem: %.1f ms, %.0f ns por sala\n", tempoMontagem * 1000.0, tempoMontagem * 1e9 / totalSalas);
+	printf(" • Memória: %.1f MB(%.1f bytes por sala)\n", memoriaIndiceSalas(indice) / (1024.0 * 1024.0),
+		(double)memoriaIndiceSalas(indice) / totalSalas);
+	printf(" • Busca por nome: %.0f ns por consulta\n", nsBusca);
+	printf(" • Complementação de prefixo: %.0f ns por consulta(%.1f nomes por prefixo, em média)\n",
+		tempoComplementacao * 1e9 / (double)complementacoes, (double)nomesComplementados / (double)complementacoes);
+	printf(" • Varredura das salas, sem o índice: %.2f ms por consulta(%.0f salas lidas; %.0fx a busca pelo índice)\n",
+		nsVarredura / 1e6, (double)varridas / totalVarreduras, nsBusca > 0 ? nsVarredura / nsBusca : 0.0);
+	if (!consistente)
+	{
+		printf("\n  ❌  O índice divergiu das salas da mansão.\n");
+	}
+
+	liberarIndiceSalas(indice);
+	liberarCasoGerado(caso);
+	free(consultas);
+	free(prefixos);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções das Versões da Árvore de Pistas ****
+
+int medirVersoesPistas(int32_t totalPistas, int32_t totalVersoes)
+{
+	const int32_t totalCopias = 4;
+
+	if (totalPistas < 1 || totalVersoes < 1 || (int64_t)totalPistas + totalVersoes > MAXIMO_PISTAS_DISTINTAS)
+	{
+		printf("\n  ❌  Quantidades inválidas(pistas e versões: ao menos 1, somando até %d).\n", MAXIMO_PISTAS_DISTINTAS);
+		return EXIT_FAILURE;
+	}
+
+	// As pistas da base e as das versões são distintas: cada versão acrescenta uma pista nova.
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, 1024, 0x9E3779B97F4A7C15ULL);
+	parametros.totalPistasDistintas = totalPistas + totalVersoes;
+	CasoGerado* caso = gerarCaso(&parametros);
+	Pista** versoes = (Pista**)calloc((size_t)totalVersoes, sizeof(Pista*));
+	HeapTextos* textos = criarHeapTextos(); // Compartilhado pela base e pelas versões.
+	if (caso == NULL || versoes == NULL || textos == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		liberarCasoGerado(caso);
+		free(versoes);
+		liberarHeapTextos(textos);
+		return EXIT_FAILURE;
+	}
+	const char* const* pistas = caso->mansao->textos + caso->primeiraPista;
+	const char* const* novas = pistas + totalPistas;
+
+	size_t nosAntes = nosPistaAlocados();
+	double inicio = instanteAtual();
+	Pista* base = NULL;
+	for (int32_t i = 0; i < totalPistas; i++)
+	{
+		base = inserirPista(textos, base, pistas[i]);
+	}
+	double tempoMontagem = instanteAtual() - inicio;
+	size_t nosBase = nosPistaAlocados() - nosAntes;
+
+	// Ramificação: um instantâneo da base(uma referência) e a inserção, que copia apenas o caminho.
+	inicio = instanteAtual();
+	for (int32_t j = 0; j < totalVersoes; j++)
+	{
+		versoes[j] = inserirPista(textos, reterPista(base), novas[j]);
+	}
+	double tempoVersoes = instanteAtual() - inicio;
+	size_t nosVersoes = nosPistaAlocados() - nosAntes - nosBase;
+	// Compartilhamento: cada versão copia no máximo o caminho da inserção(altura da base, mais a folha nova).
+	bool compartilhadas = base == NULL || nosVersoes <= (size_t)totalVersoes * (size_t)(base->altura + 2);
+
+	// Conferência: cada versão tem a base mais a sua pista, e a base não mudou(amostra nas medições grandes).
+	bool consistente = compartilhadas && tamanhoPista(base) == totalPistas;
+	int32_t passoAmostra = totalVersoes > 1000 ? totalVersoes / 1000 : 1;
+	for (int32_t j = 0; j < totalVersoes && consistente; j += passoAmostra)
+	{
+		consistente = tamanhoPista(versoes[j]) == totalPistas + 1 &&
+			buscarPista(versoes[j], novas[j]) != NULL &&
+			buscarPista(versoes[j], pistas[j % totalPistas]) != NULL &&
+			buscarPista(base, novas[j]) == NULL;
+	}
+
+	// Sem persistência, cada instantâneo é uma cópia de todos os nós.
+	double tempoCopias = 0.0;
+	for (int32_t c = 0; c < totalCopias && consistente; c++)
+	{
+		inicio = instanteAtual();
+		Pista* copia = copiarPistaCompleta(base);
+		tempoCopias += instanteAtual() - inicio;
+		consistente = tamanhoPista(copia) == totalPistas;
+		liberarPista(copia);
+	}
+
+	// Desfazer é devolver a referência da versão: só os nós do seu caminho são liberados.
+	inicio = instanteAtual();
+	for (int32_t j = 0; j < totalVersoes; j++)
+	{
+		liberarPista(versoes[j]);
+	}
+	double tempoDesfazer = instanteAtual() - inicio;
+	consistente = consistente && nosPistaAlocados() - nosAntes == nosBase && tamanhoPista(base) == totalPistas;
+
+	double nosPorVersao = (double)nosVersoes / totalVersoes;
+	double nsVersao = tempoVersoes * 1e9 / totalVersoes;
+	double nsCopia = tempoCopias * 1e9 / totalCopias;
+	printf("\n===== Versões da árvore de pistas: %d pistas, %d versões =====\n", totalPistas, totalVersoes);
+	printf(" • Base: %.1f ms(%.0f ns por pista), altura %d, %.1f MB\n", tempoMontagem * 1000.0,
+		tempoMontagem * 1e9 / totalPistas, base != NULL ? base->altura : 0,
+		(double)nosBase * custoAlocacao(sizeof(Pista)) / (1024.0 * 1024.0));
+	printf(" • Ramificação(instantâneo e inserção): %.0f ns por versão, %.1f nós novos(%.0f bytes)\n",
+		nsVersao, nosPorVersao, nosPorVersao * custoAlocacao(sizeof(Pista)));
+	printf(" • Desfazer(devolver a versão): %.0f ns por versão\n", tempoDesfazer * 1e9 / totalVersoes);
+	printf(" • Cópia completa, sem persistência: %.2f ms por instantâneo, %.1f MB(%.0fx o tempo da ramificação)\n",
+		nsCopia / 1e6, (double)nosBase * custoAlocacao(sizeof(Pista)) / (1024.0 * 1024.0), nsVersao > 0 ? nsCopia / nsVersao : 0.0);
+	if (!consistente)
+	{
+		printf("\n  ❌  As versões divergiram da árvore base, ou copiaram mais que o caminho da inserção.\n");
+	}
+
+	liberarPista(base);
+	liberarHeapTextos(textos);
+	liberarCasoGerado(caso);
+	free(versoes);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções da Avaliação Paralela das Acusações ****
+
+int medirAcusacoes(int32_t totalSalas, int32_t totalSuspeitos, int totalThreads, int32_t pistasRequeridas)
+{
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+	const int32_t totalAmostras = 256;
+
+	if (totalSalas < 1 || totalSuspeitos < 1 || pistasRequeridas < 1 ||
+		totalThreads < 0 || totalThreads > MAXIMO_THREADS_ACUSACOES)
+	{
+		printf("\n  ❌  Quantidades inválidas(threads: de 0 a %d).\n", MAXIMO_THREADS_ACUSACOES);
+		return EXIT_FAILURE;
+	}
+	if (totalThreads == 0)
+	{
+		totalThreads = contarProcessadores() < MAXIMO_THREADS_ACUSACOES ? contarProcessadores() : MAXIMO_THREADS_ACUSACOES;
+	}
+
+	ParametrosGeracao parametros;
+	iniciarParametrosGeracao(&parametros, totalSalas, semente);
+	parametros.totalSuspeitos = totalSuspeitos;
+	CasoGerado* caso = gerarCaso(&parametros);
+	if (caso == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar gerar a mansão.\n");
+		return EXIT_FAILURE;
+	}
+
+	double inicio = instanteAtual();
+	TabelaAcusacoes* sequencial = avaliarAcusacoes(caso, pistasRequeridas, 1);
+	double tempoSequencial = instanteAtual() - inicio;
+	inicio = instanteAtual();
+	TabelaAcusacoes* paralela = avaliarAcusacoes(caso, pistasRequeridas, totalThreads);
+	double tempoParalelo = instanteAtual() - inicio;
+	int32_t* origem = (int32_t*)malloc((size_t)totalSalas * sizeof(int32_t));
+	int32_t* contagem = (int32_t*)malloc((size_t)totalSuspeitos * sizeof(int32_t));
+	int32_t* marcas = (int32_t*)malloc((size_t)caso->totalPistasDistintas * sizeof(int32_t));
+	if (sequencial == NULL || paralela == NULL || origem == NULL || contagem == NULL || marcas == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a avaliação.\n");
+		liberarTabelaAcusacoes(sequencial);
+		liberarTabelaAcusacoes(paralela);
+		free(origem);
+		free(contagem);
+		free(marcas);
+		liberarCasoGerado(caso);
+		return EXIT_FAILURE;
+	}
+
+	// Conferência: as duas tabelas são iguais, e uma amostra das salas confere com a contagem das pistas
+	// distintas do caminho desde a entrada, refeita pelas salas de origem.
+	size_t bytesTabela = (size_t)totalSalas * paralela->palavras * sizeof(uint64_t);
+	bool consistente = memcmp(sequencial->acusaveis, paralela->acusaveis, bytesTabela) == 0;
+	const MansaoColunar* mansao = caso->mansao;
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		origem[i] = -1;
+	}
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		if (mansao->esquerda[i] != SEM_INDICE_COLUNAR)
+		{
+			origem[mansao->esquerda[i]] = i;
+		}
+		if (mansao->direita[i] != SEM_INDICE_COLUNAR)
+		{
+			origem[mansao->direita[i]] = i;
+		}
+	}
+	for (int32_t k = 0; k < caso->totalPistasDistintas; k++)
+	{
+		marcas[k] = -1;
+	}
+	for (int32_t a = 0; a < totalAmostras && consistente; a++)
+	{
+		int32_t sala = (int32_t)reduzirSorteio(sortearGeracao(semente, 2, (uint64_t)a), (uint32_t)totalSalas);
+		memset(contagem, 0, (size_t)totalSuspeitos * sizeof(int32_t));
+		for (int32_t s = sala; s >= 0; s = origem[s])
+		{
+			int32_t texto = mansao->pista[s];
+			if (texto != SEM_INDICE_COLUNAR && marcas[texto - caso->primeiraPista] != a)
+			{
+				marcas[texto - caso->primeiraPista] = a;
+				contagem[caso->suspeitoPista[texto - caso->primeiraPista]]++;
+			}
+		}
+		for (int32_t s = 0; s < totalSuspeitos && consistente; s++)
+		{
+			consistente = acusacaoPermitida(paralela, sala, s) == (contagem[s] >= pistasRequeridas);
+		}
+	}
+
+	int64_t paresAcusaveis = 0, salasComAcusacao = 0;
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		uint64_t alguma = 0;
+		for (int32_t w = 0; w < paralela->palavras; w++)
+		{
+			uint64_t palavra = paralela->acusaveis[(size_t)i * paralela->palavras + w];
+			paresAcusaveis += contarBitsPalavra(palavra);
+			alguma |= palavra;
+		}
+		salasComAcusacao += alguma != 0;
+	}
+
+	double aceleracao = tempoParalelo > 0 ? tempoSequencial / tempoParalelo : 0.0;
+	printf("\n===== Avaliação das acusações: %d salas, %d suspeitos, %d pistas requeridas =====\n",
+		totalSalas, totalSuspeitos, pistasRequeridas);
+	printf(" • Divisão: %d salas acima das subárvores, %d tarefas(subárvore e bloco de 64 suspeitos)\n",
+		paralela->salasDivisao, paralela->totalTarefas);
+	printf(" • 1 thread: %.1f ms(%.1f ns por sala)\n", tempoSequencial * 1000.0, tempoSequencial * 1e9 / totalSalas);
+	printf(" • %d threads: %.1f ms(%.1f ns por sala), aceleração de %.2fx(eficiência de %.0f%%)\n",
+		paralela->totalThreads, tempoParalelo * 1000.0, tempoParalelo * 1e9 / totalSalas,
+		aceleracao, 100.0 * aceleracao / paralela->totalThreads);
+	printf(" • Tabela: %.1f MB(%d bits por sala)\n", bytesTabela / (1024.0 * 1024.0), paralela->palavras * 64);
+	printf(" • Acusações permitidas: %.1f%% dos pares sala-suspeito, em %.1f%% das salas\n",
+		100.0 * (double)paresAcusaveis / ((double)totalSalas * totalSuspeitos), 100.0 * (double)salasComAcusacao / totalSalas);
+	if (!consistente)
+	{
+		printf("\n  ❌  A tabela das acusações divergiu da contagem das pistas pelo caminho.\n");
+	}
+
+	liberarTabelaAcusacoes(sequencial);
+	liberarTabelaAcusacoes(paralela);
+	free(origem);
+	free(contagem);
+	free(marcas);
+	liberarCasoGerado(caso);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções dos Histogramas de Latência ****
+
+/// @brief Compara duas latências, para qsort.
+static int compararLatencias(const void* a, const void* b)
+{
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+	return (x > y) - (x < y);
+}
+
+int medirHistogramaLatencia(int32_t totalAmostras)
+{
+	const uint64_t semente = 0x9E3779B97F4A7C15ULL;
+	const double fracoes[] = { 0.50, 0.90, 0.99, 0.999, 0.9999 };
+	const int totalFracoes = (int)(sizeof(fracoes) / sizeof(fracoes[0]));
+
+	if (totalAmostras < 1)
+	{
+		printf("\n  ❌  Quantidade inválida(amostras: ao menos 1).\n");
+		return EXIT_FAILURE;
+	}
+
+	uint64_t* latencias = (uint64_t*)malloc((size_t)totalAmostras * sizeof(uint64_t));
+	HistogramaLatencia* histograma = (HistogramaLatencia*)calloc(1, sizeof(HistogramaLatencia));
+	if (latencias == NULL || histograma == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a medição.\n");
+		free(latencias);
+		free(histograma);
+		return EXIT_FAILURE;
+	}
+
+	// Latências sintéticas de cauda longa: de dezenas de nanossegundos a segundos.
+	for (int32_t i = 0; i < totalAmostras; i++)
+	{
+		uint64_t sorteio = sortearGeracao(semente, 3, (uint64_t)i);
+		uint64_t deslocamento = (sorteio >> 10) % 8 == 0 ? 4 + (sorteio >> 13) % 20 : (sorteio >> 13) % 4; // Um oitavo na cauda.
+		latencias[i] = ((sorteio & 0x3FF) + 16) << deslocamento;
+	}
+
+	double inicio = instanteAtual();
+	for (int32_t i = 0; i < totalAmostras; i++)
+	{
+		registrarLatencia(histograma, latencias[i]);
+	}
+	double tempoRegistro = instanteAtual() - inicio;
+
+	// Cada comando medido lê o relógio duas vezes e registra uma latência. O relógio nunca volta.
+	uint64_t anterior = 0;
+	bool monotonico = true;
+	inicio = instanteAtual();
+	for (int32_t i = 0; i < totalAmostras; i++)
+	{
+		uint64_t agora = instanteLatencia();
+		monotonico = monotonico && agora >= anterior;
+		anterior = agora;
+	}
+	double tempoRelogio = instanteAtual() - inicio;
+
+	// Conferência: o percentil do histograma fica na faixa do exato, até 1/64 acima dele.
+	qsort(latencias, (size_t)totalAmostras, sizeof(uint64_t), compararLatencias);
+	bool consistente = monotonico && histograma->total == (uint64_t)totalAmostras &&
+		histograma->maximo == latencias[totalAmostras - 1];
+	double maiorErro = 0.0;
+	printf("\n===== Histograma de latências: %d amostras =====\n", totalAmostras);
+	printf(" • Memória: %.1f KB por histograma(%d faixas)\n", sizeof(HistogramaLatencia) / 1024.0, FAIXAS_LATENCIA);
+	printf(" • Registro: %.1f ns por latência | Leitura do relógio: %.1f ns | Custo por comando medido: %.1f ns\n",
+		tempoRegistro * 1e9 / totalAmostras, tempoRelogio * 1e9 / totalAmostras,
+		(tempoRegistro + 2 * tempoRelogio) * 1e9 / totalAmostras);
+	for (int f = 0; f < totalFracoes; f++)
+	{
+		uint64_t alvo = (uint64_t)ceil(fracoes[f] * (double)totalAmostras);
+		uint64_t exato = latencias[(alvo < 1 ? 1 : alvo) - 1];
+		uint64_t aproximado = percentilLatencia(histograma, fracoes[f]);
+		double erro = exato > 0 ? ((double)aproximado - (double)exato) / (double)exato : 0.0;
+		maiorErro = erro > maiorErro ? erro : maiorErro;
+		consistente = consistente && aproximado >= exato && aproximado - exato <= exato / SUBFAIXAS_LATENCIA;
+
+		char textoExato[24], textoAproximado[24];
+		formatarLatencia(textoExato, sizeof(textoExato), exato);
+		formatarLatencia(textoAproximado, sizeof(textoAproximado), aproximado);
+		printf(" • p%g: %s(exato: %s)\n", fracoes[f] * 100.0, textoAproximado, textoExato);
+	}
+	printf(" • Maior erro relativo dos percentis: %.2f%%(limite: %.2f%%)\n", maiorErro * 100.0, 100.0 / SUBFAIXAS_LATENCIA);
+	if (!consistente)
+	{
+		printf("\n  ❌  Os percentis do histograma divergiram dos exatos.\n");
+	}
+
+	free(latencias);
+	free(histograma);
+	return consistente ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções do Diário de Jogo ****
+
+void exibirEstadoRepeticao(const EstadoRepeticao* estado)
+{
+	printf("\n===== Sessão %llu =====\n", (unsigned long long)estado->sessao);
+	printf(" • Verdadeiro culpado: %s\n", SUSPEITOS_CASO[estado->culpado]);
+	printf(" • Local atual: %s\n", lerTextoCompacto(&SALAS_CASO[estado->sala].nome));
+	printf(" • Movimentos: %d (retornos à entrada: %d, desfeitos: %d)\n", estado->movimentos, estado->retornos, estado->desfeitos);
+	printf(" • Pistas coletadas: %d\n", estado->totalPistas);
+
+	for (int i = 0; i < TOTAL_SALAS_CASO; i++)
+	{
+		if (estado->pistasColetadas[i >> 3] & (1u << (i & 7)))
+		{
+			printf("    - %s ➜ %s\n", lerTextoCompacto(&SALAS_CASO[i].nome), lerTextoCompacto(&SALAS_CASO[i].pista));
+		}
+	}
+
+	for (int i = 0; i < TOTAL_SUSPEITOS_CASO; i++)
+	{
+		if (estado->pistasPorSuspeito[i] > 0)
+		{
+			printf(" • [%s] %d pista(s)\n", SUSPEITOS_CASO[i], estado->pistasPorSuspeito[i]);
+		}
+	}
+
+	printf(" • Acusações: %d", estado->acusacoes);
+	if (estado->acusado >= 0)
+	{
+		printf(" (última: %s, %s)", SUSPEITOS_CASO[estado->acusado], estado->resolvida ? "caso resolvido" : "incorreta");
+	}
+	printf("\n");
+
+	printf(" • Situação: %s\n", !estado->encerrada ? "em andamento"
+		: estado->desfecho == DesfechoSessao_JOGAR_NOVAMENTE ? "encerrada(jogar novamente)" : "encerrada(sair)");
+}
+
+int executarRepeticaoDiario(int argc, char* argv[])
+{
+	const char* caminho = argc > 0 ? argv[0] : getenv(VARIAVEL_DIARIO_JOGO);
+	uint64_t sessao = argc > 1 ? strtoull(argv[1], NULL, 10) : 0;
+
+	if (caminho == NULL)
+	{
+		printf("\n  ❌  Informe o arquivo do diário, ou defina %s.\n", VARIAVEL_DIARIO_JOGO);
+		return EXIT_FAILURE;
+	}
+
+	FILE* arquivo = fopen(caminho, "rb");
+	if (arquivo == NULL)
+	{
+		printf("\n  ❌  Não foi possível abrir o diário '%s'.\n", caminho);
+		return EXIT_FAILURE;
+	}
+
+	EstadoRepeticao estado;
+	EstatisticasRepeticao estatisticas;
+
+	double inicio = instanteAtual();
+	bool encontrada = repetirDiario(arquivo, sessao, TOTAL_SALAS_CASO, TOTAL_SUSPEITOS_CASO, &estado, &estatisticas);
+	double segundos = instanteAtual() - inicio;
+	fclose(arquivo);
+
+	if (!encontrada)
+	{
+		printf("\n  ❌  Sessão não encontrada no diário '%s'.\n", caminho);
+		return EXIT_FAILURE;
+	}
+
+	exibirEstadoRepeticao(&estado);
+
+	printf("\n===== Repetição do diário =====\n");
+	printf(" • Registros lidos: %llu | Aplicados: %llu | Inválidos: %llu\n",
+		estatisticas.lidos, estatisticas.eventos, estatisticas.invalidos);
+	printf(" • Tempo: %.2f ms | Vazão: %.1f milhões de registros/s\n",
+		segundos * 1000.0, segundos > 0 ? (double)estatisticas.lidos / segundos / 1e6 : 0.0);
+
+	return EXIT_SUCCESS;
+}
+
+int medirDiario(long long totalEventos, int registrosPorSincronizacao)
+{
+	const char* caminho = "detective_quest_medicao.diario";
+
+	if (totalEventos < 1)
+	{
+		printf("\n  ❌  Quantidade de eventos inválida.\n");
+		return EXIT_FAILURE;
+	}
+
+	DiarioJogo* diario = (DiarioJogo*)malloc(sizeof(DiarioJogo));
+	remove(caminho);
+	if (diario == NULL || !abrirDiario(diario, caminho, registrosPorSincronizacao))
+	{
+		printf("\n  ❌  Não foi possível criar o diário de medição '%s'.\n", caminho);
+		free(diario);
+		return EXIT_FAILURE;
+	}
+
+	// Partidas aleatórias sobre a mansão do caso: início, movimentos com coletas, acusação e fim.
+	const uint64_t semente = 0x44515F4449415249ULL;
+	uint64_t sorteios = 0;
+	long long eventos = 0, sessoes = 0;
+	EstadoRepeticao esperado = { 0 };
+
+	double inicio = instanteAtual();
+
+	while (eventos < totalEventos)
+	{
+		int32_t culpado = (int32_t)reduzirSorteio(sortearGeracao(semente, 0, sorteios++), TOTAL_SUSPEITOS_CASO);
+		int32_t sala = 0;
+		uint8_t coletadas[(TOTAL_SALAS_CASO + 7) / 8] = { 0x01 };
+
+		registrarEventoDiario(diario, EventoDiario_INICIO, 0, SeguirNaDirecao_NENHUM, -1, culpado, 0);
+		registrarEventoDiario(diario, EventoDiario_PISTA, 0, SeguirNaDirecao_NENHUM, -1, -1, 0);
+		eventos += 2;
+		sessoes++;
+
+		int passos = 4 + (int)reduzirSorteio(sortearGeracao(semente, 1, sorteios++), 28);
+		for (int passo = 0; passo < passos && eventos + 2 < totalEventos; passo++)
+		{
+			uint64_t sorteio = sortearGeracao(semente, 2, sorteios++);
+			SeguirNaDirecao direcao = (sorteio & 1) ? SeguirNaDirecao_ESQUERDA : SeguirNaDirecao_DIREITA;
+			const Sala* destino = direcao == SeguirNaDirecao_ESQUERDA ? SALAS_CASO[sala].esquerda : SALAS_CASO[sala].direita;
+
+			sala = destino == NULL ? 0 : (int32_t)(destino - SALAS_CASO);
+			registrarEventoDiario(diario, EventoDiario_MOVIMENTO, sala, direcao, -1, -1, destino == NULL);
+			eventos++;
+
+			if ((coletadas[sala >> 3] & (1u << (sala & 7))) == 0)
+			{
+				coletadas[sala >> 3] |= (uint8_t)(1u << (sala & 7));
+				registrarEventoDiario(diario, EventoDiario_PISTA, sala, SeguirNaDirecao_NENHUM, -1,
+					(int32_t)reduzirSorteio(sorteio >> 1, TOTAL_SUSPEITOS_CASO), 0);
+				eventos++;
+			}
+		}
+
+		int32_t acusado = (int32_t)reduzirSorteio(sortearGeracao(semente, 3, sorteios++), TOTAL_SUSPEITOS_CASO);
+		registrarEventoDiario(diario, EventoDiario_ACUSACAO, sala, SeguirNaDirecao_NENHUM, -1, acusado, acusado == culpado);
+		registrarEventoDiario(diario, EventoDiario_FIM, -1, SeguirNaDirecao_NENHUM, -1, -1, DesfechoSessao_JOGAR_NOVAMENTE);
+		eventos += 2;
+
+		esperado.culpado = culpado;
+		esperado.sala = sala;
+		esperado.acusado = acusado;
+	}
+
+	fecharDiario(diario);
+	double segundosGravacao = instanteAtual() - inicio;
+	bool gravado = diario->arquivo == NULL && diario->registrosGravados == (unsigned long long)eventos;
+
+	printf("\n===== Gravação do diário =====\n");
+	printf(" • Eventos: %lld em %lld sessão(ões) | Grupo: %d registro(s) por fsync\n",
+		eventos, sessoes, diario->registrosPorSincronizacao);
+	printf(" • Tempo: %.1f ms | fsync: %llu | Vazão: %.2f milhões de eventos/s\n",
+		segundosGravacao * 1000.0, diario->sincronizacoes, (double)eventos / segundosGravacao / 1e6);
+
+	free(diario);
+
+	FILE* arquivo = fopen(caminho, "rb");
+	EstadoRepeticao estado = { 0 };
+	EstatisticasRepeticao estatisticas = { 0 };
+
+	inicio = instanteAtual();
+	bool encontrada = arquivo != NULL && repetirDiario(arquivo, 0, TOTAL_SALAS_CASO, TOTAL_SUSPEITOS_CASO, &estado, &estatisticas);
+	double segundosRepeticao = instanteAtual() - inicio;
+
+	if (arquivo != NULL)
+	{
+		fclose(arquivo);
+	}
+	remove(caminho);
+
+	bool conferido = gravado && encontrada &&
+		estatisticas.eventos == (unsigned long long)eventos && estatisticas.invalidos == 0 &&
+		estatisticas.sessoes == (unsigned long long)sessoes &&
+		estado.culpado == esperado.culpado && estado.sala == esperado.sala &&
+		estado.acusado == esperado.acusado && estado.encerrada;
+
+	printf("\n===== Repetição do diário =====\n");
+	printf(" • Eventos: %llu | Sessões: %llu | Inválidos: %llu\n",
+		estatisticas.eventos, estatisticas.sessoes, estatisticas.invalidos);
+	printf(" • Tempo: %.1f ms | Vazão: %.1f milhões de eventos/s\n",
+		segundosRepeticao * 1000.0, segundosRepeticao > 0 ? (double)estatisticas.eventos / segundosRepeticao / 1e6 : 0.0);
+	printf(" • Conferência do estado final: %s\n", conferido ? "ok" : "FALHOU");
+
+	return conferido ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções da Simulação de Partidas ****
+
+/// @brief Define o estado da conferência dos lotes de comandos.
+typedef struct
+{
+	uint64_t semente;
+	uint64_t sorteios;
+	long long linhasRestantes;
+	const JogoMestre* jogo; // Contexto do jogo em conferência, com os histogramas.
+	unsigned long long movimentos;
+	unsigned long long respostas;
+	unsigned long long respostasNoLote; // Perguntas feitas com movimentos do lote ainda por executar.
+} ConferenciaLotes;
+
+/// @brief Sorteia a próxima linha da conferência dos lotes(GeradorComandos): um lote de movimentos ou,
+/// quando o jogo pergunta, a resposta "s": acusa e, acertando, joga novamente, sem encerrar o jogo.
+static bool gerarComandosConferencia(char* linha, size_t capacidade, bool resposta, void* contexto)
+{
+	ConferenciaLotes* conferencia = (ConferenciaLotes*)contexto;
+
+	// Uma pergunta depois da última linha ainda é respondida: os movimentos que restam no lote precisam ser executados.
+	if (conferencia->linhasRestantes <= 0 && !resposta)
+	{
+		return false;
+	}
+	conferencia->linhasRestantes--;
+
+	uint64_t sorteio = sortearGeracao(conferencia->semente, 0, conferencia->sorteios++);
+
+	if (resposta)
+	{
+		// Cada movimento executado é uma amostra do histograma: se faltam amostras, o lote foi interrompido.
+		uint64_t executados = conferencia->jogo->latencias[ComandoLatencia_MOVIMENTO].total;
+		conferencia->respostas++;
+		conferencia->respostasNoLote += executados < conferencia->movimentos;
+		snprintf(linha, capacidade, "s\n");
+		return true;
+	}
+
+	int total = 2 + (int)((sorteio >> 8) % 7); // Lote de 2 a 8 movimentos.
+	for (int i = 0; i < total && i + 2 < (int)capacidade; i++)
+	{
+		linha[i] = ((sorteio >> (16 + i)) & 1) ? 'e' : 'd';
+	}
+	linha[total] = '\n';
+	linha[total + 1] = '\0';
+	conferencia->movimentos += (unsigned long long)total;
+
+	return true;
+}
+
+int conferirLotesComandos(long long totalLinhas, uint64_t semente)
+{
+	const char* caminho = "detective_quest_conferencia.diario";
+
+	if (totalLinhas < 1)
+	{
+		fprintf(stderr, "\n  ❌  Quantidade de linhas inválida.\n");
+		return EXIT_FAILURE;
+	}
+
+	// Um contexto novo: os histogramas contam apenas os movimentos da conferência.
+	JogoMestre* jogo = criarJogoMestre();
+	if (jogo == NULL)
+	{
+		fprintf(stderr, "\n  ❌  Erro ao tentar alocar a memória para a conferência.\n");
+		return EXIT_FAILURE;
+	}
+
+	ConferenciaLotes conferencia = { .semente = semente, .linhasRestantes = totalLinhas, .jogo = jogo };
+
+	srand((unsigned int)semente);
+	remove(caminho);
+
+	// O jogo só termina no fim das linhas.
+	jogo->entrada.gerador = gerarComandosConferencia;
+	jogo->entrada.contexto = &conferencia;
+	int resultado = executarJogo(jogo, caminho, CAPACIDADE_BUFFER_DIARIO);
+	remove(caminho);
+
+	uint64_t executados = jogo->latencias[ComandoLatencia_MOVIMENTO].total;
+	liberarJogoMestre(jogo);
+	bool conferido = resultado == EXIT_SUCCESS && conferencia.respostasNoLote > 0 && executados == conferencia.movimentos;
+
+	fprintf(stderr, "\n===== Conferência dos lotes de comandos =====\n");
+	fprintf(stderr, " • Linhas de comando: %lld | Respostas s/n: %llu(%llu no meio de um lote)\n",
+		totalLinhas, conferencia.respostas, conferencia.respostasNoLote);
+	fprintf(stderr, " • Movimentos enviados: %llu | Executados: %llu\n",
+		conferencia.movimentos, (unsigned long long)executados);
+	fprintf(stderr, " • Conferência dos lotes: %s\n", conferido ? "ok" : "FALHOU");
+
+	return conferido ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/// @brief Define o estado da conferência do desfazer no diário.
+typedef struct
+{
+	uint64_t semente;
+	uint64_t sorteios;
+	long long linhasRestantes;
+	const char* caminho;
+	JogoMestre* jogo; // Contexto do jogo em conferência.
+	unsigned long long desfazer; // Comandos de desfazer enviados.
+	unsigned long long comparacoes;
+	unsigned long long divergencias;
+} ConferenciaDesfazer;
+
+/// @brief Compara a sessão reconstruída pelo diário com a partida em andamento no contexto do jogo.
+static bool compararRepeticaoJogo(JogoMestre* jogo, const char* caminho)
+{
+	sincronizarDiario(&jogo->diario); // Os registros pendentes também entram na repetição.
+
+	FILE* arquivo = fopen(caminho, "rb");
+	if (arquivo == NULL)
+	{
+		return false;
+	}
+	EstadoRepeticao estado;
+	EstatisticasRepeticao estatisticas;
+	bool encontrada = repetirDiario(arquivo, 0, TOTAL_SALAS_CASO, TOTAL_SUSPEITOS_CASO, &estado, &estatisticas);
+	fclose(arquivo);
+
+	bool igual = encontrada && estatisticas.invalidos == 0 && jogo->motor != NULL &&
+		estado.sala == salaAtualMotorJogo(jogo->motor);
+	for (int32_t i = 0; igual && i < TOTAL_SUSPEITOS_CASO; i++)
+	{
+		igual = estado.pistasPorSuspeito[i] == pistasSuspeitoMotorJogo(jogo->motor, i);
+	}
+	return igual;
+}
+
+/// @brief Sorteia a próxima linha da conferência do desfazer(GeradorComandos), depois de comparar a
+/// repetição do diário com a partida: movimentos e desfazer(ex: "edu"), uma saída do grafo ou a resposta "s".
+static bool gerarComandosDesfazer(char* linha, size_t capacidade, bool resposta, void* contexto)
+{
+	ConferenciaDesfazer* conferencia = (ConferenciaDesfazer*)contexto;
+
+	if (conferencia->linhasRestantes <= 0)
+	{
+		return false;
+	}
+	conferencia->linhasRestantes--;
+
+	conferencia->comparacoes++;
+	conferencia->divergencias += !compararRepeticaoJogo(conferencia->jogo, conferencia->caminho);
+
+	uint64_t sorteio = sortearGeracao(conferencia->semente, 0, conferencia->sorteios++);
+
+	if (resposta)
+	{
+		snprintf(linha, capacidade, "s\n"); // Acusa e, acertando, joga novamente.
+		return true;
+	}
+
+	if (reduzirSorteio(sorteio, 10) == 0)
+	{
+		snprintf(linha, capacidade, "p %d\n", 1 + (int)reduzirSorteio(sorteio << 8, 3));
+		return true;
+	}
+
+	// Lote de 1 a 6 comandos: um terço desfaz o movimento anterior.
+	int total = 1 + (int)((sorteio >> 8) % 6);
+	for (int i = 0; i < total && i + 2 < (int)capacidade; i++)
+	{
+		uint32_t comando = reduzirSorteio(sortearGeracao(conferencia->semente, 1, (conferencia->sorteios << 3) + (uint64_t)i), 3);
+		linha[i] = comando == 0 ? 'e' : comando == 1 ? 'd' : 'u';
+		conferencia->desfazer += comando == 2;
+	}
+	linha[total] = '\n';
+	linha[total + 1] = '\0';
+
+	return true;
+}
+
+int conferirDesfazerDiario(long long totalLinhas, uint64_t semente)
+{
+	const char* caminho = "detective_quest_desfazer.diario";
+
+	if (totalLinhas < 1)
+	{
+		fprintf(stderr, "\n  ❌  Quantidade de linhas inválida.\n");
+		return EXIT_FAILURE;
+	}
+
+	JogoMestre* jogo = criarJogoMestre();
+	if (jogo == NULL)
+	{
+		fprintf(stderr, "\n  ❌  Erro ao tentar alocar a memória para a conferência.\n");
+		return EXIT_FAILURE;
+	}
+
+	ConferenciaDesfazer conferencia = { .semente = semente, .linhasRestantes = totalLinhas, .caminho = caminho, .jogo = jogo };
+
+	srand((unsigned int)semente);
+	remove(caminho);
+
+	jogo->entrada.gerador = gerarComandosDesfazer;
+	jogo->entrada.contexto = &conferencia;
+	int resultado = executarJogo(jogo, caminho, CAPACIDADE_BUFFER_DIARIO);
+	liberarJogoMestre(jogo);
+
+	// A sessão encerrada também precisa ser reconstruída: o desfecho é o da última linha.
+	EstadoRepeticao estado;
+	EstatisticasRepeticao estatisticas;
+	FILE* arquivo = fopen(caminho, "rb");
+	bool encerrada = arquivo != NULL &&
+		repetirDiario(arquivo, 0, TOTAL_SALAS_CASO, TOTAL_SUSPEITOS_CASO, &estado, &estatisticas) &&
+		estatisticas.invalidos == 0 && estado.encerrada;
+	if (arquivo != NULL)
+	{
+		fclose(arquivo);
+	}
+	remove(caminho);
+
+	bool conferido = resultado == EXIT_SUCCESS && encerrada && conferencia.desfazer > 0 && conferencia.divergencias == 0;
+
+	fprintf(stderr, "\n===== Conferência do desfazer no diário =====\n");
+	fprintf(stderr, " • Linhas de comando: %lld | Desfazer enviados: %llu\n", totalLinhas, conferencia.desfazer);
+	fprintf(stderr, " • Comparações da repetição com o jogo: %llu | Divergências: %llu\n",
+		conferencia.comparacoes, conferencia.divergencias);
+	fprintf(stderr, " • Conferência do desfazer: %s\n", conferido ? "ok" : "FALHOU");
+
+	return conferido ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Funções de Ferramentas por Linha de Comando ****
+
+int executarFerramenta(int argc, char* argv[])
+{
+	const char* ferramenta = argc > 1 ? argv[1] : "";
+
+	if (strcmp(ferramenta, "--medir-catalogo") == 0)
+	{
+		int leitores = argc > 2 ? atoi(argv[2]) : 4;
+		int duracaoMs = argc > 3 ? atoi(argv[3]) : 1000;
+		return medirCatalogoConcorrente(leitores, duracaoMs);
+	}
+
+	if (strcmp(ferramenta, "--buscar-pistas") == 0 && argc > 2)
+	{
+		bool apenasPrefixo = argc > 3 && strcmp(argv[3], "--prefixo") == 0;
+		TabelaHash* tabela = CriarTabelaHash(SUSPEITOS_CASO);
+		IndiceSufixos* indice = criarIndiceSufixosCatalogo(tabela);
+		liberarTabelaHash(tabela);
+
+		if (indice == NULL)
+		{
+			printf("\n  ❌  Erro ao construir o índice de sufixos.\n");
+			return EXIT_FAILURE;
+		}
+
+		int resultados[MAXIMO_RESULTADOS_BUSCA];
+		int total = buscarTrechoIndice(indice, argv[2], apenasPrefixo, resultados, MAXIMO_RESULTADOS_BUSCA);
+		for (int i = 0; i < total && i < MAXIMO_RESULTADOS_BUSCA; i++)
+		{
+			printf(" • %s\n", textoPistaIndice(indice, resultados[i]));
+		}
+		printf("\n  ℹ️  %d pista(s) encontrada(s) para '%s'.\n", total, argv[2]);
+
+		liberarIndiceSufixos(indice);
+		return EXIT_SUCCESS;
+	}
+
+	if (strcmp(ferramenta, "--conferir-sufixos") == 0)
+	{
+		return conferirIndiceSufixos(argc > 2 ? atoi(argv[2]) : 2000, argc > 3 ? strtoull(argv[3], NULL, 10) : 1);
+	}
+
+	if (strcmp(ferramenta, "--medir-paginacao") == 0)
+	{
+		return medirPaginacaoPistas(argc > 2 ? atoi(argv[2]) : 1000000);
+	}
+
+	if (strcmp(ferramenta, "--conferir-posicoes") == 0)
+	{
+		return conferirPosicoesPistas(argc > 2 ? atoi(argv[2]) : 20000, argc > 3 ? strtoull(argv[3], NULL, 10) : 1);
+	}
+
+	if (strcmp(ferramenta, "--conferir-colacao") == 0)
+	{
+		return conferirColacaoPistas(argc > 2 ? strtoull(argv[2], NULL, 10) : 1);
+	}
+
+	if (strcmp(ferramenta, "--medir-mansao") == 0)
+	{
+		return medirMansaoColunar(argc > 2 ? atoi(argv[2]) : 10000000);
+	}
+
+	if (strcmp(ferramenta, "--gerar-mansao") == 0)
+	{
+		return executarGeradorMansao(argc - 2, argv + 2);
+	}
+
+	if (strcmp(ferramenta, "--repetir-diario") == 0)
+	{
+		return executarRepeticaoDiario(argc - 2, argv + 2);
+	}
+
+	if (strcmp(ferramenta, "--medir-diario") == 0)
+	{
+		return medirDiario(argc > 2 ? atoll(argv[2]) : 10000000, argc > 3 ? atoi(argv[3]) : CAPACIDADE_BUFFER_DIARIO);
+	}
+
+	if (strcmp(ferramenta, "--medir-pontuacao") == 0)
+	{
+		return medirPontuacaoSuspeitos(argc > 2 ? atoi(argv[2]) : 10000, argc > 3 ? atoll(argv[3]) : 10000000);
+	}
+
+	if (strcmp(ferramenta, "--medir-evidencias") == 0)
+	{
+		return medirConjuntosEvidencias(argc > 2 ? atoi(argv[2]) : 4096, argc > 3 ? atoi(argv[3]) : 64);
+	}
+
+	if (strcmp(ferramenta, "--medir-grafo") == 0)
+	{
+		return medirMansaoGrafo(argc > 2 ? atoi(argv[2]) : 1000000, argc > 3 ? atoi(argv[3]) : 4);
+	}
+
+	if (strcmp(ferramenta, "--medir-distancias") == 0)
+	{
+		return medirDistanciasGrafo(argc > 2 ? atoi(argv[2]) : 4000000, argc > 3 ? atoi(argv[3]) : 4,
+			argc > 4 ? atoi(argv[4]) : 8);
+	}
+
+	if (strcmp(ferramenta, "--medir-armazem") == 0)
+	{
+		return medirArmazemSalas(argc > 2 ? atoi(argv[2]) : 1000000, argc > 3 ? atoi(argv[3]) : CAPACIDADE_PADRAO_PAGINAS,
+			argc > 4 ? atoi(argv[4]) : 10000);
+	}
+
+	if (strcmp(ferramenta, "--medir-mapeamento") == 0)
+	{
+		return medirCatalogoMapeado(argc > 2 ? atoi(argv[2]) : 500000, argc > 3 ? atoi(argv[3]) : 1000);
+	}
+
+	if (strcmp(ferramenta, "--medir-hash-perfeito") == 0)
+	{
+		return medirHashPerfeito(argc > 2 ? atoi(argv[2]) : 1000000);
+	}
+
+	if (strcmp(ferramenta, "--motor-partidas") == 0)
+	{
+		return medirMotorJogo(argc > 2 ? atoi(argv[2]) : 100000, argc > 3 ? strtoull(argv[3], NULL, 10) : 1);
+	}
+
+	if (strcmp(ferramenta, "--medir-indice-salas") == 0)
+	{
+		return medirIndiceSalas(argc > 2 ? atoi(argv[2]) : 10000000);
+	}
+
+	if (strcmp(ferramenta, "--medir-versoes-pistas") == 0)
+	{
+		return medirVersoesPistas(argc > 2 ? atoi(argv[2]) : 100000, argc > 3 ? atoi(argv[3]) : 10000);
+	}
+
+	if (strcmp(ferramenta, "--avaliar-acusacoes") == 0)
+	{
+		return medirAcusacoes(argc > 2 ? atoi(argv[2]) : 1000000, argc > 3 ? atoi(argv[3]) : 7,
+			argc > 4 ? atoi(argv[4]) : 0, argc > 5 ? atoi(argv[5]) : NUMERO_PISTAS_REQUERIDAS);
+	}
+
+	if (strcmp(ferramenta, "--medir-latencias") == 0)
+	{
+		return medirHistogramaLatencia(argc > 2 ? atoi(argv[2]) : 4000000);
+	}
+
+	if (strcmp(ferramenta, "--conferir-lotes") == 0)
+	{
+		return conferirLotesComandos(argc > 2 ? atoll(argv[2]) : 10000, argc > 3 ? strtoull(argv[3], NULL, 10) : 1);
+	}
+
+	if (strcmp(ferramenta, "--conferir-desfazer") == 0)
+	{
+		return conferirDesfazerDiario(argc > 2 ? atoll(argv[2]) : 2000, argc > 3 ? strtoull(argv[3], NULL, 10) : 1);
+	}
+
+	if (strcmp(ferramenta, "--relatorio-memoria") == 0)
+	{
+		return relatorioMemoriaNos(argc > 2 ? atoi(argv[2]) : 1000000, argc > 3 ? atoi(argv[3]) : 100000,
+			argc > 4 ? atoi(argv[4]) : 100000);
+	}
+
+	printf("Uso: %s <ferramenta> [parâmetros]\n", argv[0]);
+	printf("  --medir-catalogo [leitores] [ms]     Mede a vazão do catálogo concorrente.\n");
+	printf("  --buscar-pistas <trecho> [--prefixo] Busca pistas do catálogo por trecho.\n");
+	printf("  --conferir-sufixos [pistas] [semente] Confere o índice de sufixos com uma varredura ingênua.\n");
+	printf("  --medir-paginacao [pistas]           Mede a paginação da árvore de pistas.\n");
+	printf("  --conferir-posicoes [pistas] [semente] Confere rank, select, páginas e intervalos da árvore de pistas.\n");
+	printf("  --conferir-colacao [semente]         Confere a ordem de colação pt-BR das pistas.\n");
+	printf("  --medir-mansao [salas]               Mede as varreduras da mansão colunar.\n");
+	printf("  --gerar-mansao [salas] [completa|degenerada|aleatoria] [semente] [densidade]\n");
+	printf("                 [suspeitos] [uniforme|zipf] [threads]\n");
+	printf("                                       Gera uma mansão procedural e exibe as medições.\n");
+	printf("  --repetir-diario [arquivo] [sessao]  Reconstrói uma sessão(padrão: a última) do diário(ou %s).\n", VARIAVEL_DIARIO_JOGO);
+	printf("  --medir-diario [eventos] [grupo]     Mede a gravação e a repetição de um diário sintético.\n");
+	printf("  --medir-pontuacao [suspeitos] [pistas] Mede a pontuação bayesiana incremental dos suspeitos.\n");
+	printf("  --medir-evidencias [pistas] [suspeitos] Mede a contagem de pistas por suspeito com bitsets.\n");
+	printf("  --medir-grafo [salas] [portas]       Mede o percurso em largura do grafo da mansão(CSR).\n");
+	printf("  --medir-distancias [salas] [portas] [threads]\n");
+	printf("                                       Mede a busca em largura paralela com troca de direção.\n");
+	printf("  --medir-armazem [salas] [paginas] [partidas]\n");
+	printf("                                       Mede as salas lidas do disco sob demanda, em páginas.\n");
+	printf("  --medir-mapeamento [pistas] [suspeitos]\n");
+	printf("                                       Mede a carga do catálogo copiado e mapeado do arquivo.\n");
+	printf("  --medir-hash-perfeito [pistas]       Mede o hash perfeito mínimo do catálogo de pistas.\n");
+	printf("  --motor-partidas [partidas] [semente] Joga partidas automáticas no motor do jogo, sem interface.\n");
+	printf("  --medir-indice-salas [salas]         Mede o índice das salas por nome e a complementação.\n");
+	printf("  --medir-versoes-pistas [pistas] [versoes]\n");
+	printf("                                       Mede as versões(instantâneos) da árvore persistente de pistas.\n");
+	printf("  --avaliar-acusacoes [salas] [suspeitos] [threads] [requeridas]\n");
+	printf("                                       Avalia em paralelo as acusações possíveis em cada sala.\n");
+	printf("  --medir-latencias [amostras]         Mede o registro e os percentis do histograma de latências.\n");
+	printf("  --conferir-lotes [linhas] [semente]  Confere os lotes de movimentos diante das perguntas s/n.\n");
+	printf("  --conferir-desfazer [linhas] [semente] Confere a repetição do diário com o desfazer.\n");
+	printf("  --relatorio-memoria [salas] [pistas] [catalogo]\n");
+	printf("                                       Compara a memória dos nós com ponteiros e indexados.\n");
+
+	return EXIT_FAILURE;
+}
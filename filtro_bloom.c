@@ -0,0 +1,129 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "filtro_bloom.h"
+
+// Desafio Detective Quest
+// Implementação do filtro de Bloom em blocos.
+
+// **** Funções do Filtro de Bloom ****
+
+uint64_t hashFiltroBloom(const char* chave)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (const unsigned char* p = (const unsigned char*)chave; *p != '\0'; p++)
+	{
+		h ^= *p;
+		h *= 1099511628211ULL;
+	}
+
+	// Mistura final, para espalhar os bits usados na escolha do bloco e das posições.
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+FiltroBloom* criarFiltroBloom(size_t capacidade, double taxaFalsosPositivos)
+{
+	if (capacidade == 0)
+	{
+		capacidade = 1;
+	}
+	if (taxaFalsosPositivos <= 0.0 || taxaFalsosPositivos >= 1.0)
+	{
+		taxaFalsosPositivos = TAXA_FALSOS_POSITIVOS_BLOOM;
+	}
+
+	FiltroBloom* filtro = (FiltroBloom*)malloc(sizeof(FiltroBloom));
+	if (filtro == NULL)
+	{
+		return NULL;
+	}
+
+	// Dimensionamento clássico: m = -n ln(p) / ln(2)², k = (m / n) ln(2).
+	// Os blocos aumentam um pouco a taxa real, então arredondamos m para cima.
+	double ln2 = log(2.0);
+	double bits = -(double)capacidade * log(taxaFalsosPositivos) / (ln2 * ln2);
+	filtro->totalBlocos = (size_t)ceil(bits / BITS_BLOCO_BLOOM);
+	if (filtro->totalBlocos == 0)
+	{
+		filtro->totalBlocos = 1;
+	}
+
+	int funcoes = (int)lround(bits / (double)capacidade * ln2);
+	filtro->totalFuncoes = funcoes < 1 ? 1 : (funcoes > 16 ? 16 : funcoes);
+
+	filtro->blocos = (atomic_uint_least64_t*)calloc(filtro->totalBlocos * (BITS_BLOCO_BLOOM / 64), sizeof(atomic_uint_least64_t));
+	if (filtro->blocos == NULL)
+	{
+		free(filtro);
+		return NULL;
+	}
+
+	return filtro;
+}
+
+void inserirFiltroBloom(FiltroBloom* filtro, const char* chave)
+{
+	if (filtro == NULL)
+	{
+		return;
+	}
+
+	uint64_t h = hashFiltroBloom(chave);
+	atomic_uint_least64_t* bloco = filtro->blocos + (h % filtro->totalBlocos) * (BITS_BLOCO_BLOOM / 64);
+
+	// Hash duplo dentro do bloco: posição_i = h1 + i * h2.
+	uint32_t h1 = (uint32_t)(h >> 32);
+	uint32_t h2 = (uint32_t)h | 1u;
+	for (int i = 0; i < filtro->totalFuncoes; i++)
+	{
+		uint32_t bit = (h1 + (uint32_t)i * h2) % BITS_BLOCO_BLOOM;
+		atomic_fetch_or_explicit(&bloco[bit / 64], 1ULL << (bit % 64), memory_order_relaxed);
+	}
+}
+
+bool consultarFiltroBloom(const FiltroBloom* filtro, const char* chave, EstatisticasBloom* estatisticas)
+{
+	if (filtro == NULL)
+	{
+		return true; // Sem filtro, toda chave pode estar presente.
+	}
+
+	if (estatisticas != NULL)
+	{
+		estatisticas->consultas++;
+	}
+
+	uint64_t h = hashFiltroBloom(chave);
+	atomic_uint_least64_t* bloco = filtro->blocos + (h % filtro->totalBlocos) * (BITS_BLOCO_BLOOM / 64);
+
+	uint32_t h1 = (uint32_t)(h >> 32);
+	uint32_t h2 = (uint32_t)h | 1u;
+	for (int i = 0; i < filtro->totalFuncoes; i++)
+	{
+		uint32_t bit = (h1 + (uint32_t)i * h2) % BITS_BLOCO_BLOOM;
+		if ((atomic_load_explicit(&bloco[bit / 64], memory_order_relaxed) & (1ULL << (bit % 64))) == 0)
+		{
+			if (estatisticas != NULL)
+			{
+				estatisticas->rejeitadas++;
+			}
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void liberarFiltroBloom(FiltroBloom* filtro)
+{
+	if (filtro == NULL)
+		return;
+
+	free(filtro->blocos);
+	free(filtro);
+}
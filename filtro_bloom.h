@@ -0,0 +1,70 @@
+#ifndef FILTRO_BLOOM_H
+#define FILTRO_BLOOM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+// Desafio Detective Quest
+// Filtro de Bloom em blocos(uma linha de cache por chave), usado para rejeitar as buscas de pistas
+// certamente ausentes sem acessar a estrutura. O filtro só é lido nas consultas: as estatísticas
+// ficam com quem consulta. Os bits são atômicos(sem ordenação): um escritor pode inserir enquanto
+// outras threads consultam, e quem publica a estrutura depois de inserir garante a ordem.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o tamanho de uma linha de cache, usado nos blocos dos filtros de Bloom.
+#define TAMANHO_LINHA_CACHE 64
+/// @brief Define a taxa de falsos positivos desejada para os filtros de Bloom das pistas.
+#define TAXA_FALSOS_POSITIVOS_BLOOM 0.01
+/// @brief Define a quantidade de bits de um bloco do filtro de Bloom(uma linha de cache).
+#define BITS_BLOCO_BLOOM (TAMANHO_LINHA_CACHE * 8)
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um filtro de Bloom em blocos: todos os bits de uma chave ficam na mesma linha de cache,
+/// então uma consulta que certamente falha é rejeitada com uma única leitura de bloco.
+typedef struct
+{
+	atomic_uint_least64_t* blocos; // Cada bloco ocupa BITS_BLOCO_BLOOM bits.
+	size_t totalBlocos;
+	int totalFuncoes; // Quantidade de bits marcados por chave.
+} FiltroBloom;
+
+/// @brief Define as estatísticas das consultas a um filtro de Bloom, mantidas por quem consulta.
+typedef struct
+{
+	unsigned long long consultas;
+	unsigned long long rejeitadas; // Consultas respondidas como ausentes sem acessar a estrutura.
+	unsigned long long falsosPositivos; // Consultas aprovadas pelo filtro, mas ausentes na estrutura.
+} EstatisticasBloom;
+
+// **** Funções do Filtro de Bloom ****
+
+/// @brief Efetua o hash de 64 bits de uma chave(FNV-1a, com mistura final), usado pelo filtro de Bloom.
+/// Os 32 bits altos e os baixos são independentes o bastante para servir a outros índices por nome.
+/// @param Texto. Ponteiro para o valor de texto da chave.
+/// @returns Inteiro. Valor hash de 64 bits.
+uint64_t hashFiltroBloom(const char* chave);
+/// @brief Efetua a criação de um filtro de Bloom em blocos, dimensionado para a capacidade
+/// e a taxa de falsos positivos informadas.
+/// @param Inteiro. Quantidade esperada de chaves(ex: as pistas do catálogo, ou as salas com pista).
+/// @param Real. Taxa de falsos positivos desejada, entre 0 e 1.
+/// @returns FiltroBloom. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+FiltroBloom* criarFiltroBloom(size_t capacidade, double taxaFalsosPositivos);
+/// @brief Efetua a inserção de uma chave no filtro de Bloom.
+/// @param FiltroBloom. Ponteiro via referência, usado na inserção.
+/// @param Texto. Ponteiro para o valor de texto da chave.
+void inserirFiltroBloom(FiltroBloom* filtro, const char* chave);
+/// @brief Consulta se uma chave pode estar presente no filtro. Falso significa ausência garantida.
+/// @param FiltroBloom. Ponteiro usado na consulta. Somente leitura. Sem filtro(NULL), toda chave pode estar presente.
+/// @param Texto. Ponteiro para o valor de texto da chave.
+/// @param EstatisticasBloom. Ponteiro via referência das estatísticas de quem consulta, ou NULL para não contar.
+/// @returns Bool. Verdadeiro(true) se a chave pode estar presente. Caso contrário, falso(false).
+bool consultarFiltroBloom(const FiltroBloom* filtro, const char* chave, EstatisticasBloom* estatisticas);
+/// @brief Libera a memória alocada para o filtro de Bloom.
+/// @param FiltroBloom. Ponteiro via referência, usado na operação de liberação.
+void liberarFiltroBloom(FiltroBloom* filtro);
+
+#endif
@@ -0,0 +1,473 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// Desafio Detective Quest
+// Gerador de tabelas estáticas do caso.
+// Converte um arquivo de descrição de caso(casos/*.caso) em um cabeçalho C com vetores const,
+// inicializados estaticamente, para que o jogo comece sem nenhuma alocação para a mansão.
+// Executado pelo CMake durante a compilação; o cabeçalho gerado não deve ser editado.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o tamanho máximo de uma linha do arquivo de caso.
+#define TAMANHO_MAX_LINHA 512
+/// @brief Define o tamanho máximo de um campo do arquivo de caso.
+#define TAMANHO_MAX_CAMPO 128
+/// @brief Define a quantidade máxima de campos de uma linha.
+#define MAXIMO_CAMPOS 6
+/// @brief Define a quantidade máxima de salas de um caso.
+#define MAXIMO_SALAS 4096
+/// @brief Define a quantidade máxima de suspeitos de um caso.
+#define MAXIMO_SUSPEITOS 256
+/// @brief Define a quantidade máxima de associações do catálogo de um caso.
+#define MAXIMO_CATALOGO 4096
+/// @brief Define a quantidade máxima de portas(saídas além da esquerda e da direita) de um caso.
+#define MAXIMO_PORTAS 16384
+/// @brief Define a capacidade do texto curto guardado no próprio nó(TextoCompacto), com terminador.
+#define TAMANHO_TEXTO_CURTO 16
+
+// **** Definições de estruturas. ****
+
+/// @brief Define uma sala lida do arquivo de caso, com as saídas ainda por identificador.
+typedef struct
+{
+	char identificador[TAMANHO_MAX_CAMPO];
+	char nome[TAMANHO_MAX_CAMPO];
+	char pista[TAMANHO_MAX_CAMPO];
+	char esquerda[TAMANHO_MAX_CAMPO];
+	char direita[TAMANHO_MAX_CAMPO];
+} SalaCaso;
+
+/// @brief Define uma associação do catálogo lida do arquivo de caso.
+typedef struct
+{
+	char pista[TAMANHO_MAX_CAMPO];
+	int grupo;
+} AssociacaoCaso;
+
+/// @brief Define uma porta lida do arquivo de caso: uma saída a mais da sala de origem.
+typedef struct
+{
+	char origem[TAMANHO_MAX_CAMPO];
+	char destino[TAMANHO_MAX_CAMPO];
+} PortaCaso;
+
+/// @brief Define o conteúdo completo de um caso.
+typedef struct
+{
+	SalaCaso salas[MAXIMO_SALAS];
+	int totalSalas;
+	char suspeitos[MAXIMO_SUSPEITOS][TAMANHO_MAX_CAMPO];
+	int totalSuspeitos;
+	AssociacaoCaso catalogo[MAXIMO_CATALOGO];
+	int totalCatalogo;
+	PortaCaso portas[MAXIMO_PORTAS];
+	int totalPortas;
+} Caso;
+
+// **** Declarações das funções. ****
+
+/// @brief Efetua a leitura do arquivo de caso.
+/// @param Texto. Caminho do arquivo de caso.
+/// @param Caso. Ponteiro via referência, para atribuição do conteúdo lido.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool lerCaso(const char* caminho, Caso* caso);
+/// @brief Efetua a validação das referências entre salas e dos grupos do catálogo.
+/// @param Caso. Ponteiro usado na validação. Somente leitura.
+/// @param Texto. Caminho do arquivo de caso, usado nas mensagens de erro.
+/// @returns Bool. Verdadeiro(true) se o caso é válido. Caso contrário, falso(false).
+bool validarCaso(const Caso* caso, const char* caminho);
+/// @brief Efetua a escrita do cabeçalho C com as tabelas estáticas do caso.
+/// @param Caso. Ponteiro usado na geração. Somente leitura.
+/// @param Texto. Caminho do arquivo de caso, citado no cabeçalho.
+/// @param Texto. Caminho do cabeçalho a gerar.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool gerarCabecalho(const Caso* caso, const char* caminhoCaso, const char* caminhoSaida);
+/// @brief Recupera a posição de uma sala pelo identificador.
+/// @param Caso. Ponteiro usado na busca. Somente leitura.
+/// @param Texto. Identificador procurado. "-" representa ausência de saída.
+/// @returns Inteiro. Posição da sala, -1 para "-", ou -2 se o identificador não existir.
+int posicaoSala(const Caso* caso, const char* identificador);
+/// @brief Escreve um valor de texto como literal C, escapando aspas e barras.
+/// @param Arquivo. Ponteiro do arquivo de saída.
+/// @param Texto. Valor a escrever.
+void escreverLiteral(FILE* saida, const char* texto);
+/// @brief Escreve o inicializador de um TextoCompacto: no próprio nó, se couber, ou como literal estático.
+/// @param Arquivo. Ponteiro do arquivo de saída.
+/// @param Texto. Valor a escrever.
+void escreverTextoCompacto(FILE* saida, const char* texto);
+
+/// @brief Ponto de entrada do gerador.
+/// @param Inteiro. Quantidade de argumentos.
+/// @param Vetor. Argumentos: arquivo de caso e cabeçalho de saída.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int main(int argc, char* argv[]) {
+
+	if (argc != 3)
+	{
+		fprintf(stderr, "Uso: %s <arquivo.caso> <saida.h>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Caso* caso = (Caso*)calloc(1, sizeof(Caso));
+	if (caso == NULL)
+	{
+		fprintf(stderr, "Erro ao alocar memória para o caso.\n");
+		return EXIT_FAILURE;
+	}
+
+	bool sucesso = lerCaso(argv[1], caso) && validarCaso(caso, argv[1]) && gerarCabecalho(caso, argv[1], argv[2]);
+
+	free(caso);
+
+	return sucesso ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// **** Implementação das funções. ****
+
+bool lerCaso(const char* caminho, Caso* caso)
+{
+	FILE* arquivo = fopen(caminho, "rb");
+	if (arquivo == NULL)
+	{
+		fprintf(stderr, "%s: não foi possível abrir o arquivo.\n", caminho);
+		return false;
+	}
+
+	char linha[TAMANHO_MAX_LINHA];
+	int numeroLinha = 0;
+	bool sucesso = true;
+
+	while (sucesso && fgets(linha, sizeof(linha), arquivo) != NULL)
+	{
+		numeroLinha++;
+
+		// Ignora o BOM do UTF-8, se houver, e remove o fim de linha(LF ou CRLF).
+		char* inicio = linha;
+		if (numeroLinha == 1 && strncmp(inicio, "\xEF\xBB\xBF", 3) == 0)
+		{
+			inicio += 3;
+		}
+		inicio[strcspn(inicio, "\r\n")] = '\0';
+
+		if (inicio[0] == '\0' || inicio[0] == '#')
+		{
+			continue;
+		}
+
+		char* campos[MAXIMO_CAMPOS];
+		int totalCampos = 0;
+		char* cursor = inicio;
+		while (totalCampos < MAXIMO_CAMPOS)
+		{
+			campos[totalCampos++] = cursor;
+			char* separador = strchr(cursor, '|');
+			if (separador == NULL)
+			{
+				break;
+			}
+			*separador = '\0';
+			cursor = separador + 1;
+		}
+
+		for (int i = 0; i < totalCampos; i++)
+		{
+			if (strlen(campos[i]) >= TAMANHO_MAX_CAMPO)
+			{
+				fprintf(stderr, "%s:%d: campo excede %d bytes.\n", caminho, numeroLinha, TAMANHO_MAX_CAMPO - 1);
+				sucesso = false;
+			}
+		}
+		if (!sucesso)
+		{
+			break;
+		}
+
+		if (strcmp(campos[0], "suspeito") == 0 && totalCampos == 2 && caso->totalSuspeitos < MAXIMO_SUSPEITOS)
+		{
+			strcpy(caso->suspeitos[caso->totalSuspeitos++], campos[1]);
+		}
+		else if (strcmp(campos[0], "sala") == 0 && totalCampos == 6 && caso->totalSalas < MAXIMO_SALAS)
+		{
+			SalaCaso* sala = &caso->salas[caso->totalSalas++];
+			strcpy(sala->identificador, campos[1]);
+			strcpy(sala->nome, campos[2]);
+			strcpy(sala->pista, campos[3]);
+			strcpy(sala->esquerda, campos[4]);
+			strcpy(sala->direita, campos[5]);
+		}
+		else if (strcmp(campos[0], "catalogo") == 0 && totalCampos == 3 && caso->totalCatalogo < MAXIMO_CATALOGO)
+		{
+			AssociacaoCaso* associacao = &caso->catalogo[caso->totalCatalogo++];
+			strcpy(associacao->pista, campos[1]);
+			associacao->grupo = atoi(campos[2]);
+		}
+		else if (strcmp(campos[0], "porta") == 0 && totalCampos == 3 && caso->totalPortas < MAXIMO_PORTAS)
+		{
+			PortaCaso* porta = &caso->portas[caso->totalPortas++];
+			strcpy(porta->origem, campos[1]);
+			strcpy(porta->destino, campos[2]);
+		}
+		else
+		{
+			fprintf(stderr, "%s:%d: linha inválida ou limite excedido.\n", caminho, numeroLinha);
+			sucesso = false;
+		}
+	}
+
+	fclose(arquivo);
+	return sucesso;
+}
+
+int posicaoSala(const Caso* caso, const char* identificador)
+{
+	if (strcmp(identificador, "-") == 0)
+	{
+		return -1; // Sem saída.
+	}
+
+	for (int i = 0; i < caso->totalSalas; i++)
+	{
+		if (strcmp(caso->salas[i].identificador, identificador) == 0)
+		{
+			return i;
+		}
+	}
+
+	return -2; // Identificador desconhecido.
+}
+
+bool validarCaso(const Caso* caso, const char* caminho)
+{
+	bool valido = true;
+
+	if (caso->totalSalas == 0 || caso->totalSuspeitos == 0)
+	{
+		fprintf(stderr, "%s: o caso precisa de ao menos uma sala e um suspeito.\n", caminho);
+		return false;
+	}
+
+	for (int i = 0; i < caso->totalSalas; i++)
+	{
+		const SalaCaso* sala = &caso->salas[i];
+		if (posicaoSala(caso, sala->esquerda) == -2 || posicaoSala(caso, sala->direita) == -2)
+		{
+			fprintf(stderr, "%s: a sala '%s' aponta para uma sala inexistente.\n", caminho, sala->identificador);
+			valido = false;
+		}
+		if (posicaoSala(caso, sala->identificador) != i)
+		{
+			fprintf(stderr, "%s: identificador de sala repetido: '%s'.\n", caminho, sala->identificador);
+			valido = false;
+		}
+	}
+
+	for (int i = 0; i < caso->totalPortas; i++)
+	{
+		const PortaCaso* porta = &caso->portas[i];
+		if (posicaoSala(caso, porta->origem) < 0 || posicaoSala(caso, porta->destino) < 0)
+		{
+			fprintf(stderr, "%s: a porta '%s' → '%s' liga uma sala inexistente.\n", caminho, porta->origem, porta->destino);
+			valido = false;
+		}
+	}
+
+	for (int i = 0; i < caso->totalCatalogo; i++)
+	{
+		if (caso->catalogo[i].grupo < 0 || caso->catalogo[i].grupo >= caso->totalSuspeitos)
+		{
+			fprintf(stderr, "%s: grupo inválido para a pista '%s'.\n", caminho, caso->catalogo[i].pista);
+			valido = false;
+		}
+	}
+
+	return valido;
+}
+
+void escreverLiteral(FILE* saida, const char* texto)
+{
+	fputc('"', saida);
+	for (const char* p = texto; *p != '\0'; p++)
+	{
+		if (*p == '"' || *p == '\\')
+		{
+			fputc('\\', saida);
+		}
+		fputc(*p, saida);
+	}
+	fputc('"', saida);
+}
+
+void escreverTextoCompacto(FILE* saida, const char* texto)
+{
+	fprintf(saida, strlen(texto) < TAMANHO_TEXTO_CURTO ? "{ .curto = " : "{ .longo = ");
+	escreverLiteral(saida, texto);
+	fprintf(saida, " }");
+}
+
+bool gerarCabecalho(const Caso* caso, const char* caminhoCaso, const char* caminhoSaida)
+{
+	FILE* saida = fopen(caminhoSaida, "wb");
+	if (saida == NULL)
+	{
+		fprintf(stderr, "%s: não foi possível criar o arquivo.\n", caminhoSaida);
+		return false;
+	}
+
+	fprintf(saida, "// Arquivo gerado automaticamente por gerador_caso. Não edite.\n");
+	// Apenas o nome do arquivo, para não registrar o caminho da máquina de compilação.
+	const char* nomeCaso = caminhoCaso;
+	for (const char* p = caminhoCaso; *p != '\0'; p++)
+	{
+		if (*p == '/' || *p == '\\')
+		{
+			nomeCaso = p + 1;
+		}
+	}
+	fprintf(saida, "// Origem: %s\n// Deve ser incluído depois da definição de Sala e de <stdint.h>.\n\n", nomeCaso);
+
+	fprintf(saida, "/// @brief Define a capacidade de texto curto usada nos inicializadores abaixo.\n#define TAMANHO_TEXTO_CURTO_GERADO %d\n", TAMANHO_TEXTO_CURTO);
+	fprintf(saida, "/// @brief Define a quantidade de salas do caso.\n#define TOTAL_SALAS_CASO %d\n", caso->totalSalas);
+	fprintf(saida, "/// @brief Define a quantidade de suspeitos do caso.\n#define TOTAL_SUSPEITOS_CASO %d\n", caso->totalSuspeitos);
+	fprintf(saida, "/// @brief Define a quantidade de associações pista → suspeito do catálogo.\n#define TOTAL_CATALOGO_CASO %d\n", caso->totalCatalogo);
+
+	// Saídas de cada sala, no grafo: esquerda, direita e as portas, na ordem do arquivo.
+	// Contagem por sala, soma acumulada e preenchimento(counting sort): linear em salas e portas.
+	int* inicioSaidas = (int*)calloc((size_t)caso->totalSalas + 1, sizeof(int));
+	int* destinos = (int*)malloc(((size_t)caso->totalSalas * 2 + (size_t)caso->totalPortas + 1) * sizeof(int));
+	int* origemPortas = (int*)malloc(((size_t)caso->totalPortas + 1) * sizeof(int));
+	if (inicioSaidas == NULL || destinos == NULL || origemPortas == NULL)
+	{
+		fprintf(stderr, "Erro ao alocar memória para as saídas do caso.\n");
+		free(inicioSaidas);
+		free(destinos);
+		free(origemPortas);
+		fclose(saida);
+		return false;
+	}
+	for (int i = 0; i < caso->totalSalas; i++)
+	{
+		inicioSaidas[i + 1] = (posicaoSala(caso, caso->salas[i].esquerda) >= 0) + (posicaoSala(caso, caso->salas[i].direita) >= 0);
+	}
+	for (int j = 0; j < caso->totalPortas; j++)
+	{
+		origemPortas[j] = posicaoSala(caso, caso->portas[j].origem);
+		inicioSaidas[origemPortas[j] + 1]++;
+	}
+	for (int i = 0; i < caso->totalSalas; i++)
+	{
+		inicioSaidas[i + 1] += inicioSaidas[i];
+	}
+	int totalSaidas = inicioSaidas[caso->totalSalas];
+	for (int i = 0; i < caso->totalSalas; i++)
+	{
+		int esquerda = posicaoSala(caso, caso->salas[i].esquerda);
+		int direita = posicaoSala(caso, caso->salas[i].direita);
+		int posicao = inicioSaidas[i];
+		if (esquerda >= 0)
+		{
+			destinos[posicao++] = esquerda;
+		}
+		if (direita >= 0)
+		{
+			destinos[posicao++] = direita;
+		}
+		inicioSaidas[i] = posicao; // Próxima posição livre da sala, restaurada depois das portas.
+	}
+	for (int j = 0; j < caso->totalPortas; j++)
+	{
+		destinos[inicioSaidas[origemPortas[j]]++] = posicaoSala(caso, caso->portas[j].destino);
+	}
+	// Cada sala avançou até o início da seguinte: desloca de volta para o início de cada sala.
+	for (int i = caso->totalSalas; i > 0; i--)
+	{
+		inicioSaidas[i] = inicioSaidas[i - 1];
+	}
+	inicioSaidas[0] = 0;
+	inicioSaidas[caso->totalSalas] = totalSaidas;
+	free(origemPortas);
+	fprintf(saida, "/// @brief Define a quantidade de saídas(esquerda, direita e portas) de todas as salas do caso.\n#define TOTAL_SAIDAS_CASO %d\n\n", totalSaidas);
+
+	fprintf(saida, "/// @brief Suspeitos do caso, na ordem usada pelo embaralhamento.\n");
+	fprintf(saida, "static const char* const SUSPEITOS_CASO[TOTAL_SUSPEITOS_CASO] =\n{\n");
+	for (int i = 0; i < caso->totalSuspeitos; i++)
+	{
+		fprintf(saida, "\t");
+		escreverLiteral(saida, caso->suspeitos[i]);
+		fprintf(saida, ",\n");
+	}
+	fprintf(saida, "};\n\n");
+
+	// As saídas apontam para elementos do próprio vetor: endereços constantes, resolvidos na ligação.
+	// As saídas de Sala são const struct Sala*, então o vetor inteiro é const e fica em .rodata.
+	fprintf(saida, "/// @brief Salas do caso, em memória somente leitura. A primeira é a entrada da mansão.\n");
+	fprintf(saida, "static const Sala SALAS_CASO[TOTAL_SALAS_CASO] =\n{\n");
+	for (int i = 0; i < caso->totalSalas; i++)
+	{
+		const SalaCaso* sala = &caso->salas[i];
+		int esquerda = posicaoSala(caso, sala->esquerda);
+		int direita = posicaoSala(caso, sala->direita);
+
+		fprintf(saida, "\t{ .nome = ");
+		escreverTextoCompacto(saida, sala->nome);
+		fprintf(saida, ", .pista = ");
+		escreverTextoCompacto(saida, sala->pista);
+		if (esquerda >= 0)
+		{
+			fprintf(saida, ", .esquerda = &SALAS_CASO[%d]", esquerda);
+		}
+		if (direita >= 0)
+		{
+			fprintf(saida, ", .direita = &SALAS_CASO[%d]", direita);
+		}
+		fprintf(saida, " }, // %s\n", sala->identificador);
+	}
+	fprintf(saida, "};\n\n");
+
+	// Grafo da mansão em CSR: as saídas da sala i são DESTINOS_SAIDAS_CASO[INICIO_SAIDAS_CASO[i] .. INICIO_SAIDAS_CASO[i + 1]).
+	fprintf(saida, "/// @brief Posição da primeira saída de cada sala em DESTINOS_SAIDAS_CASO, mais o total ao fim.\n");
+	fprintf(saida, "static const int32_t INICIO_SAIDAS_CASO[TOTAL_SALAS_CASO + 1] =\n{\n\t");
+	for (int i = 0; i <= caso->totalSalas; i++)
+	{
+		fprintf(saida, "%d%s", inicioSaidas[i], i < caso->totalSalas ? ", " : "");
+	}
+	fprintf(saida, "\n};\n\n");
+
+	fprintf(saida, "/// @brief Sala de destino de cada saída, agrupadas pela sala de origem.\n");
+	fprintf(saida, "static const int32_t DESTINOS_SAIDAS_CASO[TOTAL_SAIDAS_CASO > 0 ? TOTAL_SAIDAS_CASO : 1] =\n{\n\t");
+	for (int i = 0; i < totalSaidas; i++)
+	{
+		fprintf(saida, "%d%s", destinos[i], i + 1 < totalSaidas ? ", " : "");
+	}
+	fprintf(saida, "%s\n};\n\n", totalSaidas == 0 ? "0" : "");
+	free(inicioSaidas);
+	free(destinos);
+
+	fprintf(saida, "/// @brief Pistas do catálogo pista → suspeito.\n");
+	fprintf(saida, "static const char* const PISTAS_CATALOGO_CASO[TOTAL_CATALOGO_CASO] =\n{\n");
+	for (int i = 0; i < caso->totalCatalogo; i++)
+	{
+		fprintf(saida, "\t");
+		escreverLiteral(saida, caso->catalogo[i].pista);
+		fprintf(saida, ",\n");
+	}
+	fprintf(saida, "};\n\n");
+
+	fprintf(saida, "/// @brief Grupo de cada pista do catálogo: posição do suspeito após o embaralhamento.\n");
+	fprintf(saida, "static const unsigned char GRUPOS_CATALOGO_CASO[TOTAL_CATALOGO_CASO] =\n{\n\t");
+	for (int i = 0; i < caso->totalCatalogo; i++)
+	{
+		fprintf(saida, "%d%s", caso->catalogo[i].grupo, i + 1 < caso->totalCatalogo ? ", " : "");
+	}
+	fprintf(saida, "\n};\n");
+
+	bool sucesso = ferror(saida) == 0;
+	if (fclose(saida) != 0)
+	{
+		sucesso = false;
+	}
+
+	return sucesso;
+}
@@ -0,0 +1,505 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <threads.h>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "gerador_mansoes.h"
+
+// Desafio Detective Quest
+// Implementação do gerador de mansões.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem gera o caso informa as falhas.
+
+// **** Funções do Gerador de Mansões ****
+
+/// @brief Fluxos independentes de sorteio, um por decisão tomada para cada sala.
+enum
+{
+	FluxoGeracao_SAIDAS = 1,
+	FluxoGeracao_LADO = 2,
+	FluxoGeracao_TEM_PISTA = 3,
+	FluxoGeracao_PISTA = 4,
+	FluxoGeracao_NOME = 5,
+	FluxoGeracao_SUSPEITO = 6,
+};
+
+/// @brief Partes usadas na composição dos nomes das salas geradas.
+static const char* const COMODOS_GERADOS[] = { "Biblioteca", "Cozinha", "Porão", "Sótão", "Capela", "Adega",
+	"Galeria", "Estufa", "Escritório", "Salão", "Despensa", "Lavanderia", "Torre", "Cripta", "Varanda", "Quarto" };
+/// @brief Partes usadas na composição dos textos das pistas geradas.
+static const char* const OBJETOS_GERADOS[] = { "Bilhete rasgado", "Pegada de lama", "Luva manchada", "Chave torta",
+	"Fio de cabelo", "Vidro partido", "Cinzas de charuto", "Mapa dobrado" };
+
+int contarProcessadores()
+{
+#ifdef _WIN32
+	SYSTEM_INFO informacoes;
+	GetSystemInfo(&informacoes);
+	return (int)informacoes.dwNumberOfProcessors;
+#else
+	long total = sysconf(_SC_NPROCESSORS_ONLN);
+	return total > 0 ? (int)total : 1;
+#endif
+}
+
+/// @brief Quantidade de saídas sorteadas para uma sala da mansão aleatória: 0, 1 ou 2,
+/// com probabilidades 1/4, 1/4 e 1/2(em média, 1,25 saída por sala).
+static int32_t saidasSorteadas(uint64_t semente, int32_t sala)
+{
+	if (sala < SALAS_INICIAIS_RAMIFICADAS)
+	{
+		return 2;
+	}
+
+	uint32_t sorteio = (uint32_t)sortearGeracao(semente, FluxoGeracao_SAIDAS, (uint64_t)sala) & 3;
+	return sorteio >= 2 ? 2 : (int32_t)sorteio;
+}
+
+/// @brief Define uma tabela de apelidos(método de Vose), para sortear pistas em O(1) em qualquer distribuição.
+typedef struct
+{
+	uint32_t* limiar; // Fração(em 32 bits) em que a posição sorteia a si mesma.
+	int32_t* apelido; // Posição sorteada no restante da fração.
+	int32_t total;
+} TabelaApelidos;
+
+/// @brief Monta a tabela de apelidos da distribuição de Zipf: peso 1 / (k + 1)^expoente para a pista k.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+static bool montarTabelaApelidos(TabelaApelidos* tabela, int32_t total, double expoente)
+{
+	double* pesos = (double*)malloc((size_t)total * sizeof(double));
+	int32_t* pequenos = (int32_t*)malloc((size_t)total * sizeof(int32_t));
+	int32_t* grandes = (int32_t*)malloc((size_t)total * sizeof(int32_t));
+	tabela->limiar = (uint32_t*)malloc((size_t)total * sizeof(uint32_t));
+	tabela->apelido = (int32_t*)malloc((size_t)total * sizeof(int32_t));
+	tabela->total = total;
+
+	bool sucesso = pesos != NULL && pequenos != NULL && grandes != NULL && tabela->limiar != NULL && tabela->apelido != NULL;
+	if (sucesso)
+	{
+		double soma = 0.0;
+		for (int32_t k = 0; k < total; k++)
+		{
+			pesos[k] = 1.0 / pow((double)k + 1.0, expoente);
+			soma += pesos[k];
+		}
+
+		int32_t totalPequenos = 0, totalGrandes = 0;
+		for (int32_t k = 0; k < total; k++)
+		{
+			pesos[k] = pesos[k] * total / soma; // Média 1.
+			if (pesos[k] < 1.0)
+			{
+				pequenos[totalPequenos++] = k;
+			}
+			else
+			{
+				grandes[totalGrandes++] = k;
+			}
+		}
+
+		while (totalPequenos > 0 && totalGrandes > 0)
+		{
+			int32_t pequeno = pequenos[--totalPequenos];
+			int32_t grande = grandes[totalGrandes - 1];
+			tabela->limiar[pequeno] = (uint32_t)(pesos[pequeno] * 4294967295.0);
+			tabela->apelido[pequeno] = grande;
+			pesos[grande] -= 1.0 - pesos[pequeno];
+			if (pesos[grande] < 1.0)
+			{
+				totalGrandes--;
+				pequenos[totalPequenos++] = grande;
+			}
+		}
+
+		// O que sobra tem peso 1(a menos de arredondamento): sorteia sempre a si mesmo.
+		while (totalGrandes > 0)
+		{
+			int32_t k = grandes[--totalGrandes];
+			tabela->limiar[k] = UINT32_MAX;
+			tabela->apelido[k] = k;
+		}
+		while (totalPequenos > 0)
+		{
+			int32_t k = pequenos[--totalPequenos];
+			tabela->limiar[k] = UINT32_MAX;
+			tabela->apelido[k] = k;
+		}
+	}
+
+	free(pesos);
+	free(pequenos);
+	free(grandes);
+	return sucesso;
+}
+
+/// @brief Define o trabalho de uma thread do gerador: um intervalo contíguo de salas.
+typedef struct
+{
+	const ParametrosGeracao* parametros;
+	CasoGerado* caso;
+	const TabelaApelidos* apelidos; // NULL na distribuição uniforme.
+	int32_t inicio;
+	int32_t fim;
+	int64_t saidasAnteriores; // Saídas de todas as salas antes do intervalo(mansão aleatória).
+	int64_t saidas; // Resultado da primeira fase: saídas do intervalo.
+	int64_t salasComPista;
+	bool incompleta; // Alguma sala do intervalo não é alcançável a partir da entrada.
+	int fase;
+} TrabalhoGeracao;
+
+/// @brief Laço de uma thread do gerador. Na fase 0 apenas conta as saídas do intervalo
+/// (mansão aleatória); na fase 1 preenche as colunas.
+/// @param Parâmetros. Ponteiro para TrabalhoGeracao.
+/// @returns Inteiro. Zero.
+static int executarTrabalhoGeracao(void* argumento)
+{
+	TrabalhoGeracao* trabalho = (TrabalhoGeracao*)argumento;
+	const ParametrosGeracao* parametros = trabalho->parametros;
+	MansaoColunar* mansao = trabalho->caso->mansao;
+	const uint64_t semente = parametros->semente;
+	const int32_t totalSalas = parametros->totalSalas;
+
+	if (trabalho->fase == 0)
+	{
+		int64_t saidas = 0;
+		for (int32_t i = trabalho->inicio; i < trabalho->fim; i++)
+		{
+			saidas += saidasSorteadas(semente, i);
+		}
+		trabalho->saidas = saidas;
+		return 0;
+	}
+
+	const uint32_t totalNomes = (uint32_t)trabalho->caso->primeiraPista;
+	const uint32_t totalPistas = (uint32_t)trabalho->caso->totalPistasDistintas;
+	const uint64_t limiarPista = parametros->densidadePistas >= 1.0 ? UINT64_MAX
+		: (uint64_t)(parametros->densidadePistas * 18446744073709551615.0);
+	int64_t proxima = 1 + trabalho->saidasAnteriores; // Primeira saída ainda não atribuída.
+	int64_t salasComPista = 0;
+
+	for (int32_t i = trabalho->inicio; i < trabalho->fim; i++)
+	{
+		int32_t esquerda = SEM_INDICE_COLUNAR, direita = SEM_INDICE_COLUNAR;
+
+		switch (parametros->formato)
+		{
+		case FormatoMansao_COMPLETA:
+			esquerda = (int64_t)i * 2 + 1 < totalSalas ? i * 2 + 1 : SEM_INDICE_COLUNAR;
+			direita = (int64_t)i * 2 + 2 < totalSalas ? i * 2 + 2 : SEM_INDICE_COLUNAR;
+			break;
+		case FormatoMansao_DEGENERADA:
+			if (i + 1 < totalSalas)
+			{
+				if ((sortearGeracao(semente, FluxoGeracao_LADO, (uint64_t)i) & 1) != 0)
+				{
+					esquerda = i + 1;
+				}
+				else
+				{
+					direita = i + 1;
+				}
+			}
+			break;
+		default:
+		{
+			// Ordem de nível: as saídas de cada sala são as próximas posições livres.
+			if (i > 0 && proxima <= i)
+			{
+				trabalho->incompleta = true; // Nenhuma sala anterior leva até esta.
+			}
+			int32_t saidas = saidasSorteadas(semente, i);
+			if (saidas >= 1 && proxima < totalSalas)
+			{
+				esquerda = (int32_t)proxima;
+			}
+			if (saidas == 2 && proxima + 1 < totalSalas)
+			{
+				direita = (int32_t)proxima + 1;
+			}
+			proxima += saidas;
+			break;
+		}
+		}
+
+		mansao->esquerda[i] = esquerda;
+		mansao->direita[i] = direita;
+		mansao->nome[i] = (int32_t)reduzirSorteio(sortearGeracao(semente, FluxoGeracao_NOME, (uint64_t)i), totalNomes);
+		mansao->marcas[i] = 0;
+
+		int32_t pista = SEM_INDICE_COLUNAR;
+		if (sortearGeracao(semente, FluxoGeracao_TEM_PISTA, (uint64_t)i) < limiarPista)
+		{
+			uint64_t sorteio = sortearGeracao(semente, FluxoGeracao_PISTA, (uint64_t)i);
+			int32_t k = (int32_t)reduzirSorteio(sorteio, totalPistas);
+			if (trabalho->apelidos != NULL && (uint32_t)sorteio > trabalho->apelidos->limiar[k])
+			{
+				k = trabalho->apelidos->apelido[k];
+			}
+			pista = trabalho->caso->primeiraPista + k;
+			salasComPista++;
+		}
+		mansao->pista[i] = pista;
+	}
+
+	trabalho->salasComPista = salasComPista;
+	return 0;
+}
+
+/// @brief Executa uma fase da geração em todas as threads e aguarda o término.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+static bool executarFaseGeracao(TrabalhoGeracao* trabalhos, int totalThreads, int fase)
+{
+	thrd_t threads[MAXIMO_THREADS_GERADOR];
+	int criadas = 0;
+
+	for (int t = 0; t < totalThreads; t++)
+	{
+		trabalhos[t].fase = fase;
+	}
+
+	// O primeiro intervalo é executado na thread atual.
+	for (int t = 1; t < totalThreads; t++)
+	{
+		if (thrd_create(&threads[criadas], executarTrabalhoGeracao, &trabalhos[t]) != thrd_success)
+		{
+			executarTrabalhoGeracao(&trabalhos[t]);
+			continue;
+		}
+		criadas++;
+	}
+	executarTrabalhoGeracao(&trabalhos[0]);
+
+	for (int t = 0; t < criadas; t++)
+	{
+		thrd_join(threads[t], NULL);
+	}
+
+	return true;
+}
+
+/// @brief Gera os textos do caso(nomes, pistas e suspeitos) em um único buffer.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+static bool gerarTextosCaso(CasoGerado* caso, int32_t totalNomes, uint64_t semente)
+{
+	const int32_t totalComodos = (int32_t)(sizeof(COMODOS_GERADOS) / sizeof(COMODOS_GERADOS[0]));
+	const int32_t totalObjetos = (int32_t)(sizeof(OBJETOS_GERADOS) / sizeof(OBJETOS_GERADOS[0]));
+
+	// Cada texto cabe em TAMANHO_MAX_NOME bytes, ou TAMANHO_MAX_PISTA para as pistas.
+	size_t capacidade = (size_t)totalNomes * TAMANHO_MAX_NOME + (size_t)caso->totalPistasDistintas * TAMANHO_MAX_PISTA
+		+ (size_t)caso->totalSuspeitos * TAMANHO_MAX_NOME;
+	caso->bufferTextos = (char*)malloc(capacidade);
+	caso->suspeitos = (const char**)malloc((size_t)caso->totalSuspeitos * sizeof(const char*));
+	if (caso->bufferTextos == NULL || caso->suspeitos == NULL)
+	{
+		return false;
+	}
+
+	char* cursor = caso->bufferTextos;
+	MansaoColunar* mansao = caso->mansao;
+	for (int32_t i = 0; i < totalNomes; i++)
+	{
+		mansao->textos[mansao->totalTextos++] = cursor;
+		cursor += snprintf(cursor, TAMANHO_MAX_NOME, "%s %d", COMODOS_GERADOS[i % totalComodos], i / totalComodos + 1) + 1;
+	}
+	for (int32_t k = 0; k < caso->totalPistasDistintas; k++)
+	{
+		mansao->textos[mansao->totalTextos++] = cursor;
+		cursor += snprintf(cursor, TAMANHO_MAX_PISTA, "%s nº %d", OBJETOS_GERADOS[k % totalObjetos], k / totalObjetos + 1) + 1;
+	}
+	for (int32_t s = 0; s < caso->totalSuspeitos; s++)
+	{
+		caso->suspeitos[s] = cursor;
+		cursor += snprintf(cursor, TAMANHO_MAX_NOME, "Suspeito %d", s + 1) + 1;
+	}
+
+	// Catálogo: as primeiras pistas garantem ao menos uma pista por suspeito; as demais são sorteadas.
+	for (int32_t k = 0; k < caso->totalPistasDistintas; k++)
+	{
+		caso->suspeitoPista[k] = k < caso->totalSuspeitos ? k
+			: (int32_t)reduzirSorteio(sortearGeracao(semente, FluxoGeracao_SUSPEITO, (uint64_t)k), (uint32_t)caso->totalSuspeitos);
+	}
+
+	return true;
+}
+
+void iniciarParametrosGeracao(ParametrosGeracao* parametros, int32_t totalSalas, uint64_t semente)
+{
+	parametros->semente = semente;
+	parametros->totalSalas = totalSalas;
+	parametros->formato = FormatoMansao_ALEATORIA;
+	parametros->densidadePistas = 0.5;
+	parametros->totalSuspeitos = 7;
+	parametros->totalPistasDistintas = 0;
+	parametros->distribuicao = DistribuicaoPistas_UNIFORME;
+	parametros->expoenteZipf = 1.0;
+	parametros->totalThreads = 0;
+}
+
+CasoGerado* gerarCaso(const ParametrosGeracao* parametros)
+{
+	if (parametros->totalSalas < 1 || parametros->totalSuspeitos < 1 ||
+		parametros->densidadePistas < 0.0 || parametros->densidadePistas > 1.0)
+	{
+		return NULL;
+	}
+
+	ParametrosGeracao ajustados = *parametros;
+	if (ajustados.totalPistasDistintas <= 0)
+	{
+		// Uma pista distinta a cada oito salas, ao menos duas por suspeito.
+		int32_t automatico = ajustados.totalSalas / 8;
+		ajustados.totalPistasDistintas = automatico > ajustados.totalSuspeitos * 2 ? automatico : ajustados.totalSuspeitos * 2;
+	}
+	if (ajustados.totalPistasDistintas > MAXIMO_PISTAS_DISTINTAS)
+	{
+		ajustados.totalPistasDistintas = MAXIMO_PISTAS_DISTINTAS;
+	}
+	if (ajustados.totalThreads <= 0)
+	{
+		ajustados.totalThreads = contarProcessadores();
+	}
+	if (ajustados.totalThreads > MAXIMO_THREADS_GERADOR)
+	{
+		ajustados.totalThreads = MAXIMO_THREADS_GERADOR;
+	}
+	if (ajustados.totalThreads > ajustados.totalSalas)
+	{
+		ajustados.totalThreads = ajustados.totalSalas;
+	}
+
+	// Um nome por cômodo a cada dezesseis salas, ao menos um de cada cômodo.
+	int32_t totalNomes = ajustados.totalSalas / 16 > 16 ? ajustados.totalSalas / 16 : 16;
+	if (totalNomes > MAXIMO_PISTAS_DISTINTAS)
+	{
+		totalNomes = MAXIMO_PISTAS_DISTINTAS;
+	}
+
+	CasoGerado* caso = (CasoGerado*)calloc(1, sizeof(CasoGerado));
+	if (caso == NULL)
+	{
+		return NULL;
+	}
+	caso->totalSuspeitos = ajustados.totalSuspeitos;
+	caso->totalPistasDistintas = ajustados.totalPistasDistintas;
+	caso->primeiraPista = totalNomes;
+	caso->mansao = criarMansaoColunar(ajustados.totalSalas, totalNomes + ajustados.totalPistasDistintas);
+	caso->suspeitoPista = (int32_t*)malloc((size_t)ajustados.totalPistasDistintas * sizeof(int32_t));
+
+	TabelaApelidos apelidos = { 0 };
+	bool sucesso = caso->mansao != NULL && caso->suspeitoPista != NULL && gerarTextosCaso(caso, totalNomes, ajustados.semente);
+	if (sucesso && ajustados.distribuicao == DistribuicaoPistas_ZIPF)
+	{
+		sucesso = montarTabelaApelidos(&apelidos, ajustados.totalPistasDistintas, ajustados.expoenteZipf);
+	}
+
+	TrabalhoGeracao trabalhos[MAXIMO_THREADS_GERADOR];
+	for (int tentativa = 0; sucesso; tentativa++)
+	{
+		int totalThreads = ajustados.totalThreads;
+		for (int t = 0; t < totalThreads; t++)
+		{
+			trabalhos[t] = (TrabalhoGeracao){
+				.parametros = &ajustados,
+				.caso = caso,
+				.apelidos = ajustados.distribuicao == DistribuicaoPistas_ZIPF ? &apelidos : NULL,
+				.inicio = (int32_t)((int64_t)ajustados.totalSalas * t / totalThreads),
+				.fim = (int32_t)((int64_t)ajustados.totalSalas * (t + 1) / totalThreads),
+			};
+		}
+
+		if (ajustados.formato == FormatoMansao_ALEATORIA)
+		{
+			// Primeira fase: saídas de cada intervalo; a soma prefixada diz onde começam as saídas de cada um.
+			executarFaseGeracao(trabalhos, totalThreads, 0);
+			int64_t acumulado = 0;
+			for (int t = 0; t < totalThreads; t++)
+			{
+				trabalhos[t].saidasAnteriores = acumulado;
+				acumulado += trabalhos[t].saidas;
+			}
+		}
+
+		executarFaseGeracao(trabalhos, totalThreads, 1);
+
+		bool incompleta = false;
+		caso->salasComPista = 0;
+		for (int t = 0; t < totalThreads; t++)
+		{
+			incompleta |= trabalhos[t].incompleta;
+			caso->salasComPista += trabalhos[t].salasComPista;
+		}
+		if (!incompleta)
+		{
+			break;
+		}
+
+		// Mansão aleatória esgotada antes da quantidade pedida: segue, de forma determinística, com a próxima semente.
+		if (tentativa == 16)
+		{
+			sucesso = false;
+		}
+		ajustados.semente++;
+	}
+
+	free(apelidos.limiar);
+	free(apelidos.apelido);
+
+	if (!sucesso)
+	{
+		liberarCasoGerado(caso);
+		return NULL;
+	}
+
+	return caso;
+}
+
+const char* pistaSalaGerada(const CasoGerado* caso, int32_t sala)
+{
+	int32_t pista = caso->mansao->pista[sala];
+	return pista != SEM_INDICE_COLUNAR ? caso->mansao->textos[pista] : NULL;
+}
+
+const char* suspeitoSalaGerada(const CasoGerado* caso, int32_t sala)
+{
+	int32_t pista = caso->mansao->pista[sala];
+	return pista != SEM_INDICE_COLUNAR ? caso->suspeitos[caso->suspeitoPista[pista - caso->primeiraPista]] : NULL;
+}
+
+uint64_t impressaoDigitalCaso(const CasoGerado* caso)
+{
+	const MansaoColunar* mansao = caso->mansao;
+	uint64_t impressao = 14695981039346656037ULL;
+
+	for (int32_t i = 0; i < mansao->totalSalas; i++)
+	{
+		uint64_t valor = ((uint64_t)(uint32_t)mansao->esquerda[i] << 32) ^ (uint32_t)mansao->direita[i];
+		valor ^= ((uint64_t)(uint32_t)mansao->pista[i] << 21) ^ ((uint64_t)(uint32_t)mansao->nome[i] << 7);
+		impressao = (impressao ^ valor) * 1099511628211ULL;
+	}
+	for (int32_t k = 0; k < caso->totalPistasDistintas; k++)
+	{
+		impressao = (impressao ^ (uint64_t)caso->suspeitoPista[k]) * 1099511628211ULL;
+	}
+
+	return impressao;
+}
+
+void liberarCasoGerado(CasoGerado* caso)
+{
+	if (caso == NULL)
+	{
+		return;
+	}
+
+	liberarMansaoColunar(caso->mansao);
+	free(caso->bufferTextos);
+	free((void*)caso->suspeitos);
+	free(caso->suspeitoPista);
+	free(caso);
+}
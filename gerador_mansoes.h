@@ -0,0 +1,122 @@
+#ifndef GERADOR_MANSOES_H
+#define GERADOR_MANSOES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mansao_colunar.h"
+
+// Desafio Detective Quest
+// Gerador procedural de mansões e casos, para os testes de carga e de escala: a mesma semente e os mesmos
+// parâmetros produzem sempre o mesmo caso, com qualquer quantidade de threads. Os sorteios não têm estado:
+// cada valor depende apenas da semente, de um fluxo e de uma posição.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a quantidade máxima de threads do gerador de mansões.
+#define MAXIMO_THREADS_GERADOR 64
+/// @brief Define a quantidade de salas do início da mansão aleatória que sempre têm duas saídas.
+/// Com essa margem, a chance de a mansão se esgotar antes da quantidade pedida é desprezível.
+#define SALAS_INICIAIS_RAMIFICADAS 64
+/// @brief Define a quantidade máxima de pistas distintas de uma mansão gerada.
+#define MAXIMO_PISTAS_DISTINTAS (1 << 20)
+
+// **** Definições de estruturas. ****
+
+/// @brief Define uma enumeração(alias FormatoMansao), usada na geração procedural de mansões.
+typedef enum
+{
+	FormatoMansao_COMPLETA = 0, // Todos os níveis cheios, exceto o último.
+	FormatoMansao_DEGENERADA = 1, // Uma única saída por sala: altura igual à quantidade de salas.
+	FormatoMansao_ALEATORIA = 2, // Zero, uma ou duas saídas por sala, sorteadas.
+} FormatoMansao;
+
+/// @brief Define uma enumeração(alias DistribuicaoPistas), usada no sorteio das pistas das salas.
+typedef enum
+{
+	DistribuicaoPistas_UNIFORME = 0,
+	DistribuicaoPistas_ZIPF = 1, // Poucas pistas muito repetidas e uma cauda longa de pistas raras.
+} DistribuicaoPistas;
+
+/// @brief Define os parâmetros da geração procedural de uma mansão.
+/// A mesma semente e os mesmos parâmetros produzem sempre o mesmo caso, com qualquer quantidade de threads.
+typedef struct
+{
+	uint64_t semente;
+	int32_t totalSalas;
+	FormatoMansao formato;
+	double densidadePistas; // Fração das salas com pista, entre 0 e 1.
+	int32_t totalSuspeitos;
+	int32_t totalPistasDistintas; // Zero para escolher conforme a quantidade de salas.
+	DistribuicaoPistas distribuicao;
+	double expoenteZipf;
+	int totalThreads; // Zero para usar um thread por processador.
+} ParametrosGeracao;
+
+/// @brief Define um caso gerado: a mansão colunar e o catálogo pista → suspeito.
+/// Os textos das salas são, em ordem, os nomes e depois as pistas distintas.
+typedef struct
+{
+	MansaoColunar* mansao;
+	char* bufferTextos; // Memória de todos os textos gerados(nomes, pistas e suspeitos).
+	const char** suspeitos;
+	int32_t totalSuspeitos;
+	int32_t primeiraPista; // Índice, em mansao->textos, da primeira pista distinta.
+	int32_t totalPistasDistintas;
+	int32_t* suspeitoPista; // Catálogo: suspeito associado a cada pista distinta.
+	int64_t salasComPista;
+} CasoGerado;
+
+// **** Funções do Gerador de Mansões ****
+
+/// @brief Sorteio sem estado(splitmix64): o valor depende apenas da semente, do fluxo e da posição.
+/// @param Inteiro. Semente da geração.
+/// @param Inteiro. Fluxo da decisão sorteada.
+/// @param Inteiro. Posição(sala ou pista) sorteada.
+/// @returns Inteiro. Valor sorteado, com 64 bits uniformes.
+static inline uint64_t sortearGeracao(uint64_t semente, uint64_t fluxo, uint64_t posicao)
+{
+	uint64_t z = semente + fluxo * 0xD1B54A32D192ED03ULL + (posicao + 1) * 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+/// @brief Reduz um valor sorteado ao intervalo [0, limite), sem divisão.
+static inline uint32_t reduzirSorteio(uint64_t valor, uint32_t limite)
+{
+	return (uint32_t)(((valor >> 32) * (uint64_t)limite) >> 32);
+}
+/// @brief Recupera a quantidade de processadores disponíveis, usada como padrão de threads nas gerações
+/// e nas avaliações em paralelo.
+/// @returns Inteiro. Quantidade de processadores, ao menos 1.
+int contarProcessadores();
+/// @brief Preenche os parâmetros de geração com os valores padrão: mansão aleatória, metade das
+/// salas com pistas, sete suspeitos e pistas em distribuição uniforme.
+/// @param ParametrosGeracao. Ponteiro via referência, para atribuição.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Semente da geração.
+void iniciarParametrosGeracao(ParametrosGeracao* parametros, int32_t totalSalas, uint64_t semente);
+/// @brief Efetua a geração procedural de um caso, em paralelo. Cada sala depende apenas da semente
+/// e da sua posição, então o resultado não depende da quantidade de threads.
+/// @param ParametrosGeracao. Ponteiro usado na geração. Somente leitura.
+/// @returns CasoGerado. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+CasoGerado* gerarCaso(const ParametrosGeracao* parametros);
+/// @brief Recupera o texto da pista de uma sala do caso gerado.
+/// @param CasoGerado. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice da sala.
+/// @returns Texto. Ponteiro para o texto da pista, ou NULL se a sala não tiver pista.
+const char* pistaSalaGerada(const CasoGerado* caso, int32_t sala);
+/// @brief Recupera o suspeito associado, pelo catálogo, à pista de uma sala do caso gerado.
+/// @param CasoGerado. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice da sala.
+/// @returns Texto. Ponteiro para o nome do suspeito, ou NULL se a sala não tiver pista.
+const char* suspeitoSalaGerada(const CasoGerado* caso, int32_t sala);
+/// @brief Calcula uma impressão digital do caso, usada para conferir o determinismo da geração.
+/// @param CasoGerado. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Valor da impressão digital.
+uint64_t impressaoDigitalCaso(const CasoGerado* caso);
+/// @brief Libera a memória alocada para o caso gerado.
+/// @param CasoGerado. Ponteiro via referência, usado na operação de liberação.
+void liberarCasoGerado(CasoGerado* caso);
+
+#endif
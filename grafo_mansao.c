@@ -0,0 +1,551 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+#include "grafo_mansao.h"
+
+// Desafio Detective Quest
+// Implementação do grafo da mansão: construção, percurso e distâncias.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a quantidade de salas de cada bloco de trabalho distribuído entre as threads da busca.
+/// Múltiplo de 64, para que cada bloco ocupe palavras inteiras dos mapas de bits.
+#define BLOCO_SALAS_DISTANCIAS 1024
+/// @brief Define a capacidade da fila local de cada thread da busca, copiada em bloco para a próxima fronteira.
+#define CAPACIDADE_FILA_LOCAL_DISTANCIAS 512
+/// @brief Define o alinhamento do trabalho de cada thread(uma linha de cache): os contadores de threads
+/// vizinhas não dividem a mesma linha.
+#define ALINHAMENTO_TRABALHO_DISTANCIAS 64
+
+// **** Funções do Grafo da Mansão ****
+
+/// @brief Recupera a posição(0 a 63) do único bit ligado de uma palavra.
+static inline int32_t posicaoBitGrafo(uint64_t bit)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (int32_t)__builtin_ctzll(bit);
+#else
+	int32_t posicao = 0;
+	while ((bit >>= 1) != 0)
+	{
+		posicao++;
+	}
+	return posicao;
+#endif
+}
+
+MansaoGrafo* construirMansaoGrafo(int32_t totalSalas, const int32_t* origens, const int32_t* destinos, int32_t totalArestas)
+{
+	if (totalSalas < 1 || totalArestas < 0)
+	{
+		return NULL;
+	}
+
+	MansaoGrafo* grafo = (MansaoGrafo*)calloc(1, sizeof(MansaoGrafo));
+	int32_t* inicioSaidas = (int32_t*)calloc((size_t)totalSalas + 1, sizeof(int32_t));
+	int32_t* destinosSaidas = (int32_t*)malloc((size_t)(totalArestas > 0 ? totalArestas : 1) * sizeof(int32_t));
+	if (grafo == NULL || inicioSaidas == NULL || destinosSaidas == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o grafo da mansão.\n");
+		free(grafo);
+		free(inicioSaidas);
+		free(destinosSaidas);
+		return NULL;
+	}
+
+	// Contagem das saídas de cada sala, deslocada em uma posição para a soma de prefixos.
+	for (int32_t i = 0; i < totalArestas; i++)
+	{
+		if (origens[i] < 0 || origens[i] >= totalSalas || destinos[i] < 0 || destinos[i] >= totalSalas)
+		{
+			printf("\n  ❌  Aresta %d inválida: %d -> %d.\n", i, origens[i], destinos[i]);
+			free(grafo);
+			free(inicioSaidas);
+			free(destinosSaidas);
+			return NULL;
+		}
+		inicioSaidas[origens[i] + 1]++;
+	}
+
+	for (int32_t i = 0; i < totalSalas; i++)
+	{
+		inicioSaidas[i + 1] += inicioSaidas[i];
+	}
+
+	// Preenchimento estável: inicioSaidas[i] avança até o fim da sala i, que é o início da sala i + 1.
+	// Um deslocamento de uma posição restaura os inícios, sem um vetor auxiliar de cursores.
+	for (int32_t i = 0; i < totalArestas; i++)
+	{
+		destinosSaidas[inicioSaidas[origens[i]]++] = destinos[i];
+	}
+	for (int32_t i = totalSalas; i > 0; i--)
+	{
+		inicioSaidas[i] = inicioSaidas[i - 1];
+	}
+	inicioSaidas[0] = 0;
+
+	grafo->inicioSaidas = inicioSaidas;
+	grafo->destinos = destinosSaidas;
+	grafo->totalSalas = totalSalas;
+	grafo->totalSaidas = totalArestas;
+	return grafo;
+}
+
+int32_t percorrerMansaoGrafo(const MansaoGrafo* grafo, int32_t origem, int32_t* destino)
+{
+	if (grafo == NULL || origem < 0 || origem >= grafo->totalSalas)
+	{
+		return -1;
+	}
+
+	uint64_t* visitadas = (uint64_t*)calloc(((size_t)grafo->totalSalas + 63) / 64, sizeof(uint64_t));
+	if (visitadas == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o percurso do grafo.\n");
+		return -1;
+	}
+
+	// O próprio vetor de destino serve de fila: as salas entram nele na ordem em que são alcançadas.
+	int32_t proxima = 0;
+	int32_t total = 0;
+	destino[total++] = origem;
+	visitadas[origem / 64] |= 1ULL << (origem % 64);
+	while (proxima < total)
+	{
+		int32_t sala = destino[proxima++];
+		const int32_t* saida = grafo->destinos + grafo->inicioSaidas[sala];
+		const int32_t* fim = grafo->destinos + grafo->inicioSaidas[sala + 1];
+		for (; saida < fim; saida++)
+		{
+			uint64_t bit = 1ULL << (*saida % 64);
+			if ((visitadas[*saida / 64] & bit) == 0)
+			{
+				visitadas[*saida / 64] |= bit;
+				destino[total++] = *saida;
+			}
+		}
+	}
+
+	free(visitadas);
+	return total;
+}
+
+void liberarMansaoGrafo(MansaoGrafo* grafo)
+{
+	if (grafo == NULL)
+		return;
+
+	free((void*)grafo->inicioSaidas);
+	free((void*)grafo->destinos);
+	free(grafo);
+}
+
+/// @brief Define uma barreira reutilizável entre as threads de uma busca(threads.h não oferece barreiras).
+typedef struct
+{
+	mtx_t trava;
+	cnd_t condicao;
+	int total;
+	int aguardando;
+	unsigned geracao;
+} BarreiraThreads;
+
+/// @brief Inicia uma barreira para a quantidade de threads informada.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+static bool iniciarBarreira(BarreiraThreads* barreira, int total)
+{
+	barreira->total = total;
+	barreira->aguardando = 0;
+	barreira->geracao = 0;
+	if (mtx_init(&barreira->trava, mtx_plain) != thrd_success)
+	{
+		return false;
+	}
+	if (cnd_init(&barreira->condicao) != thrd_success)
+	{
+		mtx_destroy(&barreira->trava);
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief Libera as threads que aguardam, quando todas chegaram. Chamada com a trava obtida.
+static void liberarEsperaBarreira(BarreiraThreads* barreira)
+{
+	if (barreira->aguardando > 0 && barreira->aguardando >= barreira->total)
+	{
+		barreira->aguardando = 0;
+		barreira->geracao++;
+		cnd_broadcast(&barreira->condicao);
+	}
+}
+
+/// @brief Aguarda todas as threads chegarem à barreira. As escritas anteriores ficam visíveis a todas elas.
+static void aguardarBarreira(BarreiraThreads* barreira)
+{
+	mtx_lock(&barreira->trava);
+	unsigned geracao = barreira->geracao;
+	barreira->aguardando++;
+	liberarEsperaBarreira(barreira);
+	while (geracao == barreira->geracao)
+	{
+		cnd_wait(&barreira->condicao, &barreira->trava);
+	}
+	mtx_unlock(&barreira->trava);
+}
+
+/// @brief Retira da barreira uma thread que não pôde ser criada.
+static void retirarBarreira(BarreiraThreads* barreira)
+{
+	mtx_lock(&barreira->trava);
+	barreira->total--;
+	liberarEsperaBarreira(barreira);
+	mtx_unlock(&barreira->trava);
+}
+
+static void destruirBarreira(BarreiraThreads* barreira)
+{
+	cnd_destroy(&barreira->condicao);
+	mtx_destroy(&barreira->trava);
+}
+
+typedef struct BuscaDistancias BuscaDistancias;
+
+/// @brief Define o trabalho de uma thread da busca de distâncias, com a sua fila local e os seus contadores.
+typedef struct
+{
+	_Alignas(ALINHAMENTO_TRABALHO_DISTANCIAS) BuscaDistancias* busca;
+	int indice;
+	int32_t totalFila;
+	int32_t descobertas; // Salas descobertas no nível atual.
+	int64_t saidasDescobertas; // Soma das saídas das salas descobertas no nível atual.
+	int64_t arestasExaminadas;
+	int32_t fila[CAPACIDADE_FILA_LOCAL_DISTANCIAS];
+} TrabalhoDistancias;
+
+/// @brief Define o estado compartilhado de uma busca de distâncias. Os campos comuns são alterados apenas
+/// pela thread 0, entre duas barreiras; os atômicos, por todas as threads durante um nível.
+struct BuscaDistancias
+{
+	const MansaoGrafo* grafo;
+	const MansaoGrafo* entradas;
+	int32_t* distancias;
+	atomic_ullong* visitadas; // Mapa de bits das salas já alcançadas.
+	atomic_ullong* fronteira; // Mapa de bits da fronteira do nível atual.
+	atomic_ullong* proximaFronteira;
+	int32_t* fila; // A mesma fronteira, como fila.
+	int32_t* proximaFila;
+	int32_t totalFila;
+	int32_t palavras;
+	int32_t nivel;
+	int32_t alcancadas;
+	int32_t niveisBaixoParaCima;
+	int64_t saidasNaoVisitadas;
+	bool baixoParaCima;
+	bool terminada;
+	atomic_int totalProximaFila;
+	atomic_int proximoBloco;
+	BarreiraThreads barreira;
+	int totalTrabalhos;
+	TrabalhoDistancias trabalhos[MAXIMO_THREADS_DISTANCIAS];
+};
+
+/// @brief Copia a fila local da thread para a próxima fronteira, reservando as posições com uma única
+/// operação atômica.
+static void esvaziarFilaLocalDistancias(TrabalhoDistancias* trabalho)
+{
+	if (trabalho->totalFila == 0)
+	{
+		return;
+	}
+
+	BuscaDistancias* busca = trabalho->busca;
+	int32_t posicao = atomic_fetch_add_explicit(&busca->totalProximaFila, trabalho->totalFila, memory_order_relaxed);
+	memcpy(busca->proximaFila + posicao, trabalho->fila, (size_t)trabalho->totalFila * sizeof(int32_t));
+	trabalho->totalFila = 0;
+}
+
+/// @brief Registra uma sala recém-alcançada: a distância, os contadores do nível e a fila local.
+static inline void registrarDescobertaDistancias(TrabalhoDistancias* trabalho, int32_t sala)
+{
+	BuscaDistancias* busca = trabalho->busca;
+	busca->distancias[sala] = busca->nivel + 1;
+	trabalho->descobertas++;
+	trabalho->saidasDescobertas += totalSaidasGrafo(busca->grafo, sala);
+	if (trabalho->totalFila == CAPACIDADE_FILA_LOCAL_DISTANCIAS)
+	{
+		esvaziarFilaLocalDistancias(trabalho);
+	}
+	trabalho->fila[trabalho->totalFila++] = sala;
+}
+
+/// @brief Passo de cima para baixo: examina as saídas de cada sala da fronteira, em blocos da fila.
+static void passoCimaParaBaixoDistancias(TrabalhoDistancias* trabalho)
+{
+	BuscaDistancias* busca = trabalho->busca;
+	const MansaoGrafo* grafo = busca->grafo;
+	int64_t inicio;
+
+	while ((inicio = (int64_t)atomic_fetch_add_explicit(&busca->proximoBloco, 1, memory_order_relaxed) * BLOCO_SALAS_DISTANCIAS) < busca->totalFila)
+	{
+		int32_t fim = inicio + BLOCO_SALAS_DISTANCIAS < busca->totalFila ? (int32_t)inicio + BLOCO_SALAS_DISTANCIAS : busca->totalFila;
+		for (int32_t i = (int32_t)inicio; i < fim; i++)
+		{
+			int32_t sala = busca->fila[i];
+			const int32_t* saida = grafo->destinos + grafo->inicioSaidas[sala];
+			const int32_t* ultima = grafo->destinos + grafo->inicioSaidas[sala + 1];
+			trabalho->arestasExaminadas += ultima - saida;
+			for (; saida < ultima; saida++)
+			{
+				int32_t destino = *saida;
+				uint64_t bit = 1ULL << (destino % 64);
+				atomic_ullong* palavra = &busca->visitadas[destino / 64];
+
+				// A leitura simples antes da operação atômica evita disputar a linha de cache pelas salas
+				// já visitadas, a maioria das saídas. Apenas a thread que liga o bit registra a sala.
+				if ((atomic_load_explicit(palavra, memory_order_relaxed) & bit) == 0 &&
+					(atomic_fetch_or_explicit(palavra, bit, memory_order_relaxed) & bit) == 0)
+				{
+					atomic_fetch_or_explicit(&busca->proximaFronteira[destino / 64], bit, memory_order_relaxed);
+					registrarDescobertaDistancias(trabalho, destino);
+				}
+			}
+		}
+	}
+}
+
+/// @brief Passo de baixo para cima: cada sala não visitada procura, entre as suas entradas, uma sala
+/// da fronteira, e para na primeira. Os blocos ocupam palavras inteiras dos mapas de bits, então cada
+/// palavra é alterada por uma única thread, sem operações atômicas de escrita.
+static void passoBaixoParaCimaDistancias(TrabalhoDistancias* trabalho)
+{
+	BuscaDistancias* busca = trabalho->busca;
+	const MansaoGrafo* entradas = busca->entradas;
+	int32_t totalSalas = busca->grafo->totalSalas;
+	int64_t inicio;
+
+	while ((inicio = (int64_t)atomic_fetch_add_explicit(&busca->proximoBloco, 1, memory_order_relaxed) * BLOCO_SALAS_DISTANCIAS) < totalSalas)
+	{
+		int32_t primeira = (int32_t)(inicio / 64);
+		int32_t ultima = (int32_t)((inicio + BLOCO_SALAS_DISTANCIAS) / 64) < busca->palavras ? (int32_t)((inicio + BLOCO_SALAS_DISTANCIAS) / 64) : busca->palavras;
+		for (int32_t p = primeira; p < ultima; p++)
+		{
+			uint64_t visitadas = atomic_load_explicit(&busca->visitadas[p], memory_order_relaxed);
+			uint64_t pendentes = ~visitadas;
+			if ((int64_t)(p + 1) * 64 > totalSalas)
+			{
+				pendentes &= (1ULL << (totalSalas % 64)) - 1; // Bits além da última sala.
+			}
+
+			uint64_t novas = 0;
+			while (pendentes != 0)
+			{
+				uint64_t bit = pendentes & (0 - pendentes);
+				pendentes ^= bit;
+				int32_t sala = p * 64 + posicaoBitGrafo(bit);
+				const int32_t* entrada = entradas->destinos + entradas->inicioSaidas[sala];
+				const int32_t* fim = entradas->destinos + entradas->inicioSaidas[sala + 1];
+				for (; entrada < fim; entrada++)
+				{
+					trabalho->arestasExaminadas++;
+					if (atomic_load_explicit(&busca->fronteira[*entrada / 64], memory_order_relaxed) & (1ULL << (*entrada % 64)))
+					{
+						novas |= bit;
+						registrarDescobertaDistancias(trabalho, sala);
+						break;
+					}
+				}
+			}
+
+			if (novas != 0)
+			{
+				atomic_store_explicit(&busca->visitadas[p], visitadas | novas, memory_order_relaxed);
+				atomic_store_explicit(&busca->proximaFronteira[p], novas, memory_order_relaxed);
+			}
+		}
+	}
+}
+
+/// @brief Conclui um nível da busca(thread 0, com as demais na barreira): troca as fronteiras e escolhe
+/// a direção do próximo nível pelas heurísticas ALFA_DIRECAO_DISTANCIAS e BETA_DIRECAO_DISTANCIAS.
+static void concluirNivelDistancias(BuscaDistancias* busca)
+{
+	int32_t descobertas = 0;
+	int64_t saidasDescobertas = 0;
+	for (int t = 0; t < busca->totalTrabalhos; t++)
+	{
+		descobertas += busca->trabalhos[t].descobertas;
+		saidasDescobertas += busca->trabalhos[t].saidasDescobertas;
+	}
+
+	int32_t* fila = busca->fila;
+	busca->fila = busca->proximaFila;
+	busca->proximaFila = fila;
+	busca->totalFila = atomic_load_explicit(&busca->totalProximaFila, memory_order_relaxed);
+	atomic_store_explicit(&busca->totalProximaFila, 0, memory_order_relaxed);
+	atomic_store_explicit(&busca->proximoBloco, 0, memory_order_relaxed);
+
+	atomic_ullong* fronteira = busca->fronteira;
+	busca->fronteira = busca->proximaFronteira;
+	busca->proximaFronteira = fronteira;
+	for (int32_t p = 0; p < busca->palavras; p++)
+	{
+		atomic_store_explicit(&fronteira[p], 0, memory_order_relaxed);
+	}
+
+	busca->niveisBaixoParaCima += busca->baixoParaCima;
+	busca->alcancadas += descobertas;
+	busca->saidasNaoVisitadas -= saidasDescobertas;
+	busca->nivel++;
+	busca->terminada = busca->totalFila == 0;
+
+	if (busca->entradas == NULL)
+	{
+		return;
+	}
+
+	// A fronteira cresceu a ponto de as suas saídas superarem as entradas a examinar de baixo para cima,
+	// ou encolheu a ponto de varrer todas as salas não compensar mais.
+	if (!busca->baixoParaCima)
+	{
+		busca->baixoParaCima = saidasDescobertas * ALFA_DIRECAO_DISTANCIAS > busca->saidasNaoVisitadas;
+	}
+	else
+	{
+		busca->baixoParaCima = (int64_t)busca->totalFila * BETA_DIRECAO_DISTANCIAS >= busca->grafo->totalSalas;
+	}
+}
+
+/// @brief Executa a busca de distâncias em uma thread, nível a nível, até a fronteira esvaziar.
+static int executarTrabalhoDistancias(void* argumento)
+{
+	TrabalhoDistancias* trabalho = (TrabalhoDistancias*)argumento;
+	BuscaDistancias* busca = trabalho->busca;
+
+	while (true)
+	{
+		trabalho->descobertas = 0;
+		trabalho->saidasDescobertas = 0;
+		if (busca->baixoParaCima)
+		{
+			passoBaixoParaCimaDistancias(trabalho);
+		}
+		else
+		{
+			passoCimaParaBaixoDistancias(trabalho);
+		}
+		esvaziarFilaLocalDistancias(trabalho);
+
+		aguardarBarreira(&busca->barreira);
+		if (trabalho->indice == 0)
+		{
+			concluirNivelDistancias(busca);
+		}
+		aguardarBarreira(&busca->barreira);
+
+		if (busca->terminada)
+		{
+			break;
+		}
+	}
+
+	return 0;
+}
+
+int32_t calcularDistanciasGrafo(const MansaoGrafo* grafo, const MansaoGrafo* entradas, int32_t origem,
+	int32_t* distancias, int totalThreads, EstatisticasDistancias* estatisticas)
+{
+	if (grafo == NULL || distancias == NULL || origem < 0 || origem >= grafo->totalSalas ||
+		(entradas != NULL && entradas->totalSalas != grafo->totalSalas))
+	{
+		return -1;
+	}
+
+	totalThreads = totalThreads < 1 ? 1 : totalThreads > MAXIMO_THREADS_DISTANCIAS ? MAXIMO_THREADS_DISTANCIAS : totalThreads;
+	int32_t palavras = (grafo->totalSalas + 63) / 64;
+	BuscaDistancias* busca = (BuscaDistancias*)calloc(1, sizeof(BuscaDistancias));
+	atomic_ullong* mapas = (atomic_ullong*)calloc((size_t)palavras * 3, sizeof(atomic_ullong));
+	int32_t* filas = (int32_t*)malloc((size_t)grafo->totalSalas * 2 * sizeof(int32_t));
+	if (busca == NULL || mapas == NULL || filas == NULL || !iniciarBarreira(&busca->barreira, totalThreads))
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o cálculo das distâncias.\n");
+		free(busca);
+		free(mapas);
+		free(filas);
+		return -1;
+	}
+
+	busca->grafo = grafo;
+	busca->entradas = entradas;
+	busca->distancias = distancias;
+	busca->visitadas = mapas;
+	busca->fronteira = mapas + palavras;
+	busca->proximaFronteira = mapas + (size_t)palavras * 2;
+	busca->fila = filas;
+	busca->proximaFila = filas + grafo->totalSalas;
+	busca->palavras = palavras;
+	busca->totalTrabalhos = totalThreads;
+	atomic_init(&busca->totalProximaFila, 0);
+	atomic_init(&busca->proximoBloco, 0);
+
+	for (int32_t i = 0; i < grafo->totalSalas; i++)
+	{
+		distancias[i] = -1;
+	}
+	distancias[origem] = 0;
+	atomic_store(&busca->visitadas[origem / 64], 1ULL << (origem % 64));
+	atomic_store(&busca->fronteira[origem / 64], 1ULL << (origem % 64));
+	busca->fila[0] = origem;
+	busca->totalFila = 1;
+	busca->alcancadas = 1;
+	busca->saidasNaoVisitadas = grafo->totalSaidas - totalSaidasGrafo(grafo, origem);
+
+	for (int t = 0; t < totalThreads; t++)
+	{
+		busca->trabalhos[t].busca = busca;
+		busca->trabalhos[t].indice = t;
+	}
+
+	// A thread 0 é a atual; uma thread que não pôde ser criada sai da barreira, e os blocos de cada
+	// nível são divididos entre as restantes.
+	thrd_t threads[MAXIMO_THREADS_DISTANCIAS];
+	int criadas = 0;
+	for (int t = 1; t < totalThreads; t++)
+	{
+		if (thrd_create(&threads[criadas], executarTrabalhoDistancias, &busca->trabalhos[t]) != thrd_success)
+		{
+			retirarBarreira(&busca->barreira);
+			continue;
+		}
+		criadas++;
+	}
+	executarTrabalhoDistancias(&busca->trabalhos[0]);
+
+	for (int t = 0; t < criadas; t++)
+	{
+		thrd_join(threads[t], NULL);
+	}
+
+	int32_t alcancadas = busca->alcancadas;
+	if (estatisticas != NULL)
+	{
+		estatisticas->niveis = busca->nivel;
+		estatisticas->niveisBaixoParaCima = busca->niveisBaixoParaCima;
+		estatisticas->arestasExaminadas = 0;
+		for (int t = 0; t < totalThreads; t++)
+		{
+			estatisticas->arestasExaminadas += busca->trabalhos[t].arestasExaminadas;
+		}
+		estatisticas->totalThreads = criadas + 1;
+	}
+
+	destruirBarreira(&busca->barreira);
+	free(mapas);
+	free(filas);
+	free(busca);
+	return alcancadas;
+}
@@ -0,0 +1,106 @@
+#ifndef GRAFO_MANSAO_H
+#define GRAFO_MANSAO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Desafio Detective Quest
+// Grafo da mansão em linhas esparsas comprimidas(CSR): construção a partir de uma lista de arestas,
+// percurso em largura e cálculo das distâncias com a troca de direção, em várias threads.
+// As salas são apenas índices: os nomes e as pistas ficam com quem usa o grafo.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o índice devolvido quando uma sala ou saída do grafo não existe.
+#define SEM_SALA_GRAFO (-1)
+/// @brief Define a quantidade máxima de threads do cálculo de distâncias no grafo da mansão.
+#define MAXIMO_THREADS_DISTANCIAS 64
+/// @brief Define quando a busca em largura troca para o passo de baixo para cima: quando as saídas da
+/// fronteira passam de 1/ALFA das saídas das salas ainda não visitadas.
+#define ALFA_DIRECAO_DISTANCIAS 14
+/// @brief Define quando a busca em largura volta ao passo de cima para baixo: quando a fronteira
+/// fica com menos de 1/BETA das salas.
+#define BETA_DIRECAO_DISTANCIAS 24
+
+// **** Definições de estruturas. ****
+
+/// @brief Define a mansão como grafo, em linhas esparsas comprimidas(CSR): as saídas de todas as salas
+/// ficam em um único vetor denso, e as da sala i ocupam destinos[inicioSaidas[i] .. inicioSaidas[i + 1]).
+/// Cada sala pode ter qualquer quantidade de saídas, e as portas podem formar ciclos.
+typedef struct
+{
+	const int32_t* inicioSaidas; // totalSalas + 1 posições; a última é totalSaidas.
+	const int32_t* destinos; // Índice da sala de destino de cada saída.
+	int32_t totalSalas;
+	int32_t totalSaidas;
+} MansaoGrafo;
+
+/// @brief Define as estatísticas de um cálculo de distâncias no grafo da mansão.
+typedef struct
+{
+	int32_t niveis; // Níveis da busca em largura, incluindo o da sala de partida.
+	int32_t niveisBaixoParaCima; // Níveis percorridos das salas não visitadas para a fronteira.
+	int64_t arestasExaminadas;
+	int totalThreads; // Threads efetivamente usadas.
+} EstatisticasDistancias;
+
+// **** Funções do Grafo da Mansão ****
+
+/// @brief Recupera a quantidade de saídas de uma sala do grafo.
+/// @param MansaoGrafo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice da sala, válido.
+/// @returns Inteiro. Quantidade de saídas da sala.
+static inline int32_t totalSaidasGrafo(const MansaoGrafo* grafo, int32_t sala)
+{
+	return grafo->inicioSaidas[sala + 1] - grafo->inicioSaidas[sala];
+}
+/// @brief Segue uma saída de uma sala do grafo.
+/// @param MansaoGrafo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice da sala de origem.
+/// @param Inteiro. Posição da saída na sala, a partir de 0.
+/// @returns Inteiro. Índice da sala de destino, ou SEM_SALA_GRAFO se a sala ou a saída não existirem.
+static inline int32_t seguirSaidaGrafo(const MansaoGrafo* grafo, int32_t sala, int32_t saida)
+{
+	if (sala < 0 || sala >= grafo->totalSalas || saida < 0 || saida >= totalSaidasGrafo(grafo, sala))
+	{
+		return SEM_SALA_GRAFO;
+	}
+
+	return grafo->destinos[grafo->inicioSaidas[sala] + saida];
+}
+/// @brief Efetua a construção de um grafo da mansão a partir de uma lista de arestas, com uma ordenação
+/// por contagem em O(salas + arestas). As saídas de cada sala mantêm a ordem em que aparecem na lista.
+/// @param Inteiro. Quantidade de salas.
+/// @param Vetor. Sala de origem de cada aresta. Somente leitura.
+/// @param Vetor. Sala de destino de cada aresta. Somente leitura.
+/// @param Inteiro. Quantidade de arestas.
+/// @returns MansaoGrafo. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+MansaoGrafo* construirMansaoGrafo(int32_t totalSalas, const int32_t* origens, const int32_t* destinos, int32_t totalArestas);
+/// @brief Efetua um percurso em largura do grafo, sem recursão. Um mapa de bits das salas visitadas
+/// garante que cada sala entre uma única vez, mesmo com ciclos.
+/// @param MansaoGrafo. Ponteiro usado no percurso. Somente leitura.
+/// @param Inteiro. Índice da sala de partida.
+/// @param Vetor. Ponteiro para receber os índices das salas alcançadas, com capacidade para totalSalas.
+/// @returns Inteiro. Quantidade de salas alcançadas, ou -1 em caso de falha.
+int32_t percorrerMansaoGrafo(const MansaoGrafo* grafo, int32_t origem, int32_t* destino);
+/// @brief Libera a memória de um grafo criado por construirMansaoGrafo. Não deve receber um grafo sobre tabelas estáticas.
+/// @param MansaoGrafo. Ponteiro via referência, usado na operação de liberação.
+void liberarMansaoGrafo(MansaoGrafo* grafo);
+/// @brief Calcula a distância, em saídas, da sala de partida até todas as salas, em uma única busca em largura.
+/// A cada nível, a busca escolhe a direção: de cima para baixo(saídas da fronteira) ou, com o grafo das
+/// entradas, de baixo para cima(entradas das salas não visitadas), o que evita examinar as saídas de uma
+/// fronteira grande. A fronteira é mantida como fila e como mapa de bits, e os blocos de cada nível são
+/// distribuídos entre as threads, com uma fila local por thread.
+/// @param MansaoGrafo. Ponteiro do grafo das saídas. Somente leitura.
+/// @param MansaoGrafo. Ponteiro do grafo transposto(as entradas de cada sala), ou NULL para buscar apenas
+/// de cima para baixo. Somente leitura.
+/// @param Inteiro. Índice da sala de partida.
+/// @param Vetor. Ponteiro para receber a distância de cada sala, ou -1 nas salas inalcançáveis.
+/// @param Inteiro. Quantidade de threads, de 1 a MAXIMO_THREADS_DISTANCIAS.
+/// @param EstatisticasDistancias. Ponteiro para receber as estatísticas da busca, ou NULL.
+/// @returns Inteiro. Quantidade de salas alcançadas, ou -1 em caso de falha.
+int32_t calcularDistanciasGrafo(const MansaoGrafo* grafo, const MansaoGrafo* entradas, int32_t origem,
+	int32_t* distancias, int totalThreads, EstatisticasDistancias* estatisticas);
+
+#endif
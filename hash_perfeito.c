@@ -0,0 +1,330 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "hash_perfeito.h"
+
+// Desafio Detective Quest
+// Implementação do hash perfeito mínimo: construção por baldes e pilotos, e consulta.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a média de chaves por balde do hash perfeito: baldes maiores ocupam menos bits por chave,
+/// mas os seus pilotos demoram mais para ser encontrados.
+#define CHAVES_POR_BALDE_PERFEITO 5
+/// @brief Define as posições a mais da busca do hash perfeito, em milésimos das chaves(ocupação de 99%).
+#define EXCEDENTE_POSICOES_PERFEITO 10
+/// @brief Define o maior piloto tentado em um balde antes de recomeçar a construção com outra semente.
+#define MAXIMO_PILOTO_PERFEITO (1u << 20)
+/// @brief Define quantas sementes são tentadas na construção do hash perfeito.
+#define TENTATIVAS_HASH_PERFEITO 8
+// **** Funções do Hash Perfeito ****
+
+/// @brief Efetua o hash de 64 bits de uma chave(FNV-1a, com mistura final).
+static uint64_t hashChavePerfeito(const char* chave)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (const unsigned char* p = (const unsigned char*)chave; *p != '\0'; p++)
+	{
+		h ^= *p;
+		h *= 1099511628211ULL;
+	}
+
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+/// @brief Mistura sem estado(splitmix64) de uma semente, um fluxo e um valor: a semente da construção
+/// redistribui as chaves, e cada piloto leva as chaves de um balde a outras posições.
+static uint64_t sortearHashPerfeito(uint64_t semente, uint64_t fluxo, uint64_t valor)
+{
+	uint64_t z = semente + fluxo * 0xD1B54A32D192ED03ULL + (valor + 1) * 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/// @brief Reduz um valor ao intervalo [0, limite), sem divisão.
+static uint32_t reduzirHashPerfeito(uint64_t valor, uint32_t limite)
+{
+	return (uint32_t)(((valor >> 32) * (uint64_t)limite) >> 32);
+}
+
+/// @brief Recupera o balde de uma chave do hash perfeito. 60% das chaves vão para os primeiros 30% dos
+/// baldes: esses baldes, maiores, são posicionados primeiro, com a tabela ainda vazia, e os demais,
+/// pequenos, encontram com facilidade as posições que sobram.
+static inline uint32_t baldeHashPerfeito(const HashPerfeito* hash, uint64_t chave)
+{
+	if ((chave >> 32) < 0x9999999AULL) // 60% de 2^32.
+	{
+		return reduzirHashPerfeito(chave << 32, hash->baldesDensos);
+	}
+	return hash->baldesDensos + reduzirHashPerfeito(chave << 32, hash->totalBaldes - hash->baldesDensos);
+}
+
+/// @brief Recupera a posição de uma chave com um piloto, antes do remapeamento das posições excedentes.
+static inline uint32_t posicaoPilotoHashPerfeito(const HashPerfeito* hash, uint64_t chave, uint64_t piloto)
+{
+	return reduzirHashPerfeito(sortearHashPerfeito(chave, 3, piloto), hash->totalPosicoes);
+}
+
+/// @brief Lê um piloto do vetor compactado, que pode atravessar duas palavras.
+static inline uint64_t lerPilotoHashPerfeito(const HashPerfeito* hash, uint32_t balde)
+{
+	uint64_t bit = (uint64_t)balde * hash->bitsPiloto;
+	uint32_t deslocamento = (uint32_t)(bit % 64);
+	uint64_t valor = hash->pilotos[bit / 64] >> deslocamento;
+	if (deslocamento + hash->bitsPiloto > 64)
+	{
+		valor |= hash->pilotos[bit / 64 + 1] << (64 - deslocamento);
+	}
+	return valor & ((1ULL << hash->bitsPiloto) - 1);
+}
+
+/// @brief Tenta construir o hash perfeito com uma semente: distribui as chaves nos baldes(counting sort),
+/// ordena os baldes do maior para o menor e procura, para cada um, o menor piloto que leva todas as
+/// suas chaves a posições livres. Falha se algum balde passar de MAXIMO_PILOTO_PERFEITO.
+/// @param Vetor. Hash de 64 bits de cada chave.
+/// @param Inteiro. Quantidade de chaves.
+/// @param Inteiro. Semente da tentativa.
+/// @param Bool. Ponteiro via referência, marcado quando há chaves repetidas(nenhuma semente as separa).
+/// @returns HashPerfeito. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+static HashPerfeito* tentarHashPerfeito(const uint64_t* hashes, uint32_t total, uint64_t semente, bool* repetidas)
+{
+	HashPerfeito* hash = (HashPerfeito*)calloc(1, sizeof(HashPerfeito));
+	if (hash == NULL)
+	{
+		return NULL;
+	}
+	hash->semente = semente;
+	hash->totalChaves = total;
+	hash->totalPosicoes = total + (uint32_t)((uint64_t)total * EXCEDENTE_POSICOES_PERFEITO / 1000);
+	hash->totalBaldes = (total + CHAVES_POR_BALDE_PERFEITO - 1) / CHAVES_POR_BALDE_PERFEITO;
+	hash->totalBaldes = hash->totalBaldes < 2 ? 2 : hash->totalBaldes;
+	hash->baldesDensos = hash->totalBaldes * 3 / 10;
+	hash->baldesDensos = hash->baldesDensos < 1 ? 1 : hash->baldesDensos;
+
+	uint32_t totalBaldes = hash->totalBaldes;
+	uint64_t* chaves = (uint64_t*)malloc((size_t)total * sizeof(uint64_t));
+	uint64_t* ordenadas = (uint64_t*)malloc((size_t)total * sizeof(uint64_t));
+	uint32_t* inicioBaldes = (uint32_t*)calloc((size_t)totalBaldes + 1, sizeof(uint32_t));
+	uint32_t* ordemBaldes = (uint32_t*)malloc((size_t)totalBaldes * sizeof(uint32_t));
+	uint32_t* pilotos = (uint32_t*)malloc((size_t)totalBaldes * sizeof(uint32_t));
+	uint64_t* ocupadas = (uint64_t*)calloc(((size_t)hash->totalPosicoes + 63) / 64, sizeof(uint64_t));
+	uint32_t* cursor = NULL;
+	uint32_t* posicoes = NULL;
+	bool sucesso = chaves != NULL && ordenadas != NULL && inicioBaldes != NULL && ordemBaldes != NULL &&
+		pilotos != NULL && ocupadas != NULL;
+
+	// Chaves agrupadas por balde: contagem, soma acumulada e preenchimento.
+	uint32_t maiorBalde = 0;
+	if (sucesso)
+	{
+		for (uint32_t i = 0; i < total; i++)
+		{
+			chaves[i] = sortearHashPerfeito(semente, 0, hashes[i]);
+			inicioBaldes[baldeHashPerfeito(hash, chaves[i]) + 1]++;
+		}
+		for (uint32_t b = 0; b < totalBaldes; b++)
+		{
+			maiorBalde = inicioBaldes[b + 1] > maiorBalde ? inicioBaldes[b + 1] : maiorBalde;
+			inicioBaldes[b + 1] += inicioBaldes[b];
+		}
+
+		cursor = (uint32_t*)malloc(((size_t)totalBaldes + (size_t)maiorBalde + 2) * sizeof(uint32_t));
+		posicoes = (uint32_t*)malloc(((size_t)maiorBalde + 1) * sizeof(uint32_t));
+		sucesso = cursor != NULL && posicoes != NULL;
+	}
+	if (sucesso)
+	{
+		memcpy(cursor, inicioBaldes, (size_t)totalBaldes * sizeof(uint32_t));
+		for (uint32_t i = 0; i < total; i++)
+		{
+			ordenadas[cursor[baldeHashPerfeito(hash, chaves[i])]++] = chaves[i];
+		}
+
+		// Baldes do maior para o menor, também por contagem: os tamanhos são pequenos.
+		uint32_t* contagem = cursor;
+		memset(contagem, 0, ((size_t)maiorBalde + 2) * sizeof(uint32_t));
+		for (uint32_t b = 0; b < totalBaldes; b++)
+		{
+			contagem[maiorBalde - (inicioBaldes[b + 1] - inicioBaldes[b]) + 1]++;
+		}
+		for (uint32_t t = 0; t <= maiorBalde; t++)
+		{
+			contagem[t + 1] += contagem[t];
+		}
+		for (uint32_t b = 0; b < totalBaldes; b++)
+		{
+			ordemBaldes[contagem[maiorBalde - (inicioBaldes[b + 1] - inicioBaldes[b])]++] = b;
+		}
+	}
+
+	// Busca dos pilotos. Cada tentativa custa um hash por chave do balde.
+	uint32_t maiorPiloto = 0;
+	for (uint32_t i = 0; i < totalBaldes && sucesso; i++)
+	{
+		uint32_t balde = ordemBaldes[i];
+		const uint64_t* chavesBalde = ordenadas + inicioBaldes[balde];
+		uint32_t tamanho = inicioBaldes[balde + 1] - inicioBaldes[balde];
+
+		// Chaves iguais no mesmo balde iriam sempre para a mesma posição.
+		for (uint32_t a = 0; a < tamanho && sucesso; a++)
+		{
+			for (uint32_t c = a + 1; c < tamanho && sucesso; c++)
+			{
+				sucesso = chavesBalde[a] != chavesBalde[c];
+			}
+		}
+		if (!sucesso)
+		{
+			*repetidas = true;
+			break;
+		}
+
+		uint32_t piloto = 0;
+		for (;; piloto++)
+		{
+			if (piloto > MAXIMO_PILOTO_PERFEITO)
+			{
+				sucesso = false;
+				break;
+			}
+
+			bool livre = true;
+			for (uint32_t k = 0; k < tamanho && livre; k++)
+			{
+				uint32_t posicao = posicaoPilotoHashPerfeito(hash, chavesBalde[k], piloto);
+				livre = (ocupadas[posicao / 64] & (1ULL << (posicao % 64))) == 0;
+				for (uint32_t j = 0; j < k && livre; j++)
+				{
+					livre = posicoes[j] != posicao;
+				}
+				posicoes[k] = posicao;
+			}
+			if (livre)
+			{
+				break;
+			}
+		}
+
+		for (uint32_t k = 0; k < tamanho && sucesso; k++)
+		{
+			ocupadas[posicoes[k] / 64] |= 1ULL << (posicoes[k] % 64);
+		}
+		pilotos[balde] = piloto;
+		maiorPiloto = piloto > maiorPiloto ? piloto : maiorPiloto;
+	}
+
+	// Pilotos compactados com a largura do maior, e as posições excedentes remapeadas para as livres.
+	if (sucesso)
+	{
+		hash->bitsPiloto = 1;
+		while (hash->bitsPiloto < 32 && (maiorPiloto >> hash->bitsPiloto) != 0)
+		{
+			hash->bitsPiloto++;
+		}
+		uint32_t excedentes = hash->totalPosicoes - total;
+		hash->pilotos = (uint64_t*)calloc(((size_t)totalBaldes * hash->bitsPiloto + 63) / 64 + 1, sizeof(uint64_t));
+		hash->remapeamento = (uint32_t*)calloc(excedentes > 0 ? excedentes : 1, sizeof(uint32_t));
+		sucesso = hash->pilotos != NULL && hash->remapeamento != NULL;
+	}
+	if (sucesso)
+	{
+		for (uint32_t b = 0; b < totalBaldes; b++)
+		{
+			uint64_t bit = (uint64_t)b * hash->bitsPiloto;
+			uint32_t deslocamento = (uint32_t)(bit % 64);
+			hash->pilotos[bit / 64] |= (uint64_t)pilotos[b] << deslocamento;
+			if (deslocamento + hash->bitsPiloto > 64)
+			{
+				hash->pilotos[bit / 64 + 1] |= (uint64_t)pilotos[b] >> (64 - deslocamento);
+			}
+		}
+
+		// Há tantas posições excedentes ocupadas quanto posições livres abaixo de totalChaves.
+		uint32_t livre = 0;
+		for (uint32_t posicao = total; posicao < hash->totalPosicoes; posicao++)
+		{
+			if (ocupadas[posicao / 64] & (1ULL << (posicao % 64)))
+			{
+				while (ocupadas[livre / 64] & (1ULL << (livre % 64)))
+				{
+					livre++;
+				}
+				hash->remapeamento[posicao - total] = livre++;
+			}
+		}
+	}
+
+	free(chaves);
+	free(ordenadas);
+	free(inicioBaldes);
+	free(ordemBaldes);
+	free(pilotos);
+	free(ocupadas);
+	free(cursor);
+	free(posicoes);
+	if (!sucesso)
+	{
+		liberarHashPerfeito(hash);
+		return NULL;
+	}
+	return hash;
+}
+
+HashPerfeito* construirHashPerfeito(const char* const* chaves, int32_t totalChaves, uint64_t semente)
+{
+	if (totalChaves < 1)
+	{
+		return NULL;
+	}
+
+	uint64_t* hashes = (uint64_t*)malloc((size_t)totalChaves * sizeof(uint64_t));
+	if (hashes == NULL)
+	{
+		return NULL;
+	}
+	for (int32_t i = 0; i < totalChaves; i++)
+	{
+		hashes[i] = hashChavePerfeito(chaves[i]);
+	}
+
+	// Uma semente nova redistribui todas as chaves; chaves repetidas, não.
+	HashPerfeito* hash = NULL;
+	bool repetidas = false;
+	for (uint64_t tentativa = 0; tentativa < TENTATIVAS_HASH_PERFEITO && hash == NULL && !repetidas; tentativa++)
+	{
+		hash = tentarHashPerfeito(hashes, (uint32_t)totalChaves, sortearHashPerfeito(semente, 2, tentativa), &repetidas);
+	}
+	free(hashes);
+
+	return hash;
+}
+
+int32_t posicaoHashPerfeito(const HashPerfeito* hash, const char* chave)
+{
+	uint64_t valor = sortearHashPerfeito(hash->semente, 0, hashChavePerfeito(chave));
+	uint64_t piloto = lerPilotoHashPerfeito(hash, baldeHashPerfeito(hash, valor));
+	uint32_t posicao = posicaoPilotoHashPerfeito(hash, valor, piloto);
+	return (int32_t)(posicao < hash->totalChaves ? posicao : hash->remapeamento[posicao - hash->totalChaves]);
+}
+
+double bitsPorChaveHashPerfeito(const HashPerfeito* hash)
+{
+	double bits = (double)hash->totalBaldes * hash->bitsPiloto + 32.0 * (hash->totalPosicoes - hash->totalChaves);
+	return bits / hash->totalChaves;
+}
+
+void liberarHashPerfeito(HashPerfeito* hash)
+{
+	if (hash == NULL)
+		return;
+
+	free(hash->pilotos);
+	free(hash->remapeamento);
+	free(hash);
+}
@@ -0,0 +1,52 @@
+#ifndef HASH_PERFEITO_H
+#define HASH_PERFEITO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Desafio Detective Quest
+// Hash perfeito mínimo(da família PTHash) sobre um conjunto fixo de textos: cada chave recebe uma
+// posição distinta em [0, totalChaves), e a consulta é um hash e a leitura de um piloto.
+// As chaves não são guardadas: quem consulta confere a chave da posição recebida.
+
+// **** Definições de estruturas. ****
+
+/// @brief Define uma função de hash perfeita mínima(da família PTHash) sobre um conjunto fixo de chaves:
+/// cada chave recebe uma posição distinta em [0, totalChaves). As chaves caem em baldes, e cada balde
+/// guarda o piloto que leva as suas chaves a posições livres; a consulta não tem listas nem posições vazias.
+typedef struct
+{
+	uint64_t semente;
+	uint32_t totalChaves;
+	uint32_t totalPosicoes; // Posições da busca(1% a mais que as chaves); as excedentes são remapeadas.
+	uint32_t totalBaldes;
+	uint32_t baldesDensos; // Primeiros baldes, que recebem a maior parte das chaves.
+	uint32_t bitsPiloto; // Largura de cada piloto no vetor compactado.
+	uint64_t* pilotos; // Piloto de cada balde, com bitsPiloto bits.
+	uint32_t* remapeamento; // Posição livre, abaixo de totalChaves, de cada posição excedente ocupada.
+} HashPerfeito;
+
+// **** Funções do Hash Perfeito ****
+
+/// @brief Constrói um hash perfeito mínimo sobre chaves distintas, em tempo linear.
+/// @param Vetor. Chaves a posicionar.
+/// @param Inteiro. Quantidade de chaves.
+/// @param Inteiro. Semente da construção.
+/// @returns HashPerfeito. Ponteiro do tipo conforme especificado, ou NULL em caso de falha(ou chaves repetidas).
+HashPerfeito* construirHashPerfeito(const char* const* chaves, int32_t totalChaves, uint64_t semente);
+/// @brief Recupera a posição de uma chave no hash perfeito. Uma chave fora do conjunto também recebe
+/// uma posição válida, então quem consulta confere a chave guardada na posição.
+/// @param HashPerfeito. Ponteiro usado na consulta. Somente leitura.
+/// @param Texto. Ponteiro para o valor de texto da chave.
+/// @returns Inteiro. Posição em [0, totalChaves).
+int32_t posicaoHashPerfeito(const HashPerfeito* hash, const char* chave);
+/// @brief Recupera o tamanho do hash perfeito: os pilotos e o remapeamento, sem as chaves.
+/// @param HashPerfeito. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Decimal. Quantidade de bits por chave.
+double bitsPorChaveHashPerfeito(const HashPerfeito* hash);
+/// @brief Libera a memória alocada para o hash perfeito.
+/// @param HashPerfeito. Ponteiro via referência, usado na operação de liberação.
+void liberarHashPerfeito(HashPerfeito* hash);
+
+#endif
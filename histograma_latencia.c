@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+#include "histograma_latencia.h"
+
+// Desafio Detective Quest
+// Implementação do histograma de latências: cálculo das faixas, registro, percentis e formatação.
+
+// **** Funções dos Histogramas de Latência ****
+
+/// @brief Calcula a faixa de uma latência: exata abaixo de 2 * SUBFAIXAS_LATENCIA; acima, o expoente
+/// da potência de dois e os BITS_SUBFAIXAS_LATENCIA bits seguintes ao mais significativo.
+static inline int32_t faixaLatencia(uint64_t valor)
+{
+	if (valor < 2 * SUBFAIXAS_LATENCIA)
+	{
+		return (int32_t)valor;
+	}
+
+#if defined(__GNUC__) || defined(__clang__)
+	int bitMaisAlto = 63 - __builtin_clzll(valor);
+#else
+	int bitMaisAlto = 0;
+	for (uint64_t resto = valor >> 1; resto != 0; resto >>= 1)
+	{
+		bitMaisAlto++;
+	}
+#endif
+	int expoente = bitMaisAlto - BITS_SUBFAIXAS_LATENCIA;
+	return (expoente + 1) * SUBFAIXAS_LATENCIA + (int32_t)((valor >> expoente) - SUBFAIXAS_LATENCIA);
+}
+
+/// @brief Recupera o maior valor de uma faixa do histograma.
+static uint64_t limiteFaixaLatencia(int32_t faixa)
+{
+	if (faixa < 2 * SUBFAIXAS_LATENCIA)
+	{
+		return (uint64_t)faixa;
+	}
+
+	int expoente = faixa / SUBFAIXAS_LATENCIA - 1;
+	uint64_t mantissa = (uint64_t)(faixa % SUBFAIXAS_LATENCIA + SUBFAIXAS_LATENCIA);
+	return ((mantissa + 1) << expoente) - 1;
+}
+
+uint64_t instanteLatencia()
+{
+#ifdef _WIN32
+	LARGE_INTEGER contador, frequencia;
+	QueryPerformanceCounter(&contador);
+	QueryPerformanceFrequency(&frequencia);
+	return (uint64_t)((double)contador.QuadPart * 1e9 / (double)frequencia.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+void registrarLatencia(HistogramaLatencia* histograma, uint64_t nanossegundos)
+{
+	if (nanossegundos >= (1ULL << BITS_LATENCIA))
+	{
+		nanossegundos = (1ULL << BITS_LATENCIA) - 1;
+	}
+
+	histograma->contagens[faixaLatencia(nanossegundos)]++;
+	histograma->total++;
+	histograma->soma += nanossegundos;
+	if (nanossegundos > histograma->maximo)
+	{
+		histograma->maximo = nanossegundos;
+	}
+}
+
+uint64_t percentilLatencia(const HistogramaLatencia* histograma, double fracao)
+{
+	if (histograma->total == 0)
+	{
+		return 0;
+	}
+
+	// Posição(a partir de 1) da latência do percentil, entre as registradas em ordem crescente.
+	uint64_t alvo = (uint64_t)ceil(fracao * (double)histograma->total);
+	alvo = alvo < 1 ? 1 : (alvo > histograma->total ? histograma->total : alvo);
+
+	uint64_t acumulado = 0;
+	for (int32_t faixa = 0; faixa < FAIXAS_LATENCIA; faixa++)
+	{
+		acumulado += histograma->contagens[faixa];
+		if (acumulado >= alvo)
+		{
+			uint64_t limite = limiteFaixaLatencia(faixa);
+			return limite < histograma->maximo ? limite : histograma->maximo;
+		}
+	}
+
+	return histograma->maximo;
+}
+
+void formatarLatencia(char* destino, size_t capacidade, uint64_t nanossegundos)
+{
+	if (nanossegundos < 1000)
+	{
+		snprintf(destino, capacidade, "%llu ns", (unsigned long long)nanossegundos);
+	}
+	else if (nanossegundos < 1000000)
+	{
+		snprintf(destino, capacidade, "%.1f µs", nanossegundos / 1e3);
+	}
+	else if (nanossegundos < 1000000000)
+	{
+		snprintf(destino, capacidade, "%.1f ms", nanossegundos / 1e6);
+	}
+	else
+	{
+		snprintf(destino, capacidade, "%.2f s", nanossegundos / 1e9);
+	}
+}
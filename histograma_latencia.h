@@ -0,0 +1,57 @@
+#ifndef HISTOGRAMA_LATENCIA_H
+#define HISTOGRAMA_LATENCIA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Desafio Detective Quest
+// Histograma de latências em escala log-linear(estilo HDR), com registro em tempo constante e percentis
+// calculados só na consulta, e a leitura do relógio monotônico usada para medir as latências.
+
+// **** Definições de constantes. ****
+
+/// @brief Define os bits das subfaixas do histograma de latências: cada potência de dois é dividida em
+/// 2^BITS_SUBFAIXAS_LATENCIA faixas, com erro relativo de até 1/64.
+#define BITS_SUBFAIXAS_LATENCIA 6
+/// @brief Define a quantidade de subfaixas de cada potência de dois do histograma de latências.
+#define SUBFAIXAS_LATENCIA (1 << BITS_SUBFAIXAS_LATENCIA)
+/// @brief Define os bits das latências registradas, em nanossegundos(2^44 ns, cerca de 4,9 horas). Acima disso, são truncadas.
+#define BITS_LATENCIA 44
+/// @brief Define a quantidade de faixas do histograma de latências.
+#define FAIXAS_LATENCIA ((BITS_LATENCIA - BITS_SUBFAIXAS_LATENCIA + 1) * SUBFAIXAS_LATENCIA)
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um histograma de latências em escala log-linear(estilo HDR): os valores abaixo de
+/// 2 * SUBFAIXAS_LATENCIA são exatos, e cada potência de dois acima deles é dividida em SUBFAIXAS_LATENCIA faixas.
+/// Registrar é um incremento; os percentis são calculados só na exibição.
+typedef struct
+{
+	uint64_t contagens[FAIXAS_LATENCIA];
+	uint64_t total;
+	uint64_t maximo;
+	uint64_t soma;
+} HistogramaLatencia;
+
+// **** Funções dos Histogramas de Latência ****
+
+/// @brief Lê o relógio monotônico.
+/// @returns Inteiro. Instante atual, em nanossegundos.
+uint64_t instanteLatencia();
+/// @brief Registra uma latência no histograma.
+/// @param HistogramaLatencia. Ponteiro via referência, usado no registro.
+/// @param Inteiro. Latência, em nanossegundos.
+void registrarLatencia(HistogramaLatencia* histograma, uint64_t nanossegundos);
+/// @brief Calcula um percentil do histograma: o maior valor da faixa onde ele cai(erro relativo de até 1/64).
+/// @param HistogramaLatencia. Ponteiro usado no cálculo. Somente leitura.
+/// @param Real. Fração das latências(ex: 0.99 para o p99).
+/// @returns Inteiro. Latência, em nanossegundos, ou zero se o histograma estiver vazio.
+uint64_t percentilLatencia(const HistogramaLatencia* histograma, double fracao);
+/// @brief Formata uma latência com a unidade adequada(ns, µs, ms ou s).
+/// @param Texto. Ponteiro via referência, para receber o texto.
+/// @param Inteiro. Capacidade do destino, em bytes.
+/// @param Inteiro. Latência, em nanossegundos.
+void formatarLatencia(char* destino, size_t capacidade, uint64_t nanossegundos);
+
+#endif
@@ -0,0 +1,312 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "filtro_bloom.h"
+#include "mansao_colunar.h"
+#include "indice_salas.h"
+
+// Desafio Detective Quest
+// Implementação do índice das salas por nome.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem cria o índice informa as falhas.
+
+// **** Funções do Índice de Salas por Nome ****
+
+/// @brief Define um nome distinto na ordenação do índice, com a sua posição de chegada.
+typedef struct
+{
+	const char* nome;
+	int32_t posicao;
+} NomeIndiceSalas;
+
+/// @brief Compara dois nomes do índice pelo texto(strcmp), para a ordenação.
+static int compararNomesIndiceSalas(const void* a, const void* b)
+{
+	return strcmp(((const NomeIndiceSalas*)a)->nome, ((const NomeIndiceSalas*)b)->nome);
+}
+
+/// @brief Localiza a posição da tabela que guarda um nome ou, se ele não está no índice,
+/// a posição livre onde entraria. A marca escolhe a posição inicial e evita a maioria das comparações.
+static uint32_t localizarNomeIndiceSalas(const IndiceSalas* indice, const char* nome, uint32_t marca)
+{
+	uint32_t posicao = marca & indice->mascara;
+	for (;;)
+	{
+		int32_t candidato = indice->tabela[posicao];
+		if (candidato == SEM_INDICE_COLUNAR ||
+			(indice->marcas[candidato] == marca && strcmp(indice->nomes[candidato], nome) == 0))
+		{
+			return posicao;
+		}
+		posicao = (posicao + 1) & indice->mascara;
+	}
+}
+
+/// @brief Dobra a capacidade da tabela e dos vetores de nomes, reposicionando os nomes pelas marcas.
+static bool ampliarIndiceSalas(IndiceSalas* indice)
+{
+	uint32_t capacidade = indice->tabela == NULL ? 64 : (indice->mascara + 1) * 2;
+	int32_t* tabela = (int32_t*)malloc((size_t)capacidade * sizeof(int32_t));
+	const char** nomes = (const char**)realloc((void*)indice->nomes, (size_t)(capacidade / 2) * sizeof(const char*));
+	if (nomes != NULL)
+	{
+		indice->nomes = nomes;
+	}
+	uint32_t* marcas = (uint32_t*)realloc(indice->marcas, (size_t)(capacidade / 2) * sizeof(uint32_t));
+	if (marcas != NULL)
+	{
+		indice->marcas = marcas;
+	}
+	if (tabela == NULL || nomes == NULL || marcas == NULL)
+	{
+		free(tabela);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < capacidade; i++)
+	{
+		tabela[i] = SEM_INDICE_COLUNAR;
+	}
+	free(indice->tabela);
+	indice->tabela = tabela;
+	indice->mascara = capacidade - 1;
+	for (int32_t i = 0; i < indice->totalNomes; i++)
+	{
+		uint32_t posicao = indice->marcas[i] & indice->mascara;
+		while (tabela[posicao] != SEM_INDICE_COLUNAR)
+		{
+			posicao = (posicao + 1) & indice->mascara;
+		}
+		tabela[posicao] = i;
+	}
+
+	return true;
+}
+
+/// @brief Coloca os nomes distintos do índice em ordem alfabética, atualizando a tabela hash.
+/// @returns Vetor. Nova posição de cada nome, pela posição de chegada, ou NULL em caso de falha.
+static int32_t* ordenarNomesIndiceSalas(IndiceSalas* indice)
+{
+	size_t totalNomes = indice->totalNomes > 0 ? (size_t)indice->totalNomes : 1;
+	NomeIndiceSalas* ordem = (NomeIndiceSalas*)malloc(totalNomes * sizeof(NomeIndiceSalas));
+	uint32_t* marcas = (uint32_t*)malloc(totalNomes * sizeof(uint32_t));
+	int32_t* novaPosicao = (int32_t*)malloc(totalNomes * sizeof(int32_t));
+	if (ordem == NULL || marcas == NULL || novaPosicao == NULL)
+	{
+		free(ordem);
+		free(marcas);
+		free(novaPosicao);
+		return NULL;
+	}
+
+	for (int32_t i = 0; i < indice->totalNomes; i++)
+	{
+		ordem[i].nome = indice->nomes[i];
+		ordem[i].posicao = i;
+	}
+	qsort(ordem, (size_t)indice->totalNomes, sizeof(NomeIndiceSalas), compararNomesIndiceSalas);
+
+	for (int32_t i = 0; i < indice->totalNomes; i++)
+	{
+		novaPosicao[ordem[i].posicao] = i;
+		indice->nomes[i] = ordem[i].nome;
+		marcas[i] = indice->marcas[ordem[i].posicao];
+	}
+	memcpy(indice->marcas, marcas, (size_t)indice->totalNomes * sizeof(uint32_t));
+	for (uint32_t i = 0; i <= indice->mascara; i++)
+	{
+		if (indice->tabela[i] != SEM_INDICE_COLUNAR)
+		{
+			indice->tabela[i] = novaPosicao[indice->tabela[i]];
+		}
+	}
+
+	free(ordem);
+	free(marcas);
+	return novaPosicao;
+}
+
+IndiceSalas* criarIndiceSalas(const char* const* textos, int32_t totalTextos, const int32_t* nomes, int32_t totalSalas)
+{
+	if (textos == NULL || totalTextos < 0 || totalSalas < 0 || (nomes == NULL && totalTextos != totalSalas))
+	{
+		return NULL;
+	}
+
+	IndiceSalas* indice = (IndiceSalas*)calloc(1, sizeof(IndiceSalas));
+	// Nome distinto de cada texto, atribuído na primeira sala que o usa: com os nomes internados,
+	// cada texto passa pelo hash uma única vez, por mais salas que o compartilhem.
+	int32_t* nomeTexto = (int32_t*)malloc((size_t)(totalTextos > 0 ? totalTextos : 1) * sizeof(int32_t));
+	bool sucesso = indice != NULL && nomeTexto != NULL && ampliarIndiceSalas(indice);
+	for (int32_t t = 0; t < totalTextos && sucesso; t++)
+	{
+		nomeTexto[t] = SEM_INDICE_COLUNAR;
+	}
+
+	for (int32_t i = 0; i < totalSalas && sucesso; i++)
+	{
+		int32_t texto = nomes != NULL ? nomes[i] : i;
+		sucesso = texto >= 0 && texto < totalTextos;
+		if (!sucesso || nomeTexto[texto] != SEM_INDICE_COLUNAR)
+		{
+			continue;
+		}
+
+		if (((uint32_t)indice->totalNomes + 1) * 2 > indice->mascara + 1 && !ampliarIndiceSalas(indice))
+		{
+			sucesso = false;
+			continue;
+		}
+		uint32_t marca = (uint32_t)(hashFiltroBloom(textos[texto]) >> 32);
+		uint32_t posicao = localizarNomeIndiceSalas(indice, textos[texto], marca);
+		if (indice->tabela[posicao] == SEM_INDICE_COLUNAR)
+		{
+			indice->nomes[indice->totalNomes] = textos[texto];
+			indice->marcas[indice->totalNomes] = marca;
+			indice->tabela[posicao] = indice->totalNomes++;
+		}
+		nomeTexto[texto] = indice->tabela[posicao];
+	}
+
+	// Nomes em ordem alfabética e, para cada nome, as suas salas(contagem, soma prefixada e distribuição).
+	int32_t* novaPosicao = sucesso ? ordenarNomesIndiceSalas(indice) : NULL;
+	if (novaPosicao != NULL)
+	{
+		indice->totalSalas = totalSalas;
+		indice->inicioSalas = (int32_t*)calloc((size_t)indice->totalNomes + 1, sizeof(int32_t));
+		indice->salas = (int32_t*)malloc((size_t)(totalSalas > 0 ? totalSalas : 1) * sizeof(int32_t));
+	}
+	sucesso = novaPosicao != NULL && indice->inicioSalas != NULL && indice->salas != NULL;
+	if (sucesso)
+	{
+		for (int32_t t = 0; t < totalTextos; t++)
+		{
+			if (nomeTexto[t] != SEM_INDICE_COLUNAR)
+			{
+				nomeTexto[t] = novaPosicao[nomeTexto[t]];
+			}
+		}
+		for (int32_t i = 0; i < totalSalas; i++)
+		{
+			indice->inicioSalas[nomeTexto[nomes != NULL ? nomes[i] : i] + 1]++;
+		}
+		for (int32_t n = 0; n < indice->totalNomes; n++)
+		{
+			indice->inicioSalas[n + 1] += indice->inicioSalas[n];
+			novaPosicao[n] = indice->inicioSalas[n]; // Daqui em diante, o próximo lugar livre de cada nome.
+		}
+		for (int32_t i = 0; i < totalSalas; i++)
+		{
+			indice->salas[novaPosicao[nomeTexto[nomes != NULL ? nomes[i] : i]]++] = i;
+		}
+	}
+
+	free(novaPosicao);
+	free(nomeTexto);
+	if (!sucesso)
+	{
+		liberarIndiceSalas(indice);
+		return NULL;
+	}
+
+	return indice;
+}
+
+int32_t buscarSalasPorNome(const IndiceSalas* indice, const char* nome, const int32_t** salas)
+{
+	uint32_t marca = (uint32_t)(hashFiltroBloom(nome) >> 32);
+	int32_t posicao = indice->tabela[localizarNomeIndiceSalas(indice, nome, marca)];
+	if (posicao == SEM_INDICE_COLUNAR)
+	{
+		if (salas != NULL)
+		{
+			*salas = NULL;
+		}
+		return 0;
+	}
+
+	if (salas != NULL)
+	{
+		*salas = indice->salas + indice->inicioSalas[posicao];
+	}
+	return indice->inicioSalas[posicao + 1] - indice->inicioSalas[posicao];
+}
+
+int32_t completarNomeSala(const IndiceSalas* indice, const char* prefixo, int32_t* primeiro, char* comum, size_t capacidade)
+{
+	size_t tamanho = strlen(prefixo);
+
+	// Primeiro nome maior ou igual ao prefixo; os nomes com o prefixo vêm todos a partir dele.
+	int32_t inicio = 0, fim = indice->totalNomes;
+	while (inicio < fim)
+	{
+		int32_t meio = inicio + (fim - inicio) / 2;
+		if (strcmp(indice->nomes[meio], prefixo) < 0)
+		{
+			inicio = meio + 1;
+		}
+		else
+		{
+			fim = meio;
+		}
+	}
+	int32_t limite = inicio;
+	fim = indice->totalNomes;
+	while (limite < fim)
+	{
+		int32_t meio = limite + (fim - limite) / 2;
+		if (strncmp(indice->nomes[meio], prefixo, tamanho) == 0)
+		{
+			limite = meio + 1;
+		}
+		else
+		{
+			fim = meio;
+		}
+	}
+
+	*primeiro = inicio;
+	int32_t total = limite - inicio;
+	if (comum != NULL && capacidade > 0)
+	{
+		// Em ordem alfabética, o prefixo comum a todos os nomes é o do primeiro com o último,
+		// recuado até o início de um caractere UTF-8.
+		size_t comprimento = 0;
+		if (total > 0)
+		{
+			const char* a = indice->nomes[inicio];
+			const char* b = indice->nomes[limite - 1];
+			while (a[comprimento] != '\0' && a[comprimento] == b[comprimento] && comprimento + 1 < capacidade)
+			{
+				comprimento++;
+			}
+			while (comprimento > 0 && ((unsigned char)a[comprimento] & 0xC0) == 0x80)
+			{
+				comprimento--;
+			}
+			memcpy(comum, a, comprimento);
+		}
+		comum[comprimento] = '\0';
+	}
+
+	return total;
+}
+
+size_t memoriaIndiceSalas(const IndiceSalas* indice)
+{
+	size_t capacidade = (size_t)indice->mascara + 1;
+	return sizeof(IndiceSalas) + capacidade * sizeof(int32_t) + capacidade / 2 * (sizeof(const char*) + sizeof(uint32_t)) +
+		((size_t)indice->totalNomes + 1) * sizeof(int32_t) + (size_t)indice->totalSalas * sizeof(int32_t);
+}
+
+void liberarIndiceSalas(IndiceSalas* indice)
+{
+	if (indice == NULL)
+		return;
+
+	free((void*)indice->nomes);
+	free(indice->marcas);
+	free(indice->inicioSalas);
+	free(indice->salas);
+	free(indice->tabela);
+	free(indice);
+}
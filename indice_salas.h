@@ -0,0 +1,60 @@
+#ifndef INDICE_SALAS_H
+#define INDICE_SALAS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Desafio Detective Quest
+// Índice das salas por nome: a ida direta a uma sala pelo nome digitado e a complementação de prefixos
+// (Tab), sem varrer as salas da mansão.
+
+// **** Definições de estruturas. ****
+
+/// @brief Define o índice das salas por nome, montado na carga da mansão. Uma tabela hash(endereçamento
+/// aberto) leva cada nome distinto à sua posição em nomes, que estão em ordem alfabética(strcmp) para a
+/// complementação por prefixo; as salas de um mesmo nome ficam contíguas, em ordem de índice.
+typedef struct
+{
+	const char** nomes; // Nomes distintos, em ordem alfabética. Apontam para os textos da mansão, sem cópia.
+	uint32_t* marcas; // 32 bits altos do hash de cada nome, conferidos antes da comparação dos textos.
+	int32_t* inicioSalas; // totalNomes + 1 posições: as salas do nome i ocupam salas[inicioSalas[i] .. inicioSalas[i + 1]).
+	int32_t* salas;
+	int32_t* tabela; // Posição do nome em nomes, ou SEM_INDICE_COLUNAR nas posições livres.
+	uint32_t mascara; // Capacidade da tabela menos 1(potência de 2, ocupação de no máximo 50%).
+	int32_t totalNomes;
+	int32_t totalSalas;
+} IndiceSalas;
+
+// **** Funções do Índice de Salas por Nome ****
+
+/// @brief Cria o índice das salas por nome. Os nomes não são copiados: os textos devem viver tanto quanto o índice.
+/// @param Vetor. Ponteiro para os textos dos nomes.
+/// @param Inteiro. Quantidade de textos.
+/// @param Vetor. Índice do nome de cada sala em textos(como MansaoColunar.nome), ou NULL quando há um texto por sala.
+/// @param Inteiro. Quantidade de salas.
+/// @returns IndiceSalas. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+IndiceSalas* criarIndiceSalas(const char* const* textos, int32_t totalTextos, const int32_t* nomes, int32_t totalSalas);
+/// @brief Busca as salas de um nome, em tempo constante: um hash e, em geral, uma comparação.
+/// @param IndiceSalas. Ponteiro usado na busca. Somente leitura.
+/// @param Texto. Nome da sala.
+/// @param Vetor. Ponteiro via referência, para as salas do nome, em ordem de índice. Pode ser NULL.
+/// @returns Inteiro. Quantidade de salas com o nome, ou zero se nenhuma.
+int32_t buscarSalasPorNome(const IndiceSalas* indice, const char* nome, const int32_t** salas);
+/// @brief Complementa um prefixo de nome(Tab): busca binária sobre os nomes em ordem alfabética.
+/// @param IndiceSalas. Ponteiro usado na busca. Somente leitura.
+/// @param Texto. Prefixo digitado.
+/// @param Inteiro. Ponteiro via referência, para a posição em nomes do primeiro nome com o prefixo.
+/// @param Texto. Buffer para o maior prefixo comum aos nomes encontrados. Pode ser NULL.
+/// @param Inteiro. Capacidade do buffer, incluindo o terminador.
+/// @returns Inteiro. Quantidade de nomes com o prefixo, contíguos a partir da primeira posição.
+int32_t completarNomeSala(const IndiceSalas* indice, const char* prefixo, int32_t* primeiro, char* comum, size_t capacidade);
+/// @brief Recupera a memória ocupada pelo índice.
+/// @param IndiceSalas. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Quantidade de bytes.
+size_t memoriaIndiceSalas(const IndiceSalas* indice);
+/// @brief Libera a memória alocada para o índice. Os textos dos nomes não são liberados.
+/// @param IndiceSalas. Ponteiro via referência, usado na operação de liberação.
+void liberarIndiceSalas(IndiceSalas* indice);
+
+#endif
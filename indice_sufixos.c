@@ -0,0 +1,477 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "indice_sufixos.h"
+
+// Desafio Detective Quest
+// Implementação do índice de sufixos.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem cria o índice informa as falhas.
+
+// **** Funções do Índice de Sufixos ****
+
+/// @brief Verifica se a posição é o início de um sufixo LMS(tipo S precedido por tipo L).
+#define EH_LMS(tipoS, i) ((i) > 0 && (tipoS)[i] && !(tipoS)[(i) - 1])
+
+/// @brief Calcula o início(ou o fim) de cada balde de símbolos, usado pelo SA-IS.
+static void obterBaldes(const int32_t* s, int32_t n, int32_t k, int32_t* baldes, bool fim)
+{
+	memset(baldes, 0, sizeof(int32_t) * (size_t)k);
+	for (int32_t i = 0; i < n; i++)
+	{
+		baldes[s[i]]++;
+	}
+
+	int32_t soma = 0;
+	for (int32_t c = 0; c < k; c++)
+	{
+		int32_t quantidade = baldes[c];
+		baldes[c] = fim ? soma + quantidade : soma;
+		soma += quantidade;
+	}
+}
+
+/// @brief Induz a ordem dos sufixos do tipo L, varrendo o vetor da esquerda para a direita.
+static void induzirTipoL(const int32_t* s, int32_t* sa, int32_t n, int32_t k, const unsigned char* tipoS, int32_t* baldes)
+{
+	obterBaldes(s, n, k, baldes, false);
+	for (int32_t i = 0; i < n; i++)
+	{
+		int32_t j = sa[i] - 1;
+		if (sa[i] > 0 && !tipoS[j])
+		{
+			sa[baldes[s[j]]++] = j;
+		}
+	}
+}
+
+/// @brief Induz a ordem dos sufixos do tipo S, varrendo o vetor da direita para a esquerda.
+static void induzirTipoS(const int32_t* s, int32_t* sa, int32_t n, int32_t k, const unsigned char* tipoS, int32_t* baldes)
+{
+	obterBaldes(s, n, k, baldes, true);
+	for (int32_t i = n - 1; i >= 0; i--)
+	{
+		int32_t j = sa[i] - 1;
+		if (sa[i] > 0 && tipoS[j])
+		{
+			sa[--baldes[s[j]]] = j;
+		}
+	}
+}
+
+/// @brief Constrói o vetor de sufixos com SA-IS. O último símbolo de s deve ser 0 e único.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+static bool construirSufixosSAIS(const int32_t* s, int32_t* sa, int32_t n, int32_t k)
+{
+	if (n == 1)
+	{
+		sa[0] = 0;
+		return true;
+	}
+
+	unsigned char* tipoS = (unsigned char*)malloc((size_t)n);
+	int32_t* baldes = (int32_t*)malloc(sizeof(int32_t) * (size_t)k);
+	if (tipoS == NULL || baldes == NULL)
+	{
+		free(tipoS);
+		free(baldes);
+		return false;
+	}
+
+	// Classificação dos sufixos: S se menor que o seguinte, L caso contrário.
+	tipoS[n - 1] = 1;
+	tipoS[n - 2] = 0;
+	for (int32_t i = n - 3; i >= 0; i--)
+	{
+		tipoS[i] = s[i] < s[i + 1] || (s[i] == s[i + 1] && tipoS[i + 1]);
+	}
+
+	// Etapa 1: ordena as substrings LMS por indução.
+	obterBaldes(s, n, k, baldes, true);
+	for (int32_t i = 0; i < n; i++)
+	{
+		sa[i] = -1;
+	}
+	for (int32_t i = 1; i < n; i++)
+	{
+		if (EH_LMS(tipoS, i))
+		{
+			sa[--baldes[s[i]]] = i;
+		}
+	}
+	induzirTipoL(s, sa, n, k, tipoS, baldes);
+	induzirTipoS(s, sa, n, k, tipoS, baldes);
+
+	// Compacta as substrings LMS ordenadas no início do vetor.
+	int32_t n1 = 0;
+	for (int32_t i = 0; i < n; i++)
+	{
+		if (EH_LMS(tipoS, sa[i]))
+		{
+			sa[n1++] = sa[i];
+		}
+	}
+
+	// Etapa 2: atribui nomes às substrings LMS; iguais recebem o mesmo nome.
+	for (int32_t i = n1; i < n; i++)
+	{
+		sa[i] = -1;
+	}
+	int32_t nomes = 0, anterior = -1;
+	for (int32_t i = 0; i < n1; i++)
+	{
+		int32_t posicao = sa[i];
+		bool diferente = false;
+		for (int32_t d = 0; d < n; d++)
+		{
+			if (anterior == -1 || s[posicao + d] != s[anterior + d] || tipoS[posicao + d] != tipoS[anterior + d])
+			{
+				diferente = true;
+				break;
+			}
+			else if (d > 0 && (EH_LMS(tipoS, posicao + d) || EH_LMS(tipoS, anterior + d)))
+			{
+				break;
+			}
+		}
+
+		if (diferente)
+		{
+			nomes++;
+			anterior = posicao;
+		}
+		sa[n1 + posicao / 2] = nomes - 1;
+	}
+	for (int32_t i = n - 1, j = n - 1; i >= n1; i--)
+	{
+		if (sa[i] >= 0)
+		{
+			sa[j--] = sa[i];
+		}
+	}
+
+	// Etapa 3: ordena a string reduzida, recursivamente se houver nomes repetidos.
+	int32_t* s1 = sa + n - n1;
+	int32_t* sa1 = sa;
+	bool sucesso = true;
+	if (nomes < n1)
+	{
+		sucesso = construirSufixosSAIS(s1, sa1, n1, nomes);
+	}
+	else
+	{
+		for (int32_t i = 0; i < n1; i++)
+		{
+			sa1[s1[i]] = i;
+		}
+	}
+
+	if (sucesso)
+	{
+		// Etapa 4: posiciona os sufixos LMS já ordenados e induz os demais.
+		obterBaldes(s, n, k, baldes, true);
+		for (int32_t i = 1, j = 0; i < n; i++)
+		{
+			if (EH_LMS(tipoS, i))
+			{
+				s1[j++] = i;
+			}
+		}
+		for (int32_t i = 0; i < n1; i++)
+		{
+			sa1[i] = s1[sa1[i]];
+		}
+		for (int32_t i = n1; i < n; i++)
+		{
+			sa[i] = -1;
+		}
+		for (int32_t i = n1 - 1; i >= 0; i--)
+		{
+			int32_t j = sa[i];
+			sa[i] = -1;
+			sa[--baldes[s[j]]] = j;
+		}
+		induzirTipoL(s, sa, n, k, tipoS, baldes);
+		induzirTipoS(s, sa, n, k, tipoS, baldes);
+	}
+
+	free(tipoS);
+	free(baldes);
+	return sucesso;
+}
+
+IndiceSufixos* criarIndiceSufixos(const char** pistas, int totalPistas)
+{
+	IndiceSufixos* indice = (IndiceSufixos*)calloc(1, sizeof(IndiceSufixos));
+	if (indice == NULL)
+	{
+		return NULL;
+	}
+
+	size_t tamanho = 1; // Terminador.
+	for (int i = 0; i < totalPistas; i++)
+	{
+		tamanho += 1 + strlen(pistas[i]);
+	}
+	if (tamanho > INT32_MAX)
+	{
+		free(indice);
+		return NULL;
+	}
+
+	indice->tamanho = (int32_t)tamanho;
+	indice->totalPistas = totalPistas;
+	indice->texto = (unsigned char*)malloc(tamanho);
+	indice->sufixos = (int32_t*)malloc(sizeof(int32_t) * tamanho);
+	indice->documentos = (int32_t*)malloc(sizeof(int32_t) * tamanho);
+	indice->pistas = (char**)calloc((size_t)(totalPistas > 0 ? totalPistas : 1), sizeof(char*));
+	indice->marcas = (unsigned*)calloc((size_t)(totalPistas > 0 ? totalPistas : 1), sizeof(unsigned));
+	int32_t* simbolos = (int32_t*)malloc(sizeof(int32_t) * tamanho);
+
+	if (indice->texto == NULL || indice->sufixos == NULL || indice->documentos == NULL ||
+		indice->pistas == NULL || indice->marcas == NULL || simbolos == NULL)
+	{
+		free(simbolos);
+		liberarIndiceSufixos(indice);
+		return NULL;
+	}
+
+	size_t posicao = 0;
+	for (int i = 0; i < totalPistas; i++)
+	{
+		size_t comprimento = strlen(pistas[i]);
+		indice->pistas[i] = (char*)malloc(comprimento + 1);
+		if (indice->pistas[i] == NULL)
+		{
+			free(simbolos);
+			liberarIndiceSufixos(indice);
+			return NULL;
+		}
+		memcpy(indice->pistas[i], pistas[i], comprimento + 1);
+
+		indice->documentos[posicao] = i;
+		indice->texto[posicao++] = SEPARADOR_INDICE_SUFIXOS;
+		for (size_t j = 0; j < comprimento; j++)
+		{
+			indice->documentos[posicao] = i;
+			indice->texto[posicao++] = (unsigned char)pistas[i][j];
+		}
+	}
+	indice->documentos[posicao] = -1;
+	indice->texto[posicao] = '\0';
+
+	for (size_t i = 0; i < tamanho; i++)
+	{
+		simbolos[i] = indice->texto[i];
+	}
+
+	bool sucesso = construirSufixosSAIS(simbolos, indice->sufixos, indice->tamanho, 256);
+	free(simbolos);
+
+	if (!sucesso)
+	{
+		liberarIndiceSufixos(indice);
+		return NULL;
+	}
+
+	return indice;
+}
+
+IndiceSufixos* criarIndiceSufixosCatalogo(const TabelaHash* tabela)
+{
+	int total = 0;
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		for (const NoHash* atual = tabela->dados[i]; atual != NULL; atual = atual->proximo)
+		{
+			total++;
+		}
+	}
+
+	const char** pistas = (const char**)malloc(sizeof(const char*) * (size_t)(total > 0 ? total : 1));
+	if (pistas == NULL)
+	{
+		return NULL;
+	}
+
+	int posicao = 0;
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		for (const NoHash* atual = tabela->dados[i]; atual != NULL; atual = atual->proximo)
+		{
+			pistas[posicao++] = lerTextoCompacto(&atual->pista);
+		}
+	}
+
+	IndiceSufixos* indice = criarIndiceSufixos(pistas, total);
+	free(pistas);
+	return indice;
+}
+
+/// @brief Conta os nós de uma árvore de pistas.
+static int contarPistas(const Pista* raiz)
+{
+	return raiz == NULL ? 0 : 1 + contarPistas(raiz->esquerda) + contarPistas(raiz->direita);
+}
+
+/// @brief Coleta as pistas de uma árvore, em ordem, em um vetor.
+static void coletarPistasEmOrdem(const Pista* raiz, const char** destino, int* posicao)
+{
+	if (raiz == NULL)
+	{
+		return;
+	}
+	coletarPistasEmOrdem(raiz->esquerda, destino, posicao);
+	destino[(*posicao)++] = raiz->pista;
+	coletarPistasEmOrdem(raiz->direita, destino, posicao);
+}
+
+IndiceSufixos* criarIndiceSufixosPistas(const Pista* raiz)
+{
+	int total = contarPistas(raiz);
+	const char** pistas = (const char**)malloc(sizeof(const char*) * (size_t)(total > 0 ? total : 1));
+	if (pistas == NULL)
+	{
+		return NULL;
+	}
+
+	int posicao = 0;
+	coletarPistasEmOrdem(raiz, pistas, &posicao);
+
+	IndiceSufixos* indice = criarIndiceSufixos(pistas, total);
+	free(pistas);
+	return indice;
+}
+
+/// @brief Compara os primeiros bytes de um sufixo com o padrão, a partir de um prefixo já conhecido em comum.
+/// @returns Inteiro. Negativo, zero ou positivo, se o sufixo for menor, começar pelo padrão ou for maior.
+static int compararSufixoPadrao(const IndiceSufixos* indice, int32_t posicao,
+	const unsigned char* padrao, size_t tamanhoPadrao, size_t* comum)
+{
+	const unsigned char* texto = indice->texto + posicao;
+	size_t restante = (size_t)(indice->tamanho - posicao);
+	size_t k = *comum;
+
+	while (k < tamanhoPadrao && k < restante && texto[k] == padrao[k])
+	{
+		k++;
+	}
+	*comum = k;
+
+	if (k == tamanhoPadrao)
+	{
+		return 0;
+	}
+	if (k == restante)
+	{
+		return -1;
+	}
+	return texto[k] < padrao[k] ? -1 : 1;
+}
+
+/// @brief Busca binária do primeiro sufixo que não é menor(ou, no limite superior, que é maior) que o padrão.
+/// Reaproveita o prefixo comum com os limites da busca para não reler bytes do padrão.
+static int32_t limiteSufixos(const IndiceSufixos* indice, const unsigned char* padrao, size_t tamanhoPadrao, bool superior)
+{
+	int32_t inicio = 0, fim = indice->tamanho;
+	size_t comumInicio = 0, comumFim = 0;
+
+	while (inicio < fim)
+	{
+		int32_t meio = inicio + (fim - inicio) / 2;
+		size_t comum = comumInicio < comumFim ? comumInicio : comumFim;
+		int comparacao = compararSufixoPadrao(indice, indice->sufixos[meio], padrao, tamanhoPadrao, &comum);
+
+		if (superior ? comparacao <= 0 : comparacao < 0)
+		{
+			inicio = meio + 1;
+			comumInicio = comum;
+		}
+		else
+		{
+			fim = meio;
+			comumFim = comum;
+		}
+	}
+
+	return inicio;
+}
+
+int buscarTrechoIndice(IndiceSufixos* indice, const char* trecho, bool apenasPrefixo, int* resultados, int maximo)
+{
+	if (indice == NULL || trecho == NULL || trecho[0] == '\0')
+	{
+		return 0;
+	}
+
+	// A busca por prefixo procura o separador seguido do trecho.
+	size_t tamanhoTrecho = strlen(trecho);
+	size_t tamanhoPadrao = tamanhoTrecho + (apenasPrefixo ? 1 : 0);
+	unsigned char* padrao = (unsigned char*)malloc(tamanhoPadrao);
+	if (padrao == NULL)
+	{
+		return 0;
+	}
+	if (apenasPrefixo)
+	{
+		padrao[0] = SEPARADOR_INDICE_SUFIXOS;
+	}
+	memcpy(padrao + (apenasPrefixo ? 1 : 0), trecho, tamanhoTrecho);
+
+	int32_t inicio = limiteSufixos(indice, padrao, tamanhoPadrao, false);
+	int32_t fim = limiteSufixos(indice, padrao, tamanhoPadrao, true);
+	free(padrao);
+
+	// Uma nova geração dispensa limpar as marcas de pistas já retornadas.
+	if (++indice->geracao == 0)
+	{
+		memset(indice->marcas, 0, sizeof(unsigned) * (size_t)indice->totalPistas);
+		indice->geracao = 1;
+	}
+
+	int encontradas = 0;
+	for (int32_t i = inicio; i < fim; i++)
+	{
+		int32_t pista = indice->documentos[indice->sufixos[i]];
+		if (pista >= 0 && indice->marcas[pista] != indice->geracao)
+		{
+			indice->marcas[pista] = indice->geracao;
+			if (encontradas < maximo)
+			{
+				resultados[encontradas] = pista;
+			}
+			encontradas++;
+		}
+	}
+
+	return encontradas;
+}
+
+const char* textoPistaIndice(const IndiceSufixos* indice, int pista)
+{
+	if (indice == NULL || pista < 0 || pista >= indice->totalPistas)
+	{
+		return NULL;
+	}
+	return indice->pistas[pista];
+}
+
+void liberarIndiceSufixos(IndiceSufixos* indice)
+{
+	if (indice == NULL)
+		return;
+
+	if (indice->pistas != NULL)
+	{
+		for (int i = 0; i < indice->totalPistas; i++)
+		{
+			free(indice->pistas[i]);
+		}
+	}
+
+	free(indice->pistas);
+	free(indice->marcas);
+	free(indice->texto);
+	free(indice->sufixos);
+	free(indice->documentos);
+	free(indice);
+}
@@ -0,0 +1,69 @@
+#ifndef INDICE_SUFIXOS_H
+#define INDICE_SUFIXOS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "arvore_pistas.h"
+#include "catalogo_pistas.h"
+
+// Desafio Detective Quest
+// Índice de sufixos sobre as pistas, para buscas por trecho e por prefixo: o vetor de sufixos é construído
+// com SA-IS(ordenação por indução), em tempo linear, e cada busca é uma busca binária sobre ele.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o byte separador entre as pistas no texto do índice de sufixos.
+/// É menor que qualquer byte de texto UTF-8 e maior que o terminador.
+#define SEPARADOR_INDICE_SUFIXOS '\x01'
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um índice de sufixos sobre um conjunto de pistas, para buscas por trecho e por prefixo.
+/// O texto concatena as pistas como "\x01pista\x01pista...\0", em bytes UTF-8.
+typedef struct
+{
+	unsigned char* texto;
+	int32_t tamanho; // Inclui o terminador.
+	int32_t* sufixos; // Posições iniciais dos sufixos, em ordem lexicográfica.
+	int32_t* documentos; // Para cada posição do texto, o índice da pista correspondente.
+	char** pistas; // Cópias das pistas indexadas.
+	int totalPistas;
+	unsigned* marcas; // Geração da última busca que retornou cada pista(remove repetidas).
+	unsigned geracao;
+} IndiceSufixos;
+
+// **** Funções do Índice de Sufixos ****
+
+/// @brief Efetua a criação de um índice de sufixos sobre uma lista de pistas.
+/// A construção usa SA-IS(ordenação por indução), em tempo linear no tamanho do texto.
+/// @param Vetor. Ponteiro para os valores de texto das pistas. Somente leitura.
+/// @param Inteiro. Quantidade de pistas.
+/// @returns IndiceSufixos. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+IndiceSufixos* criarIndiceSufixos(const char** pistas, int totalPistas);
+/// @brief Efetua a criação de um índice de sufixos sobre todas as pistas do catálogo.
+/// @param TabelaHash. Ponteiro usado para recuperar as pistas. Somente leitura.
+/// @returns IndiceSufixos. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+IndiceSufixos* criarIndiceSufixosCatalogo(const TabelaHash* tabela);
+/// @brief Efetua a criação de um índice de sufixos sobre as pistas coletadas.
+/// @param Pista. Ponteiro raiz da árvore de pistas. Somente leitura.
+/// @returns IndiceSufixos. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+IndiceSufixos* criarIndiceSufixosPistas(const Pista* raiz);
+/// @brief Efetua a busca das pistas que contêm um trecho, ou que começam por ele.
+/// @param IndiceSufixos. Ponteiro via referência, usado na busca.
+/// @param Texto. Ponteiro para o trecho procurado, em UTF-8.
+/// @param Bool. Verdadeiro(true) para buscar apenas prefixos. Caso contrário, falso(false).
+/// @param Vetor. Ponteiro para receber os índices das pistas encontradas, sem repetições.
+/// @param Inteiro. Capacidade do vetor de resultados.
+/// @returns Inteiro. Quantidade de pistas encontradas(pode exceder a capacidade).
+int buscarTrechoIndice(IndiceSufixos* indice, const char* trecho, bool apenasPrefixo, int* resultados, int maximo);
+/// @brief Recupera o texto de uma pista do índice.
+/// @param IndiceSufixos. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice da pista.
+/// @returns Texto. Ponteiro para o texto da pista, ou NULL se o índice for inválido.
+const char* textoPistaIndice(const IndiceSufixos* indice, int pista);
+/// @brief Libera a memória alocada para o índice de sufixos.
+/// @param IndiceSufixos. Ponteiro via referência, usado na operação de liberação.
+void liberarIndiceSufixos(IndiceSufixos* indice);
+
+#endif
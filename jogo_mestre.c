@@ -0,0 +1,1431 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+
+#include "indice_sufixos.h"
+#include "jogo_mestre.h"
+
+// Desafio Detective Quest
+// Implementação do jogo do nível Mestre.
+
+// **** Tabelas estáticas do caso(geradas na compilação a partir de casos/mansao.caso). ****
+
+/// @brief Grafo da mansão do caso, sobre as tabelas estáticas geradas: as salas são as de SALAS_CASO,
+/// e as saídas de cada sala são a esquerda, a direita e as portas do arquivo de caso, nesta ordem.
+static const MansaoGrafo GRAFO_CASO = { INICIO_SAIDAS_CASO, DESTINOS_SAIDAS_CASO, TOTAL_SALAS_CASO, TOTAL_SAIDAS_CASO };
+
+// **** Funções de Interface de Usuário ****
+
+void exibirMenuPrincipal(EntradaComandos* entrada, int* opcao)
+{
+	if (*opcao == 3 || *opcao == 0)
+	{
+		return; //Optando por jogar novamente, ou saindo.
+	}
+
+	// No meio de um lote de comandos, o menu não é exibido: ele volta ao fim do lote.
+	if (!haComandosPendentes(entrada))
+	{
+		printf("\nE(ou e) - Ir para a Esquerda ↩️ \n");
+		printf("D(ou d) - Ir para a Direita ↪️ \n");
+		printf("P(ou p) - Seguir por uma saída, pelo número 🚪\n");
+		printf("I(ou i) - Ir direto a uma sala, pelo nome(o início com '?' lista os nomes) 🧭\n");
+		printf("U(ou u) - Desfazer o último movimento ⏪\n");
+		printf("B(ou b) - Buscar pistas coletadas por trecho 🔎\n");
+		printf("L(ou l) - Listar pistas coletadas por página 📄\n");
+		printf("R(ou r) - Classificar os suspeitos mais prováveis 📊\n");
+		printf("S(ou s) - Sair.\n");
+		printf("Vários comandos podem ser digitados de uma vez(ex: eedde).\n");
+	}
+
+	bool invalido;
+
+	int escolhido;
+
+	do
+	{
+		if (!haComandosPendentes(entrada))
+		{
+			printf("Escolha uma opção: ");
+		}
+		escolhido = proximoComando(entrada);
+		if (escolhido == EOF)
+		{
+			*opcao = 0; // Fim da entrada: encerra como se o jogador saísse.
+			return;
+		}
+		invalido = escolhido != 'e' && escolhido != 'E' &&
+			escolhido != 'd' && escolhido != 'D' &&
+			escolhido != 'p' && escolhido != 'P' &&
+			escolhido != 'i' && escolhido != 'I' &&
+			escolhido != 'u' && escolhido != 'U' &&
+			escolhido != 'b' && escolhido != 'B' &&
+			escolhido != 'l' && escolhido != 'L' &&
+			escolhido != 'r' && escolhido != 'R' &&
+			escolhido != 's' && escolhido != 'S';
+
+		if (invalido)
+		{
+			printf("\n==== ⚠️  Entrada inválida('%c'). Esperado: E(ou e), D(ou d), P(ou p), I(ou i), U(ou u), B(ou b), L(ou l), R(ou r) ou S(ou s). ====\n", escolhido);
+		}
+	} while (invalido);
+
+
+	switch (escolhido)
+	{
+	case 'e':
+	case 'E':
+		*opcao = 1;
+		break;
+	case 'd':
+	case 'D':
+		*opcao = 2;
+		break;
+	case 'b':
+	case 'B':
+		*opcao = 4;
+		break;
+	case 'l':
+	case 'L':
+		*opcao = 5;
+		break;
+	case 'r':
+	case 'R':
+		*opcao = 6;
+		break;
+	case 'p':
+	case 'P':
+		*opcao = 7;
+		break;
+	case 'i':
+	case 'I':
+		*opcao = 8;
+		break;
+	case 'u':
+	case 'U':
+		*opcao = 9;
+		break;
+	case 's':
+	case 'S':
+		*opcao = 0;
+		break;
+	default:
+		*opcao = -1;
+		break;
+	}
+}
+
+void exibirEstadoInvestigacao(JogoMestre* jogo, const Sala* noLocal, int* opcao)
+{
+	if (noLocal == NULL)
+	{
+		printf("\n ====  🚫  Nada existe além do local atual.  🚩 ==== \n");
+		printf("\n  ℹ️  Vamos voltar ao ponto de partida.\n");
+		return;
+	}
+
+	const char* pista = lerTextoCompacto(&noLocal->pista);
+
+	if (pista[0] != '\0')
+	{
+		printf("\n ====  ℹ️  Foi encontrada uma pista nesse local: %s ❕ ==== \n", pista);
+
+		encontrarSuspeito(jogo, pista, opcao);
+	}
+
+	// As salas intermediárias de um lote de comandos não são exibidas, apenas a sala final.
+	if (!haComandosPendentes(&jogo->entrada))
+	{
+		printf("\n ====  ℹ️  No momento, você se encontra neste local: %s  🚩 ==== \n", lerTextoCompacto(&noLocal->nome));
+		exibirSaidasGrafo(&GRAFO_CASO, noLocal);
+	}
+}
+
+// **** Funções de Lógica Principal e Gerenciamento de Memória ****
+
+JogoMestre* criarJogoMestre()
+{
+	// O diário e os histogramas somam centenas de KB: o contexto fica no heap, zerado.
+	return (JogoMestre*)calloc(1, sizeof(JogoMestre));
+}
+
+void liberarJogoMestre(JogoMestre* jogo)
+{
+	free(jogo);
+}
+
+int executarJogo(JogoMestre* jogo, const char* caminhoDiario, int registrosPorSincronizacao)
+{
+	// A partida(sala atual, árvore de pistas, catálogo, culpado, acusação e desfazer) fica no motor do jogo;
+	// a interface guarda apenas o que exibe: a pontuação dos suspeitos.
+	DescricaoCasoMotor caso;
+	descreverCasoMotor(jogo->salasMotor, jogo->gruposMotor, &caso);
+	StatusMotor status = criarMotorJogo(&caso, 0, &jogo->motor); // A partida é sorteada em iniciarNovoJogo.
+	if (status != StatusMotor_OK)
+	{
+		printf("\n  ❌  Erro ao tentar criar o motor do jogo: %s\n", descreverStatusMotor(status));
+		return EXIT_FAILURE;
+	}
+
+	bool diarioAtivo = abrirDiario(&jogo->diario, caminhoDiario, registrosPorSincronizacao);
+	if (!diarioAtivo)
+	{
+		printf("\n  ⚠️  Não foi possível abrir o diário '%s'. A partida não será registrada.\n", caminhoDiario);
+	}
+	diarioAtivo = diarioAtivo && caminhoDiario != NULL;
+
+	printf("======================================================\n");
+	printf("====== 🔎  DETECTIVE QUEST - Nível Mestre  🔍 =======\n");
+	printf("======================================================\n");
+
+	int opcao = -1;
+
+	const Sala* arvoreMansao, * atual; // Definindo o valor padrão inicial para a navegação.
+
+	// As salas do caso são fixas: o índice por nome é montado uma única vez, na carga da mansão.
+	const char* nomesSalas[TOTAL_SALAS_CASO];
+	for (int32_t i = 0; i < TOTAL_SALAS_CASO; i++)
+	{
+		nomesSalas[i] = lerTextoCompacto(&SALAS_CASO[i].nome);
+	}
+	jogo->indiceSalas = criarIndiceSalas(nomesSalas, TOTAL_SALAS_CASO, NULL, TOTAL_SALAS_CASO);
+
+	instalarSinalLatencias();
+
+	iniciarNovoJogo(jogo, &arvoreMansao, &atual);
+
+	do
+	{
+		verificarSinalLatencias(jogo);
+
+		exibirEstadoInvestigacao(jogo, atual, &opcao);
+
+		exibirMenuPrincipal(&jogo->entrada, &opcao);
+
+		// A latência de cada comando vai do fim da leitura do menu ao fim do seu tratamento. A sala de destino
+		// de um movimento é exibida(e a sua pista coletada) na próxima volta do laço, medida em separado.
+		uint64_t inicioComando = instanteLatencia();
+
+		switch (opcao)
+		{
+		case 1:
+			// Ir para a esquerda.
+			atual = explorarSalasComPistas(jogo, SeguirNaDirecao_ESQUERDA, &opcao);
+			registrarEventoDiario(&jogo->diario, EventoDiario_MOVIMENTO, (int32_t)(atual - SALAS_CASO),
+				SeguirNaDirecao_ESQUERDA, -1, -1, atual == arvoreMansao);
+			registrarLatenciaComando(jogo, ComandoLatencia_MOVIMENTO, inicioComando);
+			break;
+		case 2:
+			// Ir para a direita.
+			atual = explorarSalasComPistas(jogo, SeguirNaDirecao_DIREITA, &opcao);
+			registrarEventoDiario(&jogo->diario, EventoDiario_MOVIMENTO, (int32_t)(atual - SALAS_CASO),
+				SeguirNaDirecao_DIREITA, -1, -1, atual == arvoreMansao);
+			registrarLatenciaComando(jogo, ComandoLatencia_MOVIMENTO, inicioComando);
+			break;
+		case 3:
+			registrarEventoDiario(&jogo->diario, EventoDiario_FIM, -1, SeguirNaDirecao_NENHUM, -1, -1, DesfechoSessao_JOGAR_NOVAMENTE);
+			sincronizarDiario(&jogo->diario); // A partida encerrada fica no disco antes da próxima.
+			exibirHash(catalogoMotorJogo(jogo->motor)); // Reiniciando a partida e exibindo resumo das pistas da partida anterior.
+			inicioComando = instanteLatencia(); // Apenas o reinício: o resumo e a gravação do diário ficam de fora.
+			reiniciarJogo(jogo, &arvoreMansao, &atual);
+			registrarLatenciaComando(jogo, ComandoLatencia_REINICIO, inicioComando);
+			opcao = -1; // Vamos continuar o jogo.
+			break;
+		case 4:
+			exibirBuscaPistas(&jogo->entrada, pistasMotorJogo(jogo->motor));
+			registrarLatenciaComando(jogo, ComandoLatencia_BUSCA, inicioComando);
+			opcao = -1; // Vamos continuar o jogo.
+			break;
+		case 5:
+			exibirPaginaPistas(&jogo->entrada, pistasMotorJogo(jogo->motor));
+			registrarLatenciaComando(jogo, ComandoLatencia_LISTAGEM, inicioComando);
+			opcao = -1; // Vamos continuar o jogo.
+			break;
+		case 6:
+			exibirClassificacaoSuspeitos(&jogo->pontuacao, SUSPEITOS_CASO, TOTAL_SUSPEITOS_CASO);
+			exibirSuspeitosAcusaveis(jogo->motor);
+			exibirPistaMaisProxima(atual, jogo->motor);
+			registrarLatenciaComando(jogo, ComandoLatencia_CLASSIFICACAO, inicioComando);
+			opcao = -1; // Vamos continuar o jogo.
+			break;
+		case 7:
+			// Seguir por uma saída do grafo da mansão: esquerda, direita ou uma das portas.
+			{
+				const Sala* destino = explorarSaidaGrafo(&jogo->entrada, &GRAFO_CASO, atual);
+				if (destino != NULL)
+				{
+					irParaSalaMotorJogo(jogo->motor, (int32_t)(destino - SALAS_CASO));
+					atual = destino;
+					registrarEventoDiario(&jogo->diario, EventoDiario_MOVIMENTO, (int32_t)(atual - SALAS_CASO),
+						SeguirNaDirecao_SAIDA, -1, -1, 0);
+				}
+			}
+			registrarLatenciaComando(jogo, ComandoLatencia_SAIDA, inicioComando);
+			break;
+		case 8:
+			// Ir direto a uma sala pelo nome, sem percorrer o caminho desde a entrada.
+			{
+				const Sala* destino = irParaSalaPorNome(&jogo->entrada, jogo->indiceSalas);
+				if (destino != NULL)
+				{
+					irParaSalaMotorJogo(jogo->motor, (int32_t)(destino - SALAS_CASO));
+					atual = destino;
+					registrarEventoDiario(&jogo->diario, EventoDiario_MOVIMENTO, (int32_t)(atual - SALAS_CASO),
+						SeguirNaDirecao_NOME, -1, -1, 0);
+				}
+			}
+			registrarLatenciaComando(jogo, ComandoLatencia_IDA_POR_NOME, inicioComando);
+			break;
+		case 9:
+			// Desfazer o último movimento. O diário registra o desfazer, e não um movimento: a repetição
+			// restaura o mesmo estado, guardado antes do movimento.
+			if (desfazerMovimento(jogo, &atual))
+			{
+				registrarEventoDiario(&jogo->diario, EventoDiario_DESFAZER, (int32_t)(atual - SALAS_CASO),
+					SeguirNaDirecao_DESFAZER, -1, -1, 0);
+			}
+			else
+			{
+				printf("\n==== ⚠️  Não há movimento para desfazer. ====\n");
+			}
+			registrarLatenciaComando(jogo, ComandoLatencia_DESFAZER, inicioComando);
+			break;
+		case 0:
+			//  0  Sair.
+			registrarEventoDiario(&jogo->diario, EventoDiario_FIM, -1, SeguirNaDirecao_NENHUM, -1, -1, DesfechoSessao_SAIR);
+			exibirHash(catalogoMotorJogo(jogo->motor)); // Exibindo resumo das pistas.
+			if (jogo->diagnostico)
+			{
+				exibirEstatisticasBloom(stderr, "Pistas coletadas", filtroPistasMotorJogo(jogo->motor),
+					consultasPistasMotorJogo(jogo->motor));
+				exibirEstatisticasBloom(stderr, "Catálogo de pistas", catalogoMotorJogo(jogo->motor)->filtroChaves,
+					&jogo->consultasCatalogo);
+				exibirLatenciasComandos(jogo, stderr);
+			}
+			printf("\n==== Saindo do sistema... ====\n");
+			break;
+		default:
+			// Continua.
+			printf("\n==== ⚠️  Opção inválida. ====\n");
+			break;
+		}
+
+		// Uma falha de gravação desativa o diário: o jogador é avisado uma única vez.
+		if (diarioAtivo && jogo->diario.arquivo == NULL)
+		{
+			printf("\n  ⚠️  Falha ao gravar o diário. A partida deixará de ser registrada.\n");
+			diarioAtivo = false;
+		}
+
+	} while (opcao != 0);
+
+
+	liberarMemoria(jogo);
+	liberarIndiceSalas(jogo->indiceSalas);
+	jogo->indiceSalas = NULL;
+	liberarMotorJogo(jogo->motor);
+	jogo->motor = NULL;
+	if (!fecharDiario(&jogo->diario) && diarioAtivo)
+	{
+		printf("\n  ⚠️  Falha ao gravar o diário. A partida deixará de ser registrada.\n");
+	}
+
+	printf("\n==== Operação encerrada. ====\n");
+	fflush(stdout);
+
+	return EXIT_SUCCESS;
+}
+
+void iniciarNovoJogo(JogoMestre* jogo, const Sala** mansao, const Sala** atual)
+{
+	*mansao = criarMansao();
+
+	// O motor sorteia o culpado e os suspeitos das pistas, e monta o catálogo da partida. A semente vem
+	// de rand(): com srand fixo(ex: partidas simuladas), as partidas se repetem.
+	uint64_t semente = ((uint64_t)rand() << 32) ^ (uint64_t)rand();
+	reiniciarMotorJogo(jogo->motor, semente);
+
+	registrarEventoDiario(&jogo->diario, EventoDiario_INICIO, 0, SeguirNaDirecao_NENHUM, -1, culpadoMotorJogo(jogo->motor), 0);
+
+	*atual = *mansao; // Definindo o valor padrão inicial para a navegação.
+
+	// A pista da entrada já começa coletada.
+	const char* pistaInicial = lerTextoCompacto(&(*mansao)->pista);
+	coletarPistaMotorJogo(jogo->motor);
+	jogo->consultasCatalogo = (EstatisticasBloom){ 0 };
+
+	const NoHash* associacaoInicial = buscarNoHash(pistaInicial, catalogoMotorJogo(jogo->motor), &jogo->consultasCatalogo);
+	registrarPistaDiario(&jogo->diario, pistaInicial, associacaoInicial);
+
+	if (!iniciarPontuacaoSuspeitos(&jogo->pontuacao, TOTAL_SUSPEITOS_CASO))
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a pontuação dos suspeitos.\n");
+	}
+	pontuarPistaColetada(&jogo->pontuacao, pistaInicial, catalogoMotorJogo(jogo->motor));
+}
+
+void reiniciarJogo(JogoMestre* jogo, const Sala** mansao, const Sala** atual)
+{
+	liberarMemoria(jogo);
+	iniciarNovoJogo(jogo, mansao, atual);
+}
+
+const Sala* criarMansao()
+{
+	// As salas, suas saídas e pistas já estão ligadas nas tabelas geradas a partir do arquivo de caso.
+	return &SALAS_CASO[0];
+}
+
+TabelaHash* CriarTabelaHash(const char* const* listaSuspeitos)
+{
+	TabelaHash* table = alocarTabelaHash(TOTAL_CATALOGO_CASO);
+	if (table == NULL)
+	{
+		printf(" ❌  Erro ao alocar memória para a tabela hash.\n");
+		return NULL;
+	}
+
+	int indices[TOTAL_SUSPEITOS_CASO];
+	for (int i = 0; i < TOTAL_SUSPEITOS_CASO; i++)
+	{
+		indices[i] = i;
+	}
+	// Vamos usar um embaralhamento dos suspeitos em estilo de algoritmo (Fisher-Yates),
+	// apenas para deixar o jogo um pouquinho mais dinâmico.
+	for (int i = TOTAL_SUSPEITOS_CASO - 1; i > 0; i--)
+	{
+		int j = rand() % (i + 1);
+		int temp = indices[i];
+		indices[i] = indices[j];
+		indices[j] = temp;
+	}
+
+	// Cada pista do catálogo aponta para o suspeito sorteado para o seu grupo.
+	for (int i = 0; i < TOTAL_CATALOGO_CASO; i++)
+	{
+		if (!inserirNoHashIndices(PISTAS_CATALOGO_CASO[i], listaSuspeitos[indices[GRUPOS_CATALOGO_CASO[i]]], i,
+			indiceSuspeitoCaso(listaSuspeitos[indices[GRUPOS_CATALOGO_CASO[i]]]), table))
+		{
+			printf("\n  ❌  Erro ao tentar alocar a memória para o novo nó da tabela hash.\n");
+		}
+	}
+
+	// O catálogo fica fixo durante o jogo: as buscas passam para o índice perfeito.
+	indexarTabelaHashPerfeita(table);
+
+	return table;
+}
+
+const Sala* explorarSalasComPistas(JogoMestre* jogo, SeguirNaDirecao direcao, int* opcao)
+{
+	// Caso o ponto de navegação atual resulte em um nó folha, o motor volta
+	// automaticamente à referência mais alta. Neste nível de desafio, é indefinido
+	// em que momento a investigação deveria terminar, até o jogador decidir sair.
+	StatusMotor status = moverMotorJogo(jogo->motor, direcao == SeguirNaDirecao_ESQUERDA ? DirecaoMotor_ESQUERDA : DirecaoMotor_DIREITA);
+	if (status == StatusMotor_SEM_SAIDA)
+	{
+		exibirEstadoInvestigacao(jogo, NULL, opcao);
+	}
+
+	return &SALAS_CASO[salaAtualMotorJogo(jogo->motor)];
+}
+
+const Sala* explorarSaidaGrafo(EntradaComandos* entrada, const MansaoGrafo* grafo, const Sala* atual)
+{
+	int32_t sala = (int32_t)(atual - SALAS_CASO);
+	int32_t totalSaidas = totalSaidasGrafo(grafo, sala);
+	char numero[16];
+
+	if (totalSaidas == 0)
+	{
+		printf("\n==== 🚫  Não há saídas neste local. ====\n");
+		return NULL;
+	}
+
+	if (!haComandosPendentes(entrada))
+	{
+		printf("\nDigite o número da saída (1 a %d): ", totalSaidas);
+	}
+	if (!lerArgumentoComando(entrada, numero, sizeof(numero)))
+	{
+		return NULL;
+	}
+
+	int32_t destino = seguirSaidaGrafo(grafo, sala, atoi(numero) - 1);
+	if (destino == SEM_SALA_GRAFO)
+	{
+		printf("\n==== ⚠️  Saída inválida. ====\n");
+		return NULL;
+	}
+
+	return &SALAS_CASO[destino];
+}
+
+void exibirSaidasGrafo(const MansaoGrafo* grafo, const Sala* atual)
+{
+	int32_t sala = (int32_t)(atual - SALAS_CASO);
+	int32_t totalSaidas = totalSaidasGrafo(grafo, sala);
+
+	if (totalSaidas == 0)
+	{
+		return;
+	}
+
+	printf("  🚪  Saídas:");
+	for (int32_t i = 0; i < totalSaidas; i++)
+	{
+		printf(" %d) %s%s", i + 1, lerTextoCompacto(&SALAS_CASO[seguirSaidaGrafo(grafo, sala, i)].nome),
+			i + 1 < totalSaidas ? " |" : "\n");
+	}
+}
+
+void exibirPistaMaisProxima(const Sala* atual, MotorJogo* motor)
+{
+	int32_t distancias[TOTAL_SALAS_CASO];
+	if (calcularDistanciasGrafo(&GRAFO_CASO, NULL, (int32_t)(atual - SALAS_CASO), distancias, 1, NULL) < 0)
+	{
+		return;
+	}
+
+	// Uma única busca em largura dá a distância até todas as salas; basta escolher a menor entre as pendentes.
+	int32_t maisProxima = -1;
+	for (int32_t i = 0; i < TOTAL_SALAS_CASO; i++)
+	{
+		const char* pista = lerTextoCompacto(&SALAS_CASO[i].pista);
+		if (distancias[i] > 0 && pista[0] != '\0' && !pistaColetadaMotorJogo(motor, pista) &&
+			(maisProxima < 0 || distancias[i] < distancias[maisProxima]))
+		{
+			maisProxima = i;
+		}
+	}
+
+	if (maisProxima < 0)
+	{
+		printf("\n  🧭  Nenhuma pista pendente ao alcance das saídas deste local.\n");
+		return;
+	}
+
+	printf("\n  🧭  Pista pendente mais próxima: %s, a %d saída(s) daqui.\n",
+		lerTextoCompacto(&SALAS_CASO[maisProxima].nome), distancias[maisProxima]);
+}
+
+const Sala* irParaSalaPorNome(EntradaComandos* entrada, const IndiceSalas* indice)
+{
+	char nome[TAMANHO_MAX_NOME];
+
+	if (indice == NULL)
+	{
+		printf("\n==== ⚠️  O índice das salas não está disponível. ====\n");
+		return NULL;
+	}
+
+	if (!haComandosPendentes(entrada))
+	{
+		printf("\nDigite o nome da sala(ou o início, terminado em '?', para listar os nomes): ");
+	}
+	if (!lerArgumentoComando(entrada, nome, sizeof(nome)))
+	{
+		return NULL;
+	}
+
+	size_t tamanho = strlen(nome);
+	bool listar = tamanho > 0 && nome[tamanho - 1] == '?';
+	if (listar)
+	{
+		nome[tamanho - 1] = '\0';
+	}
+
+	const int32_t* salas;
+	if (!listar && buscarSalasPorNome(indice, nome, &salas) > 0)
+	{
+		return &SALAS_CASO[salas[0]];
+	}
+
+	// Complementação: um prefixo de um único nome leva à sala; os demais listam os nomes possíveis.
+	int32_t primeiro;
+	char comum[TAMANHO_MAX_NOME];
+	int32_t total = completarNomeSala(indice, nome, &primeiro, comum, sizeof(comum));
+	if (total == 0)
+	{
+		printf("\n==== ⚠️  Nenhuma sala tem o nome '%s'. ====\n", nome);
+		return NULL;
+	}
+	if (total == 1 && !listar)
+	{
+		return &SALAS_CASO[indice->salas[indice->inicioSalas[primeiro]]];
+	}
+
+	if (comum[0] != '\0')
+	{
+		printf("\n  🧭  Salas que começam com '%s':", comum);
+	}
+	else
+	{
+		printf("\n  🧭  Salas da mansão:");
+	}
+	for (int32_t i = 0; i < total && i < MAXIMO_RESULTADOS_BUSCA; i++)
+	{
+		printf(" %s%s", indice->nomes[primeiro + i], i + 1 < total && i + 1 < MAXIMO_RESULTADOS_BUSCA ? " |" : "\n");
+	}
+	return NULL;
+}
+
+Sala* criarSala(HeapTextos* textos, const char* nome, const char* pista)
+{
+	Sala* novo = (Sala*)malloc(sizeof(Sala));
+	if (novo == NULL)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o novo nó.\n");
+		return NULL;
+	}
+
+	if (!atribuirTextoCompacto(textos, &novo->nome, nome) || !atribuirTextoCompacto(textos, &novo->pista, pista))
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para os textos do novo nó.\n");
+		free(novo);
+		return NULL;
+	}
+	novo->esquerda = NULL;
+	novo->direita = NULL;
+
+	return novo;
+}
+
+void exibirPaginaPistas(EntradaComandos* entrada, const Pista* raiz)
+{
+	int totalPistas = tamanhoPista(raiz);
+	int totalPaginas = (totalPistas + TAMANHO_PAGINA_PISTAS - 1) / TAMANHO_PAGINA_PISTAS;
+	char numero[16];
+
+	if (!haComandosPendentes(entrada))
+	{
+		printf("\nDigite a página desejada (1 a %d): ", totalPaginas);
+	}
+	if (!lerArgumentoComando(entrada, numero, sizeof(numero)))
+	{
+		return;
+	}
+
+	int pagina = atoi(numero);
+	if (pagina < 1 || pagina > totalPaginas)
+	{
+		printf("\n==== ⚠️  Página inválida. ====\n");
+		return;
+	}
+
+	const Pista* paginaPistas[TAMANHO_PAGINA_PISTAS];
+	int inicio = (pagina - 1) * TAMANHO_PAGINA_PISTAS;
+	int total = listarPistasPorPosicao(raiz, inicio, TAMANHO_PAGINA_PISTAS, paginaPistas);
+
+	printf("\n  📄  Pistas %d a %d de %d (página %d/%d):\n", inicio + 1, inicio + total, totalPistas, pagina, totalPaginas);
+	for (int i = 0; i < total; i++)
+	{
+		printf(" %d. %s\n", inicio + i + 1, paginaPistas[i]->pista);
+	}
+}
+
+void encontrarSuspeito(JogoMestre* jogo, const char* descricaoPista, int* opcao)
+{	
+	bool acusar = false;
+	int contadorPistas = 0;
+	uint64_t inicio = instanteLatencia();
+
+	// O motor coleta a pista da sala atual na sua árvore e no filtro das coletadas, e diz se ela é nova.
+	StatusMotor status = coletarPistaMotorJogo(jogo->motor);
+	if (status == StatusMotor_SEM_MEMORIA)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a nova pista.\n");
+	}
+	if (status != StatusMotor_OK && status != StatusMotor_PISTA_REPETIDA)
+	{
+		return;
+	}
+	bool novaPista = status == StatusMotor_OK;
+
+	// Precisamos de um valor relativo ao suspeito. Vamos coletar no catálogo da partida.
+	const TabelaHash* tabela = catalogoMotorJogo(jogo->motor);
+	const NoHash* correspondente = buscarNoHash(descricaoPista, tabela, &jogo->consultasCatalogo);
+
+	if (novaPista)
+	{
+		registrarPistaDiario(&jogo->diario, descricaoPista, correspondente);
+		pontuarPistaColetada(&jogo->pontuacao, descricaoPista, tabela);
+	}
+
+	if (correspondente == NULL)
+	{
+		// Nenhuma associação para esta pista.
+		if (novaPista)
+		{
+			registrarLatenciaComando(jogo, ComandoLatencia_COLETA_PISTA, inicio);
+		}
+		return;
+	}
+
+	// Suspeito recuperado.
+	const char* suspeito = lerTextoCompacto(&correspondente->suspeito);
+
+	contadorPistas = pistasSuspeitoMotorJogo(jogo->motor, correspondente->indiceSuspeito);
+	acusar = contadorPistas >= NUMERO_PISTAS_REQUERIDAS;
+
+	printf("\n  🔍  Pista '%s' associada a %s. (Total de pistas: %d)\n", descricaoPista, suspeito, contadorPistas);
+
+	int32_t maisProvavel;
+	if (classificarSuspeitos(&jogo->pontuacao, &maisProvavel, 1) == 1)
+	{
+		printf("\n  📊  Suspeito mais provável: %s(%.1f%%). R(ou r) exibe a classificação.\n",
+			SUSPEITOS_CASO[maisProvavel], 100.0 * probabilidadeSuspeito(&jogo->pontuacao, maisProvavel));
+	}
+	// Só a coleta conta: a sala revisitada apenas reexibe a pista, e a pergunta da acusação espera o jogador.
+	if (novaPista)
+	{
+		registrarLatenciaComando(jogo, ComandoLatencia_COLETA_PISTA, inicio);
+	}
+
+	if (acusar)
+	{
+		exibirPistas(pistasMotorJogo(jogo->motor));
+
+		printf("\n ⚠️  Duas ou mais pistas apontadas a %s durante a investigação.\n", suspeito);
+
+		if (!(lerRespostaSimNao(&jogo->entrada, "\nDeseja acusar este suspeito? (s/n): ") &&
+			verificarSuspeitoFinal(jogo, suspeito, opcao)))
+		{
+			printf("\n De volta à investigação... ⬅️\n");
+		}
+	}
+}
+
+bool verificarSuspeitoFinal(JogoMestre* jogo, const char* acusado, int* opcao)
+{
+	uint64_t inicio = instanteLatencia();
+
+	printf("\n====================== ⚖️ Efetuando Julgamento ======================\n");
+	printf("		Você acusou o suspeito: %s \n", acusado);
+	printf("===================================================================\n");
+
+	int32_t suspeito = indiceSuspeitoMotorJogo(jogo->motor, acusado);
+	bool culpado = false;
+	StatusMotor status = acusarMotorJogo(jogo->motor, suspeito, &culpado);
+	if (status != StatusMotor_OK)
+	{
+		printf("\n  ⚠️  %s\n", descreverStatusMotor(status));
+		registrarLatenciaComando(jogo, ComandoLatencia_ACUSACAO, inicio);
+		return false;
+	}
+
+	registrarEventoDiario(&jogo->diario, EventoDiario_ACUSACAO, jogo->diario.sala, SeguirNaDirecao_NENHUM, -1,
+		suspeito, culpado);
+
+	if (!culpado)
+	{
+		printf(" ❌  %s não é o verdadeiro culpado.\n", acusado);
+		printf("\nAs pistas levaram a uma conclusão incorreta.\n");
+		printf("\n ⚠️  Você precisará continuar a investigação. Revise as pistas antes de tentar novamente.\n");
+		registrarLatenciaComando(jogo, ComandoLatencia_ACUSACAO, inicio);
+		return false;
+	}
+
+	printf("\n  ✅  A investigação foi conclusiva! %s é realmente o culpado!\n", acusado);
+	printf("\n  🕵️  Todas as pistas apontam para este desfecho.\n");
+	printf("\n  🏁  Caso encerrado com sucesso!\n");
+
+	printf("\n===============================================================\n");
+	registrarLatenciaComando(jogo, ComandoLatencia_ACUSACAO, inicio);
+
+	if (lerRespostaSimNao(&jogo->entrada, "\n  🔁  Deseja jogar novamente?(s/n): "))
+	{
+		*opcao = 3; // Jogar de novo.
+		return true;
+	}
+
+	*opcao = 0; // Fim de jogo.
+
+	return true;
+}
+
+int32_t indiceSuspeitoCaso(const char* nome)
+{
+	for (int32_t i = 0; i < TOTAL_SUSPEITOS_CASO; i++)
+	{
+		if (strcmp(SUSPEITOS_CASO[i], nome) == 0)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+void exibirSuspeitosAcusaveis(const MotorJogo* motor)
+{
+	// Uma única passada pelos bitsets de evidências do motor conta as pistas de todos os suspeitos.
+	int32_t contagens[TOTAL_SUSPEITOS_CASO];
+	contarPistasSuspeitosMotorJogo(motor, contagens, NUMERO_PISTAS_REQUERIDAS);
+
+	bool algum = false;
+	for (int32_t i = 0; i < TOTAL_SUSPEITOS_CASO; i++)
+	{
+		int32_t pistas = contagens[i];
+		if (pistas >= NUMERO_PISTAS_REQUERIDAS)
+		{
+			if (!algum)
+			{
+				printf("\n  ⚠️  Suspeitos com %d ou mais pistas coletadas:\n", NUMERO_PISTAS_REQUERIDAS);
+				algum = true;
+			}
+			printf(" • %s: %d pista(s)\n", SUSPEITOS_CASO[i], pistas);
+		}
+	}
+
+	if (!algum)
+	{
+		printf("\n  ℹ️  Nenhum suspeito tem %d ou mais pistas coletadas.\n", NUMERO_PISTAS_REQUERIDAS);
+	}
+}
+
+void pontuarPistaColetada(PontuacaoSuspeitos* pontuacao, const char* pista, const TabelaHash* tabela)
+{
+	int32_t apontados[TOTAL_SUSPEITOS_CASO];
+	int32_t total = 0;
+
+	// Apenas o balde da pista é percorrido: todas as associações da pista ficam nele.
+	for (const NoHash* atual = tabela->dados[funcao_hash(pista)]; atual != NULL && total < TOTAL_SUSPEITOS_CASO; atual = atual->proximo)
+	{
+		if (strcmp(lerTextoCompacto(&atual->pista), pista) == 0)
+		{
+			int32_t suspeito = atual->indiceSuspeito;
+			if (suspeito >= 0)
+			{
+				apontados[total++] = suspeito;
+			}
+		}
+	}
+
+	if (total > 0)
+	{
+		registrarPistaPontuacao(pontuacao, apontados, total, RAZAO_VEROSSIMILHANCA_PISTA);
+	}
+}
+
+void exibirHash(const TabelaHash* table)
+{
+	printf("\n============== Fim de Jogo ==============\n");
+	printf("\n===== Resumo das pistas ↔ suspeitos =====\n\n");
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		NoHash* atual = table->dados[i];
+		while (atual != NULL)
+		{
+			printf(" • [%s] ➜ %s\n", lerTextoCompacto(&atual->suspeito), lerTextoCompacto(&atual->pista));
+			atual = atual->proximo;
+		}
+	}
+}
+
+int altura(const Sala* raiz)
+{
+	if (raiz == NULL)
+	{
+		return 0;
+	}
+
+	int alt_esq = altura(raiz->esquerda);
+	int alt_dir = altura(raiz->direita);
+	return 1 + (alt_esq > alt_dir ? alt_esq : alt_dir);
+}
+
+int profundidade(const Sala* raiz, const Sala* alvo, int nivel)
+{
+	if (raiz == NULL)
+	{
+		return -1;
+	}
+
+	if (raiz == alvo)
+	{
+		return nivel;
+	}
+
+	int esq = profundidade(raiz->esquerda, alvo, nivel + 1);
+
+	if (esq != -1)
+	{
+		return esq;
+	}
+
+	return profundidade(raiz->direita, alvo, nivel + 1);
+}
+
+void preOrdem(const Sala* raiz)
+{
+	if (raiz != NULL)
+	{
+		printf(" • %s\n", lerTextoCompacto(&raiz->nome));
+		preOrdem(raiz->esquerda);
+		preOrdem(raiz->direita);
+	}
+}
+
+void emOrdem(const Sala* raiz)
+{
+	if (raiz != NULL)
+	{
+		emOrdem(raiz->esquerda);
+		printf(" • %s\n", lerTextoCompacto(&raiz->nome));
+		emOrdem(raiz->direita);
+	}
+}
+
+void exibirPistasEmOrdem(const Pista* raiz)
+{
+	if (raiz == NULL)
+	{
+		return;
+	}
+	exibirPistasEmOrdem(raiz->esquerda);
+	printf("\n • %s\n", raiz->pista);
+	exibirPistasEmOrdem(raiz->direita);
+}
+
+void exibirPistas(const Pista* pista)
+{
+	printf("\n  ℹ️  Descrição das pistas encontradas até o momento:\n");
+
+	exibirPistasEmOrdem(pista);
+}
+
+void posOrdem(const Sala* raiz)
+{
+	if (raiz != NULL)
+	{
+		posOrdem(raiz->esquerda);
+		posOrdem(raiz->direita);
+		printf(" • %s\n", lerTextoCompacto(&raiz->nome));
+	}
+}
+
+bool desfazerMovimento(JogoMestre* jogo, const Sala** atual)
+{
+	// O motor desfaz a sala, a árvore de pistas e as pistas de cada suspeito.
+	if (desfazerMotorJogo(jogo->motor) != StatusMotor_OK)
+	{
+		return false;
+	}
+	*atual = &SALAS_CASO[salaAtualMotorJogo(jogo->motor)];
+
+	// A pontuação é refeita com as pistas que restaram: poucas, uma por sala no máximo.
+	const char* pistas[TOTAL_SALAS_CASO];
+	int32_t totalPistas = listarPistasMotorJogo(jogo->motor, pistas, TOTAL_SALAS_CASO);
+	liberarPontuacaoSuspeitos(&jogo->pontuacao);
+	if (!iniciarPontuacaoSuspeitos(&jogo->pontuacao, TOTAL_SUSPEITOS_CASO))
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para a pontuação dos suspeitos.\n");
+	}
+	for (int32_t i = 0; i < totalPistas && i < TOTAL_SALAS_CASO; i++)
+	{
+		pontuarPistaColetada(&jogo->pontuacao, pistas[i], catalogoMotorJogo(jogo->motor));
+	}
+
+	return true;
+}
+
+void liberarMemoria(JogoMestre* jogo)
+{
+	liberarPontuacaoSuspeitos(&jogo->pontuacao);
+
+	printf("\n  ✅  Memória alocada liberada completamente.\n");
+}
+
+// **** Funções utilitárias ****
+
+void limparBufferEntrada(EntradaComandos* entrada)
+{
+	entrada->cursor = entrada->tamanho;
+}
+
+void limparEnter(char* str)
+{
+	str[strcspn(str, "\n")] = '\0';
+}
+
+// **** Funções de Entrada de Comandos ****
+
+/// @brief Verifica se um caractere separa comandos em uma linha.
+static bool separadorComandos(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',' || c == ';';
+}
+
+bool lerLinhaComandos(EntradaComandos* entrada)
+{
+	entrada->cursor = 0;
+	entrada->tamanho = 0;
+
+	if (entrada->fim)
+	{
+		return false;
+	}
+
+	fflush(stdout);
+
+	if (entrada->gerador != NULL)
+	{
+		entrada->fim = !entrada->gerador(entrada->linha, sizeof(entrada->linha), entrada->aguardandoResposta, entrada->contexto);
+		entrada->tamanho = entrada->fim ? 0 : strlen(entrada->linha);
+		return !entrada->fim;
+	}
+
+	// Uma linha maior que o buffer é lida em partes, como linhas consecutivas.
+	if (fgets(entrada->linha, sizeof(entrada->linha), stdin) == NULL)
+	{
+		entrada->fim = true;
+		return false;
+	}
+
+	entrada->tamanho = strlen(entrada->linha);
+	return true;
+}
+
+bool haComandosPendentes(const EntradaComandos* entrada)
+{
+	for (size_t i = entrada->cursor; i < entrada->tamanho; i++)
+	{
+		if (!separadorComandos(entrada->linha[i]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int proximoComando(EntradaComandos* entrada)
+{
+	for (;;)
+	{
+		while (entrada->cursor < entrada->tamanho && separadorComandos(entrada->linha[entrada->cursor]))
+		{
+			entrada->cursor++;
+		}
+
+		if (entrada->cursor < entrada->tamanho)
+		{
+			return (unsigned char)entrada->linha[entrada->cursor++];
+		}
+
+		if (!lerLinhaComandos(entrada))
+		{
+			return EOF;
+		}
+	}
+}
+
+bool lerArgumentoComando(EntradaComandos* entrada, char* destino, size_t capacidade)
+{
+	if (!haComandosPendentes(entrada) && !lerLinhaComandos(entrada))
+	{
+		return false;
+	}
+
+	// O argumento é o restante da linha, sem os espaços das pontas.
+	while (entrada->cursor < entrada->tamanho && separadorComandos(entrada->linha[entrada->cursor]))
+	{
+		entrada->cursor++;
+	}
+	size_t fim = entrada->tamanho;
+	while (fim > entrada->cursor && separadorComandos(entrada->linha[fim - 1]))
+	{
+		fim--;
+	}
+
+	char argumento[TAMANHO_BUFFER_COMANDOS];
+	memcpy(argumento, entrada->linha + entrada->cursor, fim - entrada->cursor);
+	argumento[fim - entrada->cursor] = '\0';
+	copiarTextoLimitado(destino, capacidade, argumento);
+
+	entrada->cursor = entrada->tamanho;
+	return true;
+}
+
+bool lerRespostaSimNao(EntradaComandos* entrada, const char* pergunta)
+{
+	// O restante do lote(ex: "dde" depois do movimento que liberou a acusação) é guardado antes da leitura.
+	char pendentes[TAMANHO_BUFFER_COMANDOS];
+	size_t totalPendentes = entrada->tamanho - entrada->cursor;
+	memcpy(pendentes, entrada->linha + entrada->cursor, totalPendentes);
+
+	bool sim = false;
+	for (;;)
+	{
+		printf("%s", pergunta);
+
+		entrada->aguardandoResposta = true;
+		bool lida = lerLinhaComandos(entrada);
+		entrada->aguardandoResposta = false;
+		if (!lida)
+		{
+			break; // Fim da entrada: não.
+		}
+
+		// A resposta é o primeiro caractere da linha; o restante dela é descartado.
+		while (entrada->cursor < entrada->tamanho && separadorComandos(entrada->linha[entrada->cursor]))
+		{
+			entrada->cursor++;
+		}
+		int resposta = entrada->cursor < entrada->tamanho ? (unsigned char)entrada->linha[entrada->cursor] : EOF;
+		if (resposta == 's' || resposta == 'S' || resposta == 'n' || resposta == 'N')
+		{
+			sim = resposta == 's' || resposta == 'S';
+			break;
+		}
+
+		printf("\n==== ⚠️  Entrada inválida. Esperado: s(ou S) ou n(ou N). ====\n");
+	}
+
+	memcpy(entrada->linha, pendentes, totalPendentes);
+	entrada->cursor = 0;
+	entrada->tamanho = totalPendentes;
+	return sim;
+}
+
+// **** Funções do Índice de Sufixos ****
+
+void exibirBuscaPistas(EntradaComandos* entrada, const Pista* raiz)
+{
+	char trecho[TAMANHO_MAX_PISTA];
+
+	if (!haComandosPendentes(entrada))
+	{
+		printf("\nDigite o trecho a procurar nas pistas coletadas: ");
+	}
+	if (!lerArgumentoComando(entrada, trecho, sizeof(trecho)))
+	{
+		return;
+	}
+
+	IndiceSufixos* indice = criarIndiceSufixosPistas(raiz);
+	if (indice == NULL)
+	{
+		printf("\n  ❌  Erro ao construir o índice de pistas.\n");
+		return;
+	}
+
+	int resultados[MAXIMO_RESULTADOS_BUSCA];
+	int total = buscarTrechoIndice(indice, trecho, false, resultados, MAXIMO_RESULTADOS_BUSCA);
+
+	if (total == 0)
+	{
+		printf("\n  ℹ️  Nenhuma pista coletada contém '%s'.\n", trecho);
+	}
+	else
+	{
+		printf("\n  🔎  Pistas coletadas contendo '%s':\n", trecho);
+		for (int i = 0; i < total && i < MAXIMO_RESULTADOS_BUSCA; i++)
+		{
+			printf(" • %s\n", textoPistaIndice(indice, resultados[i]));
+		}
+	}
+
+	liberarIndiceSufixos(indice);
+}
+
+// **** Funções do Filtro de Bloom ****
+
+void exibirEstatisticasBloom(FILE* saida, const char* nome, const FiltroBloom* filtro, const EstatisticasBloom* estatisticas)
+{
+	if (filtro == NULL)
+	{
+		return;
+	}
+
+	fprintf(saida, "\n===== Filtro de Bloom: %s =====\n", nome);
+	fprintf(saida, " • Tamanho: %zu bloco(s) de %d bits, %d função(ões) hash\n",
+		filtro->totalBlocos, BITS_BLOCO_BLOOM, filtro->totalFuncoes);
+	fprintf(saida, " • Consultas: %llu | Rejeitadas: %llu | Falsos positivos: %llu\n",
+		estatisticas->consultas, estatisticas->rejeitadas, estatisticas->falsosPositivos);
+}
+
+// **** Funções da Mansão Colunar ****
+
+/// @brief Recupera o índice de um texto na mansão colunar, internando-o e registrando-o se for novo.
+/// Como textos internados iguais têm o mesmo endereço, o conjunto compara apenas ponteiros.
+/// @param MansaoColunar. Ponteiro via referência, com capacidade de textos suficiente.
+/// @param Vetor. Conjunto(endereçamento aberto) de índices de textos, com capacidade potência de 2.
+/// @param Inteiro. Capacidade do conjunto.
+/// @param Texto. Ponteiro para o valor de texto.
+/// @returns Inteiro. Índice do texto, ou SEM_INDICE_COLUNAR em caso de falha.
+static int32_t indiceTextoColunar(MansaoColunar* mansao, int32_t* conjunto, size_t capacidade, const char* texto)
+{
+	const char* internado = internarTexto(mansao->heapTextos, texto);
+	if (internado == NULL)
+	{
+		return SEM_INDICE_COLUNAR;
+	}
+
+	size_t posicao = (size_t)(((uintptr_t)internado >> 3) * 11400714819323198485ULL) & (capacidade - 1);
+	while (conjunto[posicao] != SEM_INDICE_COLUNAR)
+	{
+		if (mansao->textos[conjunto[posicao]] == internado)
+		{
+			return conjunto[posicao];
+		}
+		posicao = (posicao + 1) & (capacidade - 1);
+	}
+
+	conjunto[posicao] = mansao->totalTextos;
+	mansao->textos[mansao->totalTextos] = internado;
+	return mansao->totalTextos++;
+}
+
+MansaoColunar* converterMansaoColunar(const Sala* raiz)
+{
+	if (raiz == NULL)
+	{
+		return NULL;
+	}
+
+	// Primeira passada: numera as salas em ordem de nível. A própria fila vira a tabela índice → sala.
+	size_t capacidadeFila = 64;
+	const Sala** fila = (const Sala**)malloc(capacidadeFila * sizeof(const Sala*));
+	if (fila == NULL)
+	{
+		return NULL;
+	}
+
+	int32_t total = 0;
+	fila[total++] = raiz;
+	for (int32_t i = 0; i < total; i++)
+	{
+		const Sala* saidas[2] = { fila[i]->esquerda, fila[i]->direita };
+		for (int lado = 0; lado < 2; lado++)
+		{
+			if (saidas[lado] == NULL)
+			{
+				continue;
+			}
+			if ((size_t)total == capacidadeFila)
+			{
+				const Sala** maior = (const Sala**)realloc((void*)fila, capacidadeFila * 2 * sizeof(const Sala*));
+				if (maior == NULL)
+				{
+					free((void*)fila);
+					return NULL;
+				}
+				fila = maior;
+				capacidadeFila *= 2;
+			}
+			fila[total++] = saidas[lado];
+		}
+	}
+
+	// Cada sala contribui com até dois textos: nome e pista.
+	MansaoColunar* mansao = criarMansaoColunar(total, total * 2);
+	size_t capacidadeConjunto = 1;
+	while (capacidadeConjunto < (size_t)total * 4)
+	{
+		capacidadeConjunto *= 2;
+	}
+	int32_t* conjunto = (int32_t*)malloc(capacidadeConjunto * sizeof(int32_t));
+	if (mansao != NULL)
+	{
+		mansao->heapTextos = criarHeapTextos();
+	}
+	if (mansao == NULL || mansao->heapTextos == NULL || conjunto == NULL)
+	{
+		free((void*)fila);
+		free(conjunto);
+		liberarMansaoColunar(mansao);
+		return NULL;
+	}
+	memset(conjunto, 0xFF, capacidadeConjunto * sizeof(int32_t)); // Todas as posições com SEM_INDICE_COLUNAR.
+
+	// Segunda passada: preenche as colunas. As saídas de uma sala são as próximas da fila, na mesma ordem.
+	int32_t proxima = 1;
+	bool sucesso = true;
+	for (int32_t i = 0; i < total && sucesso; i++)
+	{
+		const Sala* sala = fila[i];
+		mansao->esquerda[i] = sala->esquerda != NULL ? proxima++ : SEM_INDICE_COLUNAR;
+		mansao->direita[i] = sala->direita != NULL ? proxima++ : SEM_INDICE_COLUNAR;
+
+		const char* pista = lerTextoCompacto(&sala->pista);
+		mansao->nome[i] = indiceTextoColunar(mansao, conjunto, capacidadeConjunto, lerTextoCompacto(&sala->nome));
+		mansao->pista[i] = pista[0] != '\0' ? indiceTextoColunar(mansao, conjunto, capacidadeConjunto, pista) : SEM_INDICE_COLUNAR;
+		sucesso = mansao->nome[i] != SEM_INDICE_COLUNAR && (pista[0] == '\0' || mansao->pista[i] != SEM_INDICE_COLUNAR);
+	}
+
+	free((void*)fila);
+	free(conjunto);
+
+	if (!sucesso)
+	{
+		liberarMansaoColunar(mansao);
+		return NULL;
+	}
+
+	return mansao;
+}
+
+void exibirMansaoColunar(const MansaoColunar* mansao, OrdemPercurso ordem)
+{
+	if (mansao == NULL || mansao->totalSalas == 0)
+	{
+		return;
+	}
+
+	int32_t* salas = (int32_t*)malloc((size_t)mansao->totalSalas * sizeof(int32_t));
+	int32_t total = salas != NULL ? percorrerMansaoColunar(mansao, ordem, salas) : -1;
+	if (total < 0)
+	{
+		printf("\n  ❌  Erro ao tentar alocar a memória para o percurso da mansão.\n");
+		free(salas);
+		return;
+	}
+
+	for (int32_t i = 0; i < total; i++)
+	{
+		printf(" • %s\n", mansao->textos[mansao->nome[salas[i]]]);
+	}
+
+	free(salas);
+}
+
+// **** Funções da Pontuação de Suspeitos ****
+
+void exibirClassificacaoSuspeitos(const PontuacaoSuspeitos* pontuacao, const char* const* nomes, int32_t maximo)
+{
+	int32_t classificacao[MAXIMO_CLASSIFICACAO_SUSPEITOS];
+	int32_t total = classificarSuspeitos(pontuacao, classificacao,
+		maximo < MAXIMO_CLASSIFICACAO_SUSPEITOS ? maximo : MAXIMO_CLASSIFICACAO_SUSPEITOS);
+
+	printf("\n===== 📊  Suspeitos mais prováveis(%llu pista(s) avaliada(s)) =====\n\n", pontuacao->pistas);
+	for (int32_t i = 0; i < total; i++)
+	{
+		printf(" %d. %s: %.1f%%\n", i + 1, nomes[classificacao[i]], 100.0 * probabilidadeSuspeito(pontuacao, classificacao[i]));
+	}
+}
+
+// **** Funções do Motor do Jogo ****
+
+void descreverCasoMotor(DescricaoSalaMotor* salas, int32_t* grupos, DescricaoCasoMotor* caso)
+{
+	for (int32_t i = 0; i < TOTAL_SALAS_CASO; i++)
+	{
+		const Sala* sala = &SALAS_CASO[i];
+		salas[i].nome = lerTextoCompacto(&sala->nome);
+		salas[i].pista = lerTextoCompacto(&sala->pista);
+		salas[i].esquerda = sala->esquerda != NULL ? (int32_t)(sala->esquerda - SALAS_CASO) : SEM_INDICE_MOTOR;
+		salas[i].direita = sala->direita != NULL ? (int32_t)(sala->direita - SALAS_CASO) : SEM_INDICE_MOTOR;
+	}
+	for (int32_t i = 0; i < TOTAL_CATALOGO_CASO; i++)
+	{
+		grupos[i] = GRUPOS_CATALOGO_CASO[i];
+	}
+
+	memset(caso, 0, sizeof(DescricaoCasoMotor));
+	caso->salas = salas;
+	caso->totalSalas = TOTAL_SALAS_CASO;
+	caso->suspeitos = SUSPEITOS_CASO;
+	caso->totalSuspeitos = TOTAL_SUSPEITOS_CASO;
+	caso->pistasCatalogo = PISTAS_CATALOGO_CASO;
+	caso->gruposCatalogo = grupos;
+	caso->totalCatalogo = TOTAL_CATALOGO_CASO;
+	caso->pistasRequeridas = NUMERO_PISTAS_REQUERIDAS;
+	caso->voltarAoInicio = true; // As folhas da árvore levam de volta ao Hall, como no nível Aventureiro.
+}
+
+// **** Funções dos Histogramas de Latência ****
+
+/// @brief Pedido de exibição das latências(SIGUSR1), atendido no próximo comando do jogo.
+static volatile sig_atomic_t sinalLatencias;
+
+/// @brief Nomes dos tipos de comando, na ordem de ComandoLatencia.
+static const char* const NOMES_COMANDOS_LATENCIA[TOTAL_COMANDOS_LATENCIA] =
+{
+	"Movimento", "Saída do grafo", "Ida pelo nome", "Desfazer", "Busca", "Listagem",
+	"Classificação", "Reinício", "Coleta de pista", "Acusação",
+};
+
+/// @brief Calcula a largura de um campo da tabela de latências em bytes, para que o texto(UTF-8) ocupe
+/// a quantidade de colunas pedida: cada byte de continuação(ex: o segundo de 'µ') não ocupa coluna.
+static int larguraCampoLatencia(const char* texto, int colunas)
+{
+	for (const unsigned char* c = (const unsigned char*)texto; *c != '\0'; c++)
+	{
+		colunas += (*c & 0xC0) == 0x80;
+	}
+	return colunas;
+}
+
+/// @brief Trata SIGUSR1: apenas marca o pedido, pois exibir não é seguro dentro do tratamento do sinal.
+static void sinalizarLatencias(int sinal)
+{
+	(void)sinal;
+	sinalLatencias = 1;
+}
+
+void registrarLatenciaComando(JogoMestre* jogo, ComandoLatencia comando, uint64_t inicio)
+{
+	registrarLatencia(&jogo->latencias[comando], instanteLatencia() - inicio);
+}
+
+void exibirLatenciasComandos(const JogoMestre* jogo, FILE* saida)
+{
+	fprintf(saida, "\n===== Latência dos comandos(desde o início) =====\n");
+	fprintf(saida, " %-16s %10s %*s %10s %10s %10s %*s\n", "Comando", "Amostras", larguraCampoLatencia("Média", 10), "Média",
+		"p50", "p99", "p999", larguraCampoLatencia("Máxima", 10), "Máxima");
+
+	for (int c = 0; c < TOTAL_COMANDOS_LATENCIA; c++)
+	{
+		const HistogramaLatencia* histograma = &jogo->latencias[c];
+		if (histograma->total == 0)
+		{
+			continue;
+		}
+
+		char media[24], p50[24], p99[24], p999[24], maxima[24];
+		formatarLatencia(media, sizeof(media), histograma->soma / histograma->total);
+		formatarLatencia(p50, sizeof(p50), percentilLatencia(histograma, 0.50));
+		formatarLatencia(p99, sizeof(p99), percentilLatencia(histograma, 0.99));
+		formatarLatencia(p999, sizeof(p999), percentilLatencia(histograma, 0.999));
+		formatarLatencia(maxima, sizeof(maxima), histograma->maximo);
+		fprintf(saida, " %-*s %10llu %*s %*s %*s %*s %*s\n",
+			larguraCampoLatencia(NOMES_COMANDOS_LATENCIA[c], 16), NOMES_COMANDOS_LATENCIA[c], (unsigned long long)histograma->total,
+			larguraCampoLatencia(media, 10), media, larguraCampoLatencia(p50, 10), p50, larguraCampoLatencia(p99, 10), p99,
+			larguraCampoLatencia(p999, 10), p999, larguraCampoLatencia(maxima, 10), maxima);
+	}
+	fflush(saida);
+}
+
+void instalarSinalLatencias()
+{
+#ifdef SIGUSR1
+	signal(SIGUSR1, sinalizarLatencias);
+#endif
+}
+
+void verificarSinalLatencias(const JogoMestre* jogo)
+{
+	if (sinalLatencias)
+	{
+		sinalLatencias = 0;
+		exibirLatenciasComandos(jogo, stderr);
+	}
+}
+
+// **** Funções do Diário de Jogo ****
+
+void registrarPistaDiario(DiarioJogo* diario, const char* pista, const NoHash* associacao)
+{
+	int32_t indicePista = -1, indiceSuspeito = -1;
+
+	if (associacao != NULL)
+	{
+		indicePista = associacao->indicePista;
+		indiceSuspeito = associacao->indiceSuspeito;
+	}
+
+	registrarEventoDiario(diario, EventoDiario_PISTA, diario->sala, SeguirNaDirecao_NENHUM, indicePista, indiceSuspeito, 0);
+}
@@ -0,0 +1,398 @@
+#ifndef JOGO_MESTRE_H
+#define JOGO_MESTRE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "motor_jogo.h"
+#include "diario_jogo.h"
+#include "grafo_mansao.h"
+#include "histograma_latencia.h"
+#include "textos_compactos.h"
+#include "arvore_pistas.h"
+#include "filtro_bloom.h"
+#include "catalogo_pistas.h"
+#include "mansao_colunar.h"
+#include "pontuacao_suspeitos.h"
+#include "indice_salas.h"
+
+// Desafio Detective Quest
+// Jogo do nível Mestre: as salas do caso, a entrada de comandos e a interface de console sobre o motor do jogo,
+// com as latências por comando e o diário das partidas. Usado pelo executável do jogo e pelas ferramentas de
+// diagnóstico, que jogam partidas com geradores de comandos no lugar de stdin.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o número mínimo requerido de pistas para acusar um suspeito.
+#define NUMERO_PISTAS_REQUERIDAS 2
+/// @brief Define o número máximo de pistas exibidas em uma busca por trecho.
+#define MAXIMO_RESULTADOS_BUSCA 32
+/// @brief Define a quantidade de pistas exibidas por página na listagem paginada.
+#define TAMANHO_PAGINA_PISTAS 5
+/// @brief Define o tamanho do buffer de leitura de comandos: cada leitura traz uma linha inteira.
+#define TAMANHO_BUFFER_COMANDOS 4096
+/// @brief Define o tamanho do buffer de saída do jogo, descarregado antes de cada leitura de comandos.
+#define TAMANHO_BUFFER_SAIDA 65536
+/// @brief Define a variável de ambiente com o caminho do diário de jogo. Sem ela(e sem a opção --diario),
+/// as partidas não são registradas.
+#define VARIAVEL_DIARIO_JOGO "DQ_DIARIO"
+/// @brief Define quantos registros do jogo são gravados juntos, com um único fsync.
+#define REGISTROS_POR_SINCRONIZACAO 64
+/// @brief Define a quantidade máxima de suspeitos exibidos em uma classificação.
+#define MAXIMO_CLASSIFICACAO_SUSPEITOS 16
+/// @brief Define a quantidade de tipos de comando com histograma de latências(ComandoLatencia).
+#define TOTAL_COMANDOS_LATENCIA 10
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um tipo personalizado(Sala) com campos para nome e ponteiros(esquerda e direita).
+/// Com textos compactos, o nó ocupa uma única linha de cache. As saídas são ligadas na criação da mansão
+/// e apenas lidas depois: as salas do caso ficam em uma tabela const, em memória somente leitura.
+struct Sala
+{
+	TextoCompacto pista;
+	TextoCompacto nome;
+	const struct Sala* esquerda;
+	const struct Sala* direita;
+};
+
+/// @brief Define a struct com um alias Sala, para uso em uma estratégia BST.
+typedef struct Sala Sala;
+
+/// @brief Define uma enumeração(alias SeguirNaDirecao), usada na navegação de salas.
+typedef enum
+{
+	SeguirNaDirecao_NENHUM = 0,
+	SeguirNaDirecao_ESQUERDA = 1,
+	SeguirNaDirecao_DIREITA = 2,
+	SeguirNaDirecao_SAIDA = 3, // Saída do grafo da mansão, escolhida pelo número.
+	SeguirNaDirecao_NOME = 4, // Ida direta a uma sala, escolhida pelo nome.
+	SeguirNaDirecao_DESFAZER = 5, // Volta ao estado anterior ao último movimento.
+} SeguirNaDirecao;
+
+// **** Tabelas estáticas do caso(geradas na compilação a partir de casos/mansao.caso). ****
+
+// As tabelas são static: cada arquivo que inclui este cabeçalho tem a sua cópia. Entre arquivos passam os
+// índices das salas(ex: os do motor), e não os ponteiros para SALAS_CASO.
+#include "caso_mansao.h"
+
+_Static_assert(TAMANHO_TEXTO_CURTO_GERADO == TAMANHO_TEXTO_CURTO,
+	"O gerador de casos e o jogo precisam usar a mesma capacidade de texto curto.");
+
+/// @brief Define uma enumeração(alias ComandoLatencia), usada na escolha do histograma de latências.
+typedef enum
+{
+	ComandoLatencia_MOVIMENTO = 0, // Esquerda ou direita.
+	ComandoLatencia_SAIDA = 1, // Saída do grafo, pelo número.
+	ComandoLatencia_IDA_POR_NOME = 2,
+	ComandoLatencia_DESFAZER = 3,
+	ComandoLatencia_BUSCA = 4,
+	ComandoLatencia_LISTAGEM = 5,
+	ComandoLatencia_CLASSIFICACAO = 6,
+	ComandoLatencia_REINICIO = 7, // reiniciarJogo.
+	ComandoLatencia_COLETA_PISTA = 8, // Árvore de pistas, catálogo, pontuação e evidências; sem a pergunta da acusação.
+	ComandoLatencia_ACUSACAO = 9, // Julgamento da acusação; sem a pergunta de jogar novamente.
+} ComandoLatencia;
+
+/// @brief Define um gerador de linhas de comando, usado no lugar de stdin(ex: partidas simuladas).
+/// Recebe o buffer da linha, a sua capacidade, se o jogo aguarda uma resposta s/n e o contexto do gerador.
+/// Retorna falso(false) no fim dos comandos.
+typedef bool (*GeradorComandos)(char* linha, size_t capacidade, bool resposta, void* contexto);
+
+/// @brief Define a entrada de comandos do jogo: uma linha inteira é lida de uma vez e os seus comandos
+/// (ex: "eedde") são aplicados em lote, sem uma leitura por tecla.
+typedef struct
+{
+	char linha[TAMANHO_BUFFER_COMANDOS];
+	size_t cursor; // Próximo caractere ainda não consumido da linha.
+	size_t tamanho;
+	bool fim; // Fim da entrada(EOF).
+	bool aguardandoResposta; // O jogo aguarda uma resposta s/n.
+	GeradorComandos gerador; // NULL para ler de stdin.
+	void* contexto;
+} EntradaComandos;
+
+/// @brief Define o contexto do jogo do nível Mestre, criado por quem executa o jogo(ex: main ou uma
+/// partida simulada) e passado a executarJogo. As latências acumulam entre as execuções do mesmo contexto.
+typedef struct
+{
+	EntradaComandos entrada; // Sem gerador, os comandos são lidos de stdin.
+	DiarioJogo diario; // No caminho de quem executa o jogo, ou desativado.
+	MotorJogo* motor; // Partida em andamento: sala atual, árvore de pistas, catálogo, culpado, acusação e desfazer.
+	DescricaoSalaMotor salasMotor[TOTAL_SALAS_CASO]; // Descrição do caso usada pelo motor, que não a copia.
+	int32_t gruposMotor[TOTAL_CATALOGO_CASO];
+	PontuacaoSuspeitos pontuacao; // Da partida em andamento.
+	IndiceSalas* indiceSalas; // Salas do caso por nome, usado na ida direta a uma sala.
+	HistogramaLatencia latencias[TOTAL_COMANDOS_LATENCIA]; // Por ComandoLatencia.
+	EstatisticasBloom consultasCatalogo; // Filtro do catálogo, da partida em andamento.
+	bool diagnostico; // Exibe, em stderr, as estatísticas dos filtros e as latências ao sair(opção --diagnostico).
+} JogoMestre;
+
+_Static_assert(TOTAL_SALAS_CASO <= MAXIMO_SALAS_DIARIO && TOTAL_SUSPEITOS_CASO <= MAXIMO_SUSPEITOS_DIARIO,
+	"O diário de jogo precisa comportar as salas e os suspeitos do caso.");
+
+// **** Funções de Interface de Usuário ****
+
+/// @brief Exibe o menu principal.
+/// @param EntradaComandos. Ponteiro via referência da entrada de comandos do jogo, usado na leitura.
+/// @param Inteiro. Ponteiro via referência, para conter o valor da opção escolhida.
+void exibirMenuPrincipal(EntradaComandos* entrada, int* opcao);
+/// @brief Exibe e monitora o estado atual resultante da investigação,
+/// em função nó atualmente visitado(Sala).
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo.
+/// @param Sala. Ponteiro para recuperação de informações. Somente leitura.
+/// @param Inteiro. Ponteiro via referência, para conter o valor da opção escolhida no menu principal.
+void exibirEstadoInvestigacao(
+	JogoMestre* jogo,
+	const Sala* noLocal,
+	int* opcao);
+
+// **** Funções de Lógica Principal e Gerenciamento de Memória ****
+
+/// @brief Efetua a criação de um contexto do jogo, com a entrada de comandos sobre stdin e as latências zeradas.
+/// @returns JogoMestre. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+JogoMestre* criarJogoMestre();
+/// @brief Libera a memória alocada para um contexto do jogo, fora de uma execução de executarJogo.
+/// @param JogoMestre. Ponteiro via referência, usado na operação de liberação.
+void liberarJogoMestre(JogoMestre* jogo);
+/// @brief Executa o laço principal do jogo, com os comandos da entrada de comandos do contexto, até o jogador sair.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo.
+/// @param Texto. Caminho do diário de jogo, ou NULL para não registrar as partidas.
+/// @param Inteiro. Quantidade de registros do diário gravados por fsync.
+/// @returns Inteiro. EXIT_SUCCESS, em caso de sucesso. Caso contrário, EXIT_FAILURE.
+int executarJogo(JogoMestre* jogo, const char* caminhoDiario, int registrosPorSincronizacao);
+/// @brief Recupera a referência ao nó(Sala) raiz principal. As salas ficam nas tabelas
+/// estáticas do caso, em memória somente leitura, sem nenhuma alocação.
+/// @returns Sala. Ponteiro do tipo conforme especificado. Somente leitura.
+const Sala* criarMansao();
+/// @brief Prepara as principais referências para iniciar uma nova partida, sorteada pelo motor do jogo.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com o motor.
+/// @param Sala. Ponteiro via referência da árvore principal, para leitura e atribuição de valores.
+/// @param Sala. Ponteiro via referência da sala atual, para leitura e atribuição de valores.
+void iniciarNovoJogo(JogoMestre* jogo, const Sala** mansao, const Sala** atual);
+/// @brief Prepara as principais referências para reiniciar em uma nova partida.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com o motor.
+/// @param Sala. Ponteiro via referência da árvore principal, para leitura e atribuição de valores.
+/// @param Sala. Ponteiro via referência da sala atual, para leitura e atribuição de valores.
+void reiniciarJogo(JogoMestre* jogo, const Sala** mansao, const Sala** atual);
+/// @brief Explora os nós de forma hierárquica, simulando uma navegação. O movimento é feito pelo motor do jogo:
+/// sem sala na direção escolhida, ele volta à entrada da mansão.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com o motor.
+/// @param Enumeração. Valor descrevendo a direção a seguir na navegação.
+/// @param Inteiro. Ponteiro via referência, para conter o valor da opção escolhida no menu principal.
+/// @returns Sala. Ponteiro do tipo conforme especificado.
+const Sala* explorarSalasComPistas(JogoMestre* jogo, SeguirNaDirecao direcao, int* opcao);
+/// @brief Segue uma saída da sala atual no grafo da mansão, com o número lido da entrada de comandos.
+/// @param EntradaComandos. Ponteiro via referência da entrada de comandos do jogo, usado na leitura.
+/// @param MansaoGrafo. Ponteiro do grafo das salas de SALAS_CASO. Somente leitura.
+/// @param Sala. Ponteiro da sala atual, em SALAS_CASO. Somente leitura.
+/// @returns Sala. Ponteiro da sala de destino, ou NULL se a saída for inválida ou a entrada terminar.
+const Sala* explorarSaidaGrafo(EntradaComandos* entrada, const MansaoGrafo* grafo, const Sala* atual);
+/// @brief Exibe as saídas numeradas da sala atual no grafo da mansão.
+/// @param MansaoGrafo. Ponteiro do grafo das salas de SALAS_CASO. Somente leitura.
+/// @param Sala. Ponteiro da sala atual, em SALAS_CASO. Somente leitura.
+void exibirSaidasGrafo(const MansaoGrafo* grafo, const Sala* atual);
+/// @brief Exibe a sala mais próxima, em saídas do grafo da mansão, que guarda uma pista ainda não coletada.
+/// @param Sala. Ponteiro da sala atual, em SALAS_CASO. Somente leitura.
+/// @param MotorJogo. Ponteiro via referência do motor, que confere as pistas coletadas(filtro e árvore).
+void exibirPistaMaisProxima(const Sala* atual, MotorJogo* motor);
+/// @brief Vai direto a uma sala pelo nome lido da entrada de comandos. Um prefixo que só uma sala tem
+/// também serve; terminado em '?', ou quando há mais de uma sala com o prefixo, lista os nomes possíveis.
+/// @param EntradaComandos. Ponteiro via referência da entrada de comandos do jogo, usado na leitura.
+/// @param IndiceSalas. Ponteiro do índice das salas de SALAS_CASO por nome. Somente leitura.
+/// @returns Sala. Ponteiro da sala de destino, ou NULL se nenhuma sala foi escolhida.
+const Sala* irParaSalaPorNome(EntradaComandos* entrada, const IndiceSalas* indice);
+/// @brief Cria um ponteiro para um nó, tipo Sala.
+/// Baseado no conteúdo da plataforma.
+/// @param HeapTextos. Ponteiro via referência do heap dos textos longos da sala.
+/// @param Texto. Valor descrevendo o nome da Sala.
+/// @returns Sala. Ponteiro do tipo conforme especificado.
+Sala* criarSala(HeapTextos* textos, const char* nome, const char* pista);
+/// @brief Efetua a exibição de informações sobre as pistas.
+/// @param Pista. Ponteiro via referência, usado na recuperação de informações. Somente leitura.
+/// @returns Pista. Ponteiro do tipo conforme especificado.
+void exibirPistas(const Pista* pista);
+/// @brief Solicita uma página ao jogador e exibe as pistas coletadas correspondentes.
+/// @param EntradaComandos. Ponteiro via referência da entrada de comandos do jogo, usado na leitura.
+/// @param Pista. Ponteiro raiz, usado na recuperação de informações. Somente leitura.
+void exibirPaginaPistas(EntradaComandos* entrada, const Pista* raiz);
+/// @brief Efetua a criação de uma tabela hash, para conter as informações sobre as pistas e suspeitos.
+/// @param Vetor. Ponteiro para um vetor com os TOTAL_SUSPEITOS_CASO suspeitos do caso.
+/// @returns TabelaHash. Ponteiro do tipo conforme especificado.
+TabelaHash* CriarTabelaHash(const char* const* listaSuspeitos);
+/// @brief Efetua a busca do suspeito, além da lógica do controle de exploração e monitoramento de pistas.
+/// A coleta da pista da sala atual(árvore de pistas e catálogo) e as pistas de cada suspeito ficam com o motor do jogo.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com o motor.
+/// @param Texto. Ponteiro para o valor de texto da pista encontrada.
+/// @param Inteiro. Ponteiro via referência, para conter o valor da opção escolhida no menu principal.
+void encontrarSuspeito(JogoMestre* jogo, const char* descricaoPista, int* opcao);
+/// @brief Efetua a lógica do veredito do acusado, julgado pelo motor do jogo.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com o motor.
+/// @param Texto. Ponteiro para o valor de texto do acusado.
+/// @param Inteiro. Ponteiro via referência, para conter o valor da opção escolhida no menu principal.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool verificarSuspeitoFinal(JogoMestre* jogo, const char* acusado, int* opcao);
+/// @brief Recupera o índice de um suspeito do caso pelo nome.
+/// @param Texto. Ponteiro para o valor de texto do nome do suspeito.
+/// @returns Inteiro. Índice em SUSPEITOS_CASO, ou -1 se o nome não for de um suspeito do caso.
+int32_t indiceSuspeitoCaso(const char* nome);
+/// @brief Exibe os suspeitos com NUMERO_PISTAS_REQUERIDAS ou mais pistas coletadas.
+/// @param MotorJogo. Ponteiro usado na recuperação das pistas de cada suspeito. Somente leitura.
+void exibirSuspeitosAcusaveis(const MotorJogo* motor);
+/// @brief Atualiza a pontuação dos suspeitos com uma pista recém-coletada: cada suspeito associado
+/// à pista no catálogo recebe a razão RAZAO_VEROSSIMILHANCA_PISTA.
+/// @param PontuacaoSuspeitos. Ponteiro via referência, usado na atribuição.
+/// @param Texto. Ponteiro para o valor de texto da pista coletada.
+/// @param TabelaHash. Ponteiro via referência, usado para recuperar os suspeitos da pista. Somente leitura.
+void pontuarPistaColetada(PontuacaoSuspeitos* pontuacao, const char* pista, const TabelaHash* tabela);
+/// @brief Exibe um resumo da busca das pistas relativas aos suspeitos.
+/// @param TabelaHash. Ponteiro via referência, usado para recuperar pistas e suspeitos. Somente leitura.
+void exibirHash(const TabelaHash* tabela);
+/// @brief Recupera informações sobre a altura de uma árvore(composição hierárquica).
+/// Baseado no conteúdo da plataforma.
+/// @param Sala. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Valor informando a altura, conforme especificado.
+int altura(const Sala* raiz);
+/// @brief Recupera informações sobre a profundidade(a nível recursivo) 
+/// de uma árvore(composição hierárquica). Baseado no conteúdo da plataforma.
+/// @param Sala. Ponteiro raiz usado na recuperação de informações. Somente leitura.
+/// @param Sala. Ponteiro alvo a ser usado como para consulta de profundidade. Somente leitura.
+/// @param Inteiro. Valor representando o nível máximo de chamadas recursivas permitidas.
+/// @returns Inteiro. Valor informando a profundidade, conforme especificado.
+int profundidade(const Sala* raiz, const Sala* alvo, int nivel);
+/// @brief Efetua a pré-ordenação de um nó e seus descendentes. Baseado no conteúdo da plataforma.
+/// @param Sala. Ponteiro raiz, via referência, usado na operação de pré-ordenação.
+void preOrdem(const Sala* raiz);
+/// @brief Efetua a ordenação de um nó e seus descendentes. Baseado no conteúdo da plataforma.
+/// @param Sala. Ponteiro raiz, via referência, usado na operação de ordenação.
+void emOrdem(const Sala* raiz);
+/// @brief Efetua a ordenação de um nó e seus descendentes. Baseado no conteúdo da plataforma.
+/// @param Sala. Ponteiro raiz, via referência, usado na operação de ordenação. Somente leitura.
+void exibirPistasEmOrdem(const Pista* raiz);
+/// @brief Efetua a pós-ordenação de um nó e seus descendentes.
+/// Baseado no conteúdo da plataforma.
+/// @param Sala. Ponteiro raiz, via referência, usado na operação de pós-ordenação.
+void posOrdem(const Sala* raiz);
+/// @brief Volta ao estado anterior ao último movimento, guardado pelo motor do jogo(sala, pistas coletadas
+/// e pistas de cada suspeito), e refaz a pontuação com as pistas que restaram.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com o motor.
+/// @param Sala. Ponteiro via referência, para atribuição da sala restaurada.
+/// @returns Bool. Verdadeiro(true) se havia um movimento guardado. Caso contrário, falso(false).
+bool desfazerMovimento(JogoMestre* jogo, const Sala** atual);
+/// @brief Libera a memória alocada para uma partida. As salas são estáticas e não são liberadas.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com a pontuação da partida.
+void liberarMemoria(JogoMestre* jogo);
+
+// **** Funções utilitárias ****
+
+/// @brief Limpa o buffer de entrada do teclado, descartando o restante da linha de comandos já lida.
+/// @param EntradaComandos. Ponteiro via referência, usado na operação de limpeza.
+void limparBufferEntrada(EntradaComandos* entrada);
+/// @brief Função para limpar '\n' deixado pelo fgets.
+/// @param str Conteúdo do texto a ser analisado e limpo.
+void limparEnter(char* str);
+
+// **** Funções de Entrada de Comandos ****
+
+/// @brief Lê a próxima linha da entrada para o buffer de comandos. Antes de bloquear na leitura,
+/// descarrega a saída pendente: cada lote de comandos é exibido com uma única escrita.
+/// @param EntradaComandos. Ponteiro via referência, usado na leitura.
+/// @returns Bool. Verdadeiro(true) se uma linha foi lida. Falso(false) no fim da entrada.
+bool lerLinhaComandos(EntradaComandos* entrada);
+/// @brief Verifica se ainda há comandos na linha já lida, sem ler a entrada.
+/// @param EntradaComandos. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Bool. Verdadeiro(true) se houver comandos pendentes. Caso contrário, falso(false).
+bool haComandosPendentes(const EntradaComandos* entrada);
+/// @brief Recupera o próximo comando(um caractere), lendo uma nova linha apenas quando a atual se esgota.
+/// Espaços, vírgulas e ponto e vírgula separam comandos e são ignorados.
+/// @param EntradaComandos. Ponteiro via referência, usado na leitura.
+/// @returns Inteiro. O caractere do comando, ou EOF no fim da entrada.
+int proximoComando(EntradaComandos* entrada);
+/// @brief Recupera o argumento de um comando: o restante da linha atual, se houver; senão, a próxima linha.
+/// Ex: "b sangue" busca 'sangue' e "l 2" exibe a página 2, sem novas perguntas.
+/// @param EntradaComandos. Ponteiro via referência, usado na leitura.
+/// @param Texto. Ponteiro para o buffer de destino.
+/// @param Inteiro. Capacidade do buffer, incluindo o terminador.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Falso(false) no fim da entrada.
+bool lerArgumentoComando(EntradaComandos* entrada, char* destino, size_t capacidade);
+/// @brief Solicita uma resposta s/n, lida de uma nova linha. Os comandos que ainda restam no lote não são
+/// tomados como resposta: voltam ao buffer e são executados depois dela.
+/// @param EntradaComandos. Ponteiro via referência, usado na leitura.
+/// @param Texto. Ponteiro para o texto da pergunta.
+/// @returns Bool. Verdadeiro(true) para sim. Falso(false) para não, ou no fim da entrada.
+bool lerRespostaSimNao(EntradaComandos* entrada, const char* pergunta);
+
+// **** Funções do Índice de Sufixos ****
+
+/// @brief Solicita um trecho ao jogador e exibe as pistas coletadas que o contêm.
+/// @param EntradaComandos. Ponteiro via referência da entrada de comandos do jogo, usado na leitura.
+/// @param Pista. Ponteiro raiz da árvore de pistas. Somente leitura.
+void exibirBuscaPistas(EntradaComandos* entrada, const Pista* raiz);
+
+// **** Funções do Filtro de Bloom ****
+
+/// @brief Exibe o tamanho de um filtro e as estatísticas de consultas, rejeições e falsos positivos de quem o consulta.
+/// @param Arquivo. Saída da exibição(ex: stderr).
+/// @param Texto. Ponteiro para o nome do filtro exibido.
+/// @param FiltroBloom. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param EstatisticasBloom. Ponteiro usado na recuperação de informações. Somente leitura.
+void exibirEstatisticasBloom(FILE* saida, const char* nome, const FiltroBloom* filtro, const EstatisticasBloom* estatisticas);
+
+// **** Funções da Mansão Colunar ****
+
+/// @brief Converte uma mansão encadeada em colunas, numerando as salas em ordem de nível.
+/// Os textos são internados, e cada texto distinto recebe um único índice.
+/// @param Sala. Ponteiro raiz da mansão. Somente leitura.
+/// @returns MansaoColunar. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+MansaoColunar* converterMansaoColunar(const Sala* raiz);
+/// @brief Exibe os nomes das salas da mansão colunar, na ordem informada.
+/// @param MansaoColunar. Ponteiro usado no percurso. Somente leitura.
+/// @param OrdemPercurso. Ordem do percurso(pré, em ou pós-ordem).
+void exibirMansaoColunar(const MansaoColunar* mansao, OrdemPercurso ordem);
+
+// **** Funções da Pontuação de Suspeitos ****
+
+/// @brief Exibe a classificação dos suspeitos mais prováveis, com as probabilidades.
+/// @param PontuacaoSuspeitos. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Vetor. Nomes dos suspeitos, pelo índice.
+/// @param Inteiro. Quantidade máxima de suspeitos exibidos(até MAXIMO_CLASSIFICACAO_SUSPEITOS).
+void exibirClassificacaoSuspeitos(const PontuacaoSuspeitos* pontuacao, const char* const* nomes, int32_t maximo);
+
+// **** Funções do Motor do Jogo ****
+
+/// @brief Monta a descrição do caso da mansão para o motor do jogo(biblioteca detective_quest_motor),
+/// a partir das tabelas estáticas geradas.
+/// @param DescricaoSalaMotor. Ponteiro para um vetor com TOTAL_SALAS_CASO salas, para atribuição.
+/// @param Inteiro. Ponteiro para um vetor com TOTAL_CATALOGO_CASO grupos, para atribuição.
+/// @param DescricaoCasoMotor. Ponteiro via referência, para atribuição.
+void descreverCasoMotor(DescricaoSalaMotor* salas, int32_t* grupos, DescricaoCasoMotor* caso);
+
+// **** Funções dos Histogramas de Latência ****
+
+/// @brief Registra a latência de um comando do jogo, do instante inicial até agora.
+/// @param JogoMestre. Ponteiro via referência do contexto do jogo, com os histogramas.
+/// @param Enumeração. Tipo do comando.
+/// @param Inteiro. Instante inicial, de instanteLatencia.
+void registrarLatenciaComando(JogoMestre* jogo, ComandoLatencia comando, uint64_t inicio);
+/// @brief Exibe os percentis(p50, p99 e p999) das latências de cada tipo de comando.
+/// @param JogoMestre. Ponteiro do contexto do jogo, com os histogramas. Somente leitura.
+/// @param Arquivo. Destino da exibição(ex: stdout).
+void exibirLatenciasComandos(const JogoMestre* jogo, FILE* saida);
+/// @brief Instala o tratamento de SIGUSR1, que pede a exibição das latências(em stderr) no próximo comando.
+/// Sem SIGUSR1(ex: Windows), as latências são exibidas apenas na saída do jogo com --diagnostico.
+void instalarSinalLatencias();
+/// @brief Exibe as latências em stderr, se houve um pedido por sinal desde a última verificação.
+/// @param JogoMestre. Ponteiro do contexto do jogo, com os histogramas. Somente leitura.
+void verificarSinalLatencias(const JogoMestre* jogo);
+
+// **** Funções do Diário de Jogo ****
+
+/// @brief Acrescenta ao diário a coleta de uma pista na sala atual da sessão.
+/// @param DiarioJogo. Ponteiro via referência, para atribuição.
+/// @param Texto. Descrição da pista coletada.
+/// @param NoHash. Associação do catálogo, ou NULL se a pista não tiver suspeito. Somente leitura.
+void registrarPistaDiario(DiarioJogo* diario, const char* pista, const NoHash* associacao);
+
+#endif
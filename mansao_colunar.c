@@ -0,0 +1,153 @@
+#include <stdlib.h>
+
+#include "mansao_colunar.h"
+
+// Desafio Detective Quest
+// Implementação da mansão colunar.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console.
+
+// **** Funções da Mansão Colunar ****
+
+MansaoColunar* criarMansaoColunar(int32_t totalSalas, int32_t capacidadeTextos)
+{
+	MansaoColunar* mansao = (MansaoColunar*)calloc(1, sizeof(MansaoColunar));
+	if (mansao == NULL)
+	{
+		return NULL;
+	}
+
+	size_t salas = (size_t)(totalSalas > 0 ? totalSalas : 1);
+	mansao->esquerda = (int32_t*)malloc(salas * sizeof(int32_t));
+	mansao->direita = (int32_t*)malloc(salas * sizeof(int32_t));
+	mansao->nome = (int32_t*)malloc(salas * sizeof(int32_t));
+	mansao->pista = (int32_t*)malloc(salas * sizeof(int32_t));
+	mansao->marcas = (uint8_t*)calloc(salas, sizeof(uint8_t));
+	mansao->textos = (const char**)malloc((size_t)(capacidadeTextos > 0 ? capacidadeTextos : 1) * sizeof(const char*));
+	mansao->totalSalas = totalSalas;
+
+	if (mansao->esquerda == NULL || mansao->direita == NULL || mansao->nome == NULL ||
+		mansao->pista == NULL || mansao->marcas == NULL || mansao->textos == NULL)
+	{
+		liberarMansaoColunar(mansao);
+		return NULL;
+	}
+
+	return mansao;
+}
+
+int alturaColunar(const MansaoColunar* mansao)
+{
+	if (mansao == NULL || mansao->totalSalas == 0)
+	{
+		return 0;
+	}
+
+	// Em ordem de nível, as salas de um nível são contíguas e o próximo nível começa logo depois,
+	// com tantas salas quantas forem as saídas deste. Uma única varredura sequencial das colunas
+	// de saídas conta os níveis, sem memória auxiliar.
+	int niveis = 0;
+	int32_t inicio = 0;
+	int32_t fim = 1;
+	while (inicio < fim)
+	{
+		int32_t saidas = 0;
+		for (int32_t i = inicio; i < fim; i++)
+		{
+			saidas += (mansao->esquerda[i] != SEM_INDICE_COLUNAR) + (mansao->direita[i] != SEM_INDICE_COLUNAR);
+		}
+		inicio = fim;
+		fim += saidas;
+		niveis++;
+	}
+
+	return niveis;
+}
+
+int32_t percorrerMansaoColunar(const MansaoColunar* mansao, OrdemPercurso ordem, int32_t* destino)
+{
+	if (mansao == NULL || mansao->totalSalas == 0)
+	{
+		return 0;
+	}
+
+	// A pilha guarda o índice da sala no bit alto e, no bit baixo, se ela já foi expandida.
+	int64_t* pilha = (int64_t*)malloc((size_t)mansao->totalSalas * 2 * sizeof(int64_t));
+	if (pilha == NULL)
+	{
+		return -1;
+	}
+
+	int32_t total = 0;
+	size_t topo = 0;
+	pilha[topo++] = 0;
+
+	while (topo > 0)
+	{
+		int64_t item = pilha[--topo];
+		int32_t sala = (int32_t)(item >> 1);
+
+		if ((item & 1) != 0)
+		{
+			destino[total++] = sala; // Segunda visita: a sala entra na posição da sua ordem.
+			continue;
+		}
+
+		int32_t esquerda = mansao->esquerda[sala];
+		int32_t direita = mansao->direita[sala];
+
+		// Empilhado em ordem inversa à de saída.
+		if (ordem == OrdemPercurso_POS)
+		{
+			pilha[topo++] = ((int64_t)sala << 1) | 1;
+		}
+		if (direita != SEM_INDICE_COLUNAR)
+		{
+			pilha[topo++] = (int64_t)direita << 1;
+		}
+		if (ordem == OrdemPercurso_EM)
+		{
+			pilha[topo++] = ((int64_t)sala << 1) | 1;
+		}
+		if (esquerda != SEM_INDICE_COLUNAR)
+		{
+			pilha[topo++] = (int64_t)esquerda << 1;
+		}
+		if (ordem == OrdemPercurso_PRE)
+		{
+			destino[total++] = sala;
+		}
+	}
+
+	free(pilha);
+	return total;
+}
+
+int32_t contarPistasPendentesColunar(const MansaoColunar* mansao)
+{
+	int32_t pendentes = 0;
+
+	// Sem desvios no laço: o compilador pode vetorizar a varredura das duas colunas.
+	for (int32_t i = 0; i < mansao->totalSalas; i++)
+	{
+		pendentes += (mansao->pista[i] != SEM_INDICE_COLUNAR) & ((mansao->marcas[i] & MARCA_SALA_PISTA_COLETADA) == 0);
+	}
+
+	return pendentes;
+}
+
+void liberarMansaoColunar(MansaoColunar* mansao)
+{
+	if (mansao == NULL)
+	{
+		return;
+	}
+
+	free(mansao->esquerda);
+	free(mansao->direita);
+	free(mansao->nome);
+	free(mansao->pista);
+	free(mansao->marcas);
+	free((void*)mansao->textos);
+	liberarHeapTextos(mansao->heapTextos);
+	free(mansao);
+}
@@ -0,0 +1,73 @@
+#ifndef MANSAO_COLUNAR_H
+#define MANSAO_COLUNAR_H
+
+#include <stdint.h>
+
+#include "textos_compactos.h"
+
+// Desafio Detective Quest
+// Mansão em colunas(struct of arrays): cada campo da sala em um vetor denso, para as varreduras da mansão
+// inteira lerem apenas as colunas de que precisam. Os percursos são iterativos, sem recursão.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o índice usado na mansão colunar para indicar a ausência de sala ou de texto.
+#define SEM_INDICE_COLUNAR (-1)
+/// @brief Define a marca de sala(mansão colunar) cuja pista já foi coletada.
+#define MARCA_SALA_PISTA_COLETADA 0x01
+/// @brief Define a marca de sala(mansão colunar) já visitada.
+#define MARCA_SALA_VISITADA 0x02
+
+// **** Definições de estruturas. ****
+
+/// @brief Define uma enumeração(alias OrdemPercurso), usada nos percursos da mansão colunar.
+typedef enum
+{
+	OrdemPercurso_PRE = 0,
+	OrdemPercurso_EM = 1,
+	OrdemPercurso_POS = 2,
+} OrdemPercurso;
+
+/// @brief Define a mansão em colunas(struct of arrays): cada campo da sala fica em um vetor denso,
+/// indexado pela posição da sala. As varreduras leem apenas as colunas de que precisam.
+/// Invariante: as salas ficam em ordem de nível(a raiz é a sala 0 e cada sala vem depois da sua origem).
+typedef struct
+{
+	int32_t* esquerda; // Índice da sala à esquerda, ou SEM_INDICE_COLUNAR.
+	int32_t* direita; // Índice da sala à direita, ou SEM_INDICE_COLUNAR.
+	int32_t* nome; // Índice do nome em textos.
+	int32_t* pista; // Índice da pista em textos, ou SEM_INDICE_COLUNAR quando a sala não tem pista.
+	uint8_t* marcas; // Combinação de MARCA_SALA_*.
+	int32_t totalSalas;
+	const char** textos; // Textos internados, sem repetições.
+	int32_t totalTextos;
+	HeapTextos* heapTextos; // Heap dos textos internados na conversão, ou NULL(textos de um caso gerado).
+} MansaoColunar;
+
+// **** Funções da Mansão Colunar ****
+
+/// @brief Efetua a criação de uma mansão colunar vazia, com as colunas alocadas.
+/// @param Inteiro. Quantidade de salas.
+/// @param Inteiro. Capacidade da tabela de textos.
+/// @returns MansaoColunar. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+MansaoColunar* criarMansaoColunar(int32_t totalSalas, int32_t capacidadeTextos);
+/// @brief Recupera a altura da mansão colunar, varrendo apenas as colunas de saídas.
+/// @param MansaoColunar. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Valor informando a altura, conforme especificado.
+int alturaColunar(const MansaoColunar* mansao);
+/// @brief Efetua um percurso da mansão colunar, sem recursão, lendo apenas as colunas de saídas.
+/// @param MansaoColunar. Ponteiro usado no percurso. Somente leitura.
+/// @param OrdemPercurso. Ordem do percurso(pré, em ou pós-ordem).
+/// @param Vetor. Ponteiro para receber os índices das salas, com capacidade para totalSalas.
+/// @returns Inteiro. Quantidade de salas percorridas, ou -1 em caso de falha de alocação.
+int32_t percorrerMansaoColunar(const MansaoColunar* mansao, OrdemPercurso ordem, int32_t* destino);
+/// @brief Conta as salas que ainda guardam uma pista não coletada, varrendo as colunas de pistas e marcas.
+/// @param MansaoColunar. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Quantidade de salas com pistas pendentes.
+int32_t contarPistasPendentesColunar(const MansaoColunar* mansao);
+/// @brief Libera a memória alocada para a mansão colunar, com o heap dos textos internados na conversão.
+/// Os textos de um caso gerado(sem heap) não são liberados.
+/// @param MansaoColunar. Ponteiro via referência, usado na operação de liberação.
+void liberarMansaoColunar(MansaoColunar* mansao);
+
+#endif
@@ -0,0 +1,632 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "motor_jogo.h"
+
+// Desafio Detective Quest
+// Implementação do motor do jogo. Nenhuma função deste arquivo usa a entrada ou a saída do console.
+// As pistas coletadas ficam na árvore persistente de arvore_pistas.c, e o catálogo, em catalogo_pistas.c.
+
+// **** Definições de estruturas. ****
+
+/// @brief Define o estado guardado antes de um movimento, para o desfazer. A árvore de pistas é guardada
+/// por uma referência à raiz(versão persistente), em tempo constante.
+typedef struct
+{
+	int32_t sala;
+	int32_t totalPistas; // As pistas coletadas depois do movimento são as de ordemPistas a partir daqui.
+	Pista* pistas; // Versão da árvore antes do movimento, com uma referência do estado.
+} EstadoDesfazerMotor;
+
+/// @brief Define o estado do motor e da partida em andamento.
+struct MotorJogo
+{
+	DescricaoCasoMotor caso;
+	int32_t salaAtual;
+	bool encerrado;
+	int32_t culpado;
+	HeapTextos* textos; // Textos e chaves de colação da árvore de pistas, de todas as partidas do motor.
+	Pista* pistas; // Árvore das pistas coletadas, em ordem de colação.
+	FiltroBloom* filtroPistas; // Filtro das pistas coletadas na partida, consultado antes da árvore.
+	EstatisticasBloom consultasPistas; // Consultas ao filtro das pistas coletadas, na partida.
+	size_t salasComPista; // Capacidade do filtro: uma partida coleta no máximo uma pista por sala com pista.
+	int32_t totalPistas;
+	const char** ordemPistas; // Pistas coletadas, na ordem da coleta(uma por sala, no máximo).
+	int32_t* suspeitoGrupo; // Suspeito de cada grupo do catálogo, após o embaralhamento.
+	ConjuntosEvidencias* evidencias; // Pistas do catálogo coletadas e as de cada suspeito, em bitsets; NULL sem catálogo.
+	TabelaHash* catalogo; // Catálogo pista → suspeito da partida, montado a cada embaralhamento.
+	EventoMotor eventos[CAPACIDADE_EVENTOS_MOTOR]; // Fila circular.
+	int32_t inicioEventos;
+	int32_t totalEventos;
+	EstadoDesfazerMotor desfazer[CAPACIDADE_DESFAZER_MOTOR]; // Pilha circular.
+	int32_t inicioDesfazer;
+	int32_t totalDesfazer;
+};
+
+// **** Implementação das funções. ****
+
+// **** Funções utilitárias ****
+
+/// @brief Sorteia o próximo valor de 64 bits(SplitMix64) a partir do estado, que é avançado.
+static uint64_t sortearMotor(uint64_t* estado)
+{
+	uint64_t z = (*estado += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/// @brief Acrescenta um evento à fila do motor. Com a fila cheia, o evento mais antigo é descartado.
+static void emitirEventoMotor(MotorJogo* motor, TipoEventoMotor tipo, int32_t sala, int32_t suspeito, int32_t valor, const char* texto)
+{
+	if (motor->totalEventos == CAPACIDADE_EVENTOS_MOTOR)
+	{
+		motor->inicioEventos = (motor->inicioEventos + 1) % CAPACIDADE_EVENTOS_MOTOR;
+		motor->totalEventos--;
+	}
+
+	EventoMotor* evento = &motor->eventos[(motor->inicioEventos + motor->totalEventos) % CAPACIDADE_EVENTOS_MOTOR];
+	evento->tipo = tipo;
+	evento->sala = sala;
+	evento->suspeito = suspeito;
+	evento->valor = valor;
+	evento->texto = texto;
+	motor->totalEventos++;
+}
+
+// **** Funções da Árvore de Pistas ****
+
+/// @brief Copia as pistas da árvore em ordem, até a capacidade do destino.
+static void listarPistasEmOrdemMotor(const Pista* raiz, const char** destino, int32_t maximo, int32_t* posicao)
+{
+	if (raiz == NULL)
+	{
+		return;
+	}
+
+	listarPistasEmOrdemMotor(raiz->esquerda, destino, maximo, posicao);
+	if (*posicao < maximo)
+	{
+		destino[*posicao] = raiz->pista;
+	}
+	(*posicao)++;
+	listarPistasEmOrdemMotor(raiz->direita, destino, maximo, posicao);
+}
+
+// **** Funções do Catálogo ****
+
+/// @brief Monta o catálogo da partida: cada pista aponta para o suspeito sorteado para o seu grupo,
+/// no catálogo e no bitset do suspeito. As pistas coletadas da partida anterior são descartadas.
+/// O catálogo fica fixo durante a partida, e as buscas passam para o índice perfeito.
+static StatusMotor montarCatalogoMotor(MotorJogo* motor)
+{
+	liberarTabelaHash(motor->catalogo);
+	limparConjuntosEvidencias(motor->evidencias);
+	motor->catalogo = alocarTabelaHash((size_t)motor->caso.totalCatalogo);
+	if (motor->catalogo == NULL)
+	{
+		return StatusMotor_SEM_MEMORIA;
+	}
+
+	for (int32_t i = 0; i < motor->caso.totalCatalogo; i++)
+	{
+		const char* pista = motor->caso.pistasCatalogo[i];
+		if (buscarNoHash(pista, motor->catalogo, NULL) != NULL)
+		{
+			return StatusMotor_CASO_INVALIDO; // Pista repetida no catálogo.
+		}
+
+		int32_t suspeito = motor->suspeitoGrupo[motor->caso.gruposCatalogo[i]];
+		if (!inserirNoHashIndices(pista, motor->caso.suspeitos[suspeito], i, suspeito, motor->catalogo))
+		{
+			return StatusMotor_SEM_MEMORIA;
+		}
+		associarPistaEvidencias(motor->evidencias, i, suspeito);
+	}
+
+	if (motor->caso.totalCatalogo > 0 && !indexarTabelaHashPerfeita(motor->catalogo))
+	{
+		return StatusMotor_SEM_MEMORIA;
+	}
+
+	return StatusMotor_OK;
+}
+
+// **** Funções do Motor do Jogo ****
+
+/// @brief Guarda a sala atual e a versão da árvore de pistas antes de um movimento. Com a pilha cheia,
+/// o estado mais antigo é descartado.
+static void guardarDesfazerMotor(MotorJogo* motor)
+{
+	if (motor->totalDesfazer == CAPACIDADE_DESFAZER_MOTOR)
+	{
+		liberarPista(motor->desfazer[motor->inicioDesfazer].pistas);
+		motor->inicioDesfazer = (motor->inicioDesfazer + 1) % CAPACIDADE_DESFAZER_MOTOR;
+		motor->totalDesfazer--;
+	}
+
+	EstadoDesfazerMotor* estado = &motor->desfazer[(motor->inicioDesfazer + motor->totalDesfazer) % CAPACIDADE_DESFAZER_MOTOR];
+	estado->sala = motor->salaAtual;
+	estado->totalPistas = motor->totalPistas;
+	estado->pistas = reterPista(motor->pistas);
+	motor->totalDesfazer++;
+}
+
+/// @brief Descarta os estados guardados para o desfazer, devolvendo as suas versões da árvore.
+static void descartarDesfazerMotor(MotorJogo* motor)
+{
+	for (int32_t i = 0; i < motor->totalDesfazer; i++)
+	{
+		liberarPista(motor->desfazer[(motor->inicioDesfazer + i) % CAPACIDADE_DESFAZER_MOTOR].pistas);
+	}
+	motor->inicioDesfazer = 0;
+	motor->totalDesfazer = 0;
+}
+
+/// @brief Confere as saídas das salas e os grupos do catálogo da descrição.
+static bool validarCasoMotor(const DescricaoCasoMotor* caso)
+{
+	if (caso->salas == NULL || caso->totalSalas < 1 || caso->totalSuspeitos < 0 || caso->totalCatalogo < 0 ||
+		caso->pistasRequeridas < 0 || (caso->totalSuspeitos > 0 && caso->suspeitos == NULL) ||
+		(caso->totalCatalogo > 0 && (caso->pistasCatalogo == NULL || caso->gruposCatalogo == NULL || caso->totalSuspeitos == 0)))
+	{
+		return false;
+	}
+
+	for (int32_t i = 0; i < caso->totalSalas; i++)
+	{
+		const DescricaoSalaMotor* sala = &caso->salas[i];
+		if (sala->nome == NULL || sala->esquerda < SEM_INDICE_MOTOR || sala->esquerda >= caso->totalSalas ||
+			sala->direita < SEM_INDICE_MOTOR || sala->direita >= caso->totalSalas)
+		{
+			return false;
+		}
+	}
+	for (int32_t i = 0; i < caso->totalCatalogo; i++)
+	{
+		if (caso->pistasCatalogo[i] == NULL || caso->gruposCatalogo[i] < 0 || caso->gruposCatalogo[i] >= caso->totalSuspeitos)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+StatusMotor criarMotorJogo(const DescricaoCasoMotor* caso, uint64_t semente, MotorJogo** motor)
+{
+	if (motor == NULL)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+	*motor = NULL;
+	if (caso == NULL)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+	if (!validarCasoMotor(caso))
+	{
+		return StatusMotor_CASO_INVALIDO;
+	}
+
+	MotorJogo* novo = (MotorJogo*)calloc(1, sizeof(MotorJogo));
+	if (novo == NULL)
+	{
+		return StatusMotor_SEM_MEMORIA;
+	}
+	novo->caso = *caso;
+
+	size_t totalSuspeitos = caso->totalSuspeitos > 0 ? (size_t)caso->totalSuspeitos : 1;
+	novo->suspeitoGrupo = (int32_t*)malloc(totalSuspeitos * sizeof(int32_t));
+	novo->evidencias = caso->totalCatalogo > 0 ? criarConjuntosEvidencias(caso->totalCatalogo, caso->totalSuspeitos) : NULL;
+	novo->ordemPistas = (const char**)malloc((size_t)caso->totalSalas * sizeof(const char*));
+	novo->textos = criarHeapTextos();
+	for (int32_t i = 0; i < caso->totalSalas; i++)
+	{
+		novo->salasComPista += caso->salas[i].pista != NULL && caso->salas[i].pista[0] != '\0';
+	}
+	StatusMotor status = novo->suspeitoGrupo != NULL && (novo->evidencias != NULL || caso->totalCatalogo == 0) &&
+		novo->ordemPistas != NULL &&
+		novo->textos != NULL ? reiniciarMotorJogo(novo, semente) : StatusMotor_SEM_MEMORIA;
+	if (status != StatusMotor_OK)
+	{
+		liberarMotorJogo(novo);
+		return status;
+	}
+
+	*motor = novo;
+	return StatusMotor_OK;
+}
+
+StatusMotor reiniciarMotorJogo(MotorJogo* motor, uint64_t semente)
+{
+	if (motor == NULL)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+
+	descartarDesfazerMotor(motor);
+	liberarPista(motor->pistas);
+	motor->pistas = NULL;
+	motor->totalPistas = 0;
+	motor->salaAtual = 0;
+
+	// Um filtro de Bloom não remove chaves: cada partida começa com um filtro novo.
+	liberarFiltroBloom(motor->filtroPistas);
+	motor->filtroPistas = NULL;
+	motor->consultasPistas = (EstatisticasBloom){ 0 };
+	if (motor->salasComPista > 0)
+	{
+		motor->filtroPistas = criarFiltroBloom(motor->salasComPista, TAXA_FALSOS_POSITIVOS_BLOOM);
+		if (motor->filtroPistas == NULL)
+		{
+			return StatusMotor_SEM_MEMORIA;
+		}
+	}
+	motor->encerrado = false;
+	motor->inicioEventos = 0;
+	motor->totalEventos = 0;
+
+	// Embaralhamento dos suspeitos entre os grupos(Fisher-Yates) e sorteio do culpado.
+	uint64_t estado = semente;
+	for (int32_t i = 0; i < motor->caso.totalSuspeitos; i++)
+	{
+		motor->suspeitoGrupo[i] = i;
+	}
+	for (int32_t i = motor->caso.totalSuspeitos - 1; i > 0; i--)
+	{
+		int32_t j = (int32_t)(sortearMotor(&estado) % (uint64_t)(i + 1));
+		int32_t temp = motor->suspeitoGrupo[i];
+		motor->suspeitoGrupo[i] = motor->suspeitoGrupo[j];
+		motor->suspeitoGrupo[j] = temp;
+	}
+	motor->culpado = motor->caso.totalSuspeitos > 0 ? (int32_t)(sortearMotor(&estado) % (uint64_t)motor->caso.totalSuspeitos) : SEM_INDICE_MOTOR;
+
+	StatusMotor status = montarCatalogoMotor(motor);
+	if (status != StatusMotor_OK)
+	{
+		return status;
+	}
+
+	emitirEventoMotor(motor, EventoMotor_SALA_VISITADA, 0, SEM_INDICE_MOTOR, 0, motor->caso.salas[0].nome);
+	return StatusMotor_OK;
+}
+
+StatusMotor moverMotorJogo(MotorJogo* motor, DirecaoMotor direcao)
+{
+	if (motor == NULL || (direcao != DirecaoMotor_ESQUERDA && direcao != DirecaoMotor_DIREITA))
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+	if (motor->encerrado)
+	{
+		return StatusMotor_JOGO_ENCERRADO;
+	}
+
+	const DescricaoSalaMotor* atual = &motor->caso.salas[motor->salaAtual];
+	int32_t destino = direcao == DirecaoMotor_ESQUERDA ? atual->esquerda : atual->direita;
+	StatusMotor status = StatusMotor_OK;
+	if (destino == SEM_INDICE_MOTOR)
+	{
+		emitirEventoMotor(motor, EventoMotor_FIM_DO_CAMINHO, motor->salaAtual, SEM_INDICE_MOTOR, motor->caso.voltarAoInicio, NULL);
+		if (!motor->caso.voltarAoInicio)
+		{
+			motor->encerrado = true;
+			return StatusMotor_SEM_SAIDA;
+		}
+		destino = 0;
+		status = StatusMotor_SEM_SAIDA;
+	}
+
+	guardarDesfazerMotor(motor);
+	motor->salaAtual = destino;
+	emitirEventoMotor(motor, EventoMotor_SALA_VISITADA, destino, SEM_INDICE_MOTOR, 0, motor->caso.salas[destino].nome);
+	return status;
+}
+
+StatusMotor irParaSalaMotorJogo(MotorJogo* motor, int32_t sala)
+{
+	if (motor == NULL || sala < 0 || sala >= motor->caso.totalSalas)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+	if (motor->encerrado)
+	{
+		return StatusMotor_JOGO_ENCERRADO;
+	}
+
+	guardarDesfazerMotor(motor);
+	motor->salaAtual = sala;
+	emitirEventoMotor(motor, EventoMotor_SALA_VISITADA, sala, SEM_INDICE_MOTOR, 0, motor->caso.salas[sala].nome);
+	return StatusMotor_OK;
+}
+
+StatusMotor desfazerMotorJogo(MotorJogo* motor)
+{
+	if (motor == NULL)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+	if (motor->encerrado)
+	{
+		return StatusMotor_JOGO_ENCERRADO;
+	}
+	if (motor->totalDesfazer == 0)
+	{
+		return StatusMotor_SEM_DESFAZER;
+	}
+
+	motor->totalDesfazer--;
+	const EstadoDesfazerMotor* estado = &motor->desfazer[(motor->inicioDesfazer + motor->totalDesfazer) % CAPACIDADE_DESFAZER_MOTOR];
+
+	// A versão guardada da árvore volta a ser a atual; a referência do estado passa para o motor.
+	// As pistas descartadas continuam no filtro, como falsos positivos resolvidos pela árvore.
+	liberarPista(motor->pistas);
+	motor->pistas = estado->pistas;
+
+	// As pistas coletadas depois do movimento deixam de contar para os seus suspeitos.
+	int32_t descartadas = motor->totalPistas - estado->totalPistas;
+	while (motor->totalPistas > estado->totalPistas)
+	{
+		const char* pista = motor->ordemPistas[--motor->totalPistas];
+
+		const NoHash* no = buscarNoHash(pista, motor->catalogo, NULL);
+		if (no != NULL)
+		{
+			desmarcarPistaColetadaEvidencias(motor->evidencias, no->indicePista);
+		}
+	}
+
+	motor->salaAtual = estado->sala;
+	emitirEventoMotor(motor, EventoMotor_MOVIMENTO_DESFEITO, estado->sala, SEM_INDICE_MOTOR, descartadas, motor->caso.salas[estado->sala].nome);
+	return StatusMotor_OK;
+}
+
+StatusMotor coletarPistaMotorJogo(MotorJogo* motor)
+{
+	if (motor == NULL)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+	if (motor->encerrado)
+	{
+		return StatusMotor_JOGO_ENCERRADO;
+	}
+
+	const char* pista = motor->caso.salas[motor->salaAtual].pista;
+	if (pista == NULL || pista[0] == '\0')
+	{
+		return StatusMotor_SEM_PISTA;
+	}
+
+	if (pistaColetadaMotorJogo(motor, pista))
+	{
+		return StatusMotor_PISTA_REPETIDA;
+	}
+	motor->pistas = inserirPista(motor->textos, motor->pistas, pista);
+	if (tamanhoPista(motor->pistas) == motor->totalPistas)
+	{
+		return StatusMotor_SEM_MEMORIA;
+	}
+	inserirFiltroBloom(motor->filtroPistas, pista);
+	motor->ordemPistas[motor->totalPistas++] = pista;
+
+	// A pista do catálogo conta para o seu suspeito; ao atingir as requeridas, a acusação é liberada.
+	int32_t suspeito = SEM_INDICE_MOTOR, total = 0;
+	const NoHash* no = buscarNoHash(pista, motor->catalogo, NULL);
+	if (no != NULL)
+	{
+		suspeito = no->indiceSuspeito;
+		marcarPistaColetadaEvidencias(motor->evidencias, no->indicePista);
+		total = contarPistasSuspeitoEvidencias(motor->evidencias, suspeito);
+	}
+	emitirEventoMotor(motor, EventoMotor_PISTA_COLETADA, motor->salaAtual, suspeito, total, pista);
+	if (suspeito != SEM_INDICE_MOTOR && motor->caso.pistasRequeridas > 0 && total == motor->caso.pistasRequeridas)
+	{
+		emitirEventoMotor(motor, EventoMotor_ACUSACAO_LIBERADA, motor->salaAtual, suspeito, total, motor->caso.suspeitos[suspeito]);
+	}
+
+	return StatusMotor_OK;
+}
+
+StatusMotor consultarSuspeitoMotorJogo(const MotorJogo* motor, const char* pista, int32_t* suspeito)
+{
+	if (motor == NULL || pista == NULL || suspeito == NULL)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+
+	const NoHash* no = buscarNoHash(pista, motor->catalogo, NULL);
+	if (no == NULL)
+	{
+		*suspeito = SEM_INDICE_MOTOR;
+		return StatusMotor_SEM_PISTA;
+	}
+
+	*suspeito = no->indiceSuspeito;
+	return StatusMotor_OK;
+}
+
+bool pistaColetadaMotorJogo(MotorJogo* motor, const char* pista)
+{
+	if (!consultarFiltroBloom(motor->filtroPistas, pista, &motor->consultasPistas))
+	{
+		return false; // Ausência garantida pelo filtro.
+	}
+
+	bool coletada = buscarPista(motor->pistas, pista) != NULL;
+	if (!coletada && motor->filtroPistas != NULL)
+	{
+		motor->consultasPistas.falsosPositivos++;
+	}
+
+	return coletada;
+}
+
+int32_t pistasSuspeitoMotorJogo(const MotorJogo* motor, int32_t suspeito)
+{
+	if (motor == NULL || suspeito < 0 || suspeito >= motor->caso.totalSuspeitos)
+	{
+		return 0;
+	}
+
+	return contarPistasSuspeitoEvidencias(motor->evidencias, suspeito);
+}
+
+StatusMotor acusarMotorJogo(MotorJogo* motor, int32_t suspeito, bool* culpado)
+{
+	if (motor == NULL || suspeito < 0 || suspeito >= motor->caso.totalSuspeitos)
+	{
+		return StatusMotor_PARAMETRO_INVALIDO;
+	}
+	if (motor->encerrado)
+	{
+		return StatusMotor_JOGO_ENCERRADO;
+	}
+	if (contarPistasSuspeitoEvidencias(motor->evidencias, suspeito) < motor->caso.pistasRequeridas)
+	{
+		return StatusMotor_PISTAS_INSUFICIENTES;
+	}
+
+	bool acertou = suspeito == motor->culpado;
+	motor->encerrado = acertou;
+	if (culpado != NULL)
+	{
+		*culpado = acertou;
+	}
+
+	emitirEventoMotor(motor, EventoMotor_ACUSACAO, motor->salaAtual, suspeito, acertou, motor->caso.suspeitos[suspeito]);
+	return StatusMotor_OK;
+}
+
+bool proximoEventoMotorJogo(MotorJogo* motor, EventoMotor* evento)
+{
+	if (motor == NULL || evento == NULL || motor->totalEventos == 0)
+	{
+		return false;
+	}
+
+	*evento = motor->eventos[motor->inicioEventos];
+	motor->inicioEventos = (motor->inicioEventos + 1) % CAPACIDADE_EVENTOS_MOTOR;
+	motor->totalEventos--;
+	return true;
+}
+
+int32_t salaAtualMotorJogo(const MotorJogo* motor)
+{
+	return motor->salaAtual;
+}
+
+bool encerradoMotorJogo(const MotorJogo* motor)
+{
+	return motor->encerrado;
+}
+
+int32_t culpadoMotorJogo(const MotorJogo* motor)
+{
+	return motor->culpado;
+}
+
+const DescricaoCasoMotor* casoMotorJogo(const MotorJogo* motor)
+{
+	return &motor->caso;
+}
+
+const Pista* pistasMotorJogo(const MotorJogo* motor)
+{
+	return motor->pistas;
+}
+
+const TabelaHash* catalogoMotorJogo(const MotorJogo* motor)
+{
+	return motor->catalogo;
+}
+
+const FiltroBloom* filtroPistasMotorJogo(const MotorJogo* motor)
+{
+	return motor->filtroPistas;
+}
+
+const EstatisticasBloom* consultasPistasMotorJogo(const MotorJogo* motor)
+{
+	return &motor->consultasPistas;
+}
+
+int32_t contarPistasSuspeitosMotorJogo(const MotorJogo* motor, int32_t* contagens, int32_t minimo)
+{
+	if (motor->evidencias == NULL)
+	{
+		for (int32_t i = 0; i < motor->caso.totalSuspeitos; i++)
+		{
+			contagens[i] = 0;
+		}
+		return minimo <= 0 ? motor->caso.totalSuspeitos : 0;
+	}
+
+	return contarPistasSuspeitosEvidencias(motor->evidencias, contagens, minimo);
+}
+
+int32_t listarPistasMotorJogo(const MotorJogo* motor, const char** destino, int32_t maximo)
+{
+	int32_t posicao = 0;
+	listarPistasEmOrdemMotor(motor->pistas, destino, destino != NULL ? maximo : 0, &posicao);
+	return posicao;
+}
+
+int32_t indiceSuspeitoMotorJogo(const MotorJogo* motor, const char* nome)
+{
+	for (int32_t i = 0; i < motor->caso.totalSuspeitos; i++)
+	{
+		if (strcmp(motor->caso.suspeitos[i], nome) == 0)
+		{
+			return i;
+		}
+	}
+
+	return SEM_INDICE_MOTOR;
+}
+
+const char* descreverStatusMotor(StatusMotor status)
+{
+	switch (status)
+	{
+	case StatusMotor_OK:
+		return "Operação concluída.";
+	case StatusMotor_SEM_MEMORIA:
+		return "Memória insuficiente.";
+	case StatusMotor_PARAMETRO_INVALIDO:
+		return "Parâmetro inválido.";
+	case StatusMotor_CASO_INVALIDO:
+		return "Descrição de caso inválida.";
+	case StatusMotor_SEM_PISTA:
+		return "Não há pista do catálogo aqui.";
+	case StatusMotor_PISTA_REPETIDA:
+		return "Pista já coletada.";
+	case StatusMotor_SEM_SAIDA:
+		return "Não há sala nesta direção.";
+	case StatusMotor_PISTAS_INSUFICIENTES:
+		return "Pistas insuficientes para a acusação.";
+	case StatusMotor_JOGO_ENCERRADO:
+		return "A partida está encerrada.";
+	case StatusMotor_SEM_DESFAZER:
+		return "Não há movimento para desfazer.";
+	default:
+		return "Status desconhecido.";
+	}
+}
+
+void liberarMotorJogo(MotorJogo* motor)
+{
+	if (motor == NULL)
+		return;
+
+	descartarDesfazerMotor(motor);
+	liberarPista(motor->pistas);
+	liberarFiltroBloom(motor->filtroPistas);
+	liberarTabelaHash(motor->catalogo);
+	liberarHeapTextos(motor->textos);
+	free(motor->suspeitoGrupo);
+	liberarConjuntosEvidencias(motor->evidencias);
+	free(motor->ordemPistas);
+	free(motor);
+}
@@ -0,0 +1,222 @@
+#ifndef MOTOR_JOGO_H
+#define MOTOR_JOGO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arvore_pistas.h"
+#include "catalogo_pistas.h"
+#include "filtro_bloom.h"
+#include "conjuntos_evidencias.h"
+
+// Desafio Detective Quest
+// Motor do jogo: navegação pela mansão, coleta de pistas(árvore AVL persistente, em ordem de colação),
+// catálogo pista → suspeito(tabela hash com índice perfeito) e acusação. O motor não lê do teclado nem escreve no console: cada operação devolve
+// um StatusMotor, e o que aconteceu no jogo fica na fila de eventos, consumida pela interface.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o índice usado para indicar a ausência de sala(saída inexistente) ou de suspeito.
+#define SEM_INDICE_MOTOR (-1)
+/// @brief Define a capacidade da fila de eventos do motor. Quando cheia, o evento mais antigo é descartado.
+#define CAPACIDADE_EVENTOS_MOTOR 64
+/// @brief Define a quantidade de movimentos guardados para o desfazer. Quando cheia, o mais antigo é descartado.
+#define CAPACIDADE_DESFAZER_MOTOR 64
+
+// **** Definições de estruturas. ****
+
+/// @brief Define o resultado de uma operação do motor.
+typedef enum
+{
+	StatusMotor_OK = 0,
+	StatusMotor_SEM_MEMORIA = 1,
+	StatusMotor_PARAMETRO_INVALIDO = 2, // Motor ou caso ausente, índice ou direção fora do intervalo.
+	StatusMotor_CASO_INVALIDO = 3, // Saída para uma sala inexistente, ou grupo do catálogo sem suspeito.
+	StatusMotor_SEM_PISTA = 4, // A sala atual não tem pista, ou a pista não está no catálogo.
+	StatusMotor_PISTA_REPETIDA = 5, // A pista da sala atual já foi coletada.
+	StatusMotor_SEM_SAIDA = 6, // Não há sala na direção escolhida.
+	StatusMotor_PISTAS_INSUFICIENTES = 7, // O suspeito ainda não tem as pistas requeridas para a acusação.
+	StatusMotor_JOGO_ENCERRADO = 8, // Exploração terminada ou acusação correta: só resta reiniciar.
+	StatusMotor_SEM_DESFAZER = 9, // Não há movimento guardado para desfazer.
+} StatusMotor;
+
+/// @brief Define a direção de um movimento do motor.
+typedef enum
+{
+	DirecaoMotor_ESQUERDA = 1,
+	DirecaoMotor_DIREITA = 2,
+} DirecaoMotor;
+
+/// @brief Define os tipos de evento produzidos pelo motor.
+typedef enum
+{
+	EventoMotor_SALA_VISITADA = 1, // sala: sala de destino.
+	EventoMotor_FIM_DO_CAMINHO = 2, // sala: sala sem a saída escolhida; valor: 1 se voltou à primeira sala.
+	EventoMotor_PISTA_COLETADA = 3, // texto: pista; suspeito: associado, ou SEM_INDICE_MOTOR; valor: pistas dele.
+	EventoMotor_ACUSACAO_LIBERADA = 4, // suspeito: atingiu as pistas requeridas; valor: pistas dele.
+	EventoMotor_ACUSACAO = 5, // suspeito: acusado; valor: 1 se é o culpado.
+	EventoMotor_MOVIMENTO_DESFEITO = 6, // sala: sala restaurada; valor: pistas descartadas.
+} TipoEventoMotor;
+
+/// @brief Define um evento do motor. O texto aponta para a descrição do caso.
+typedef struct
+{
+	TipoEventoMotor tipo;
+	int32_t sala;
+	int32_t suspeito;
+	int32_t valor;
+	const char* texto;
+} EventoMotor;
+
+/// @brief Define uma sala da descrição do caso, com as saídas por índice.
+typedef struct
+{
+	const char* nome;
+	const char* pista; // NULL ou vazio quando a sala não tem pista.
+	int32_t esquerda; // Índice da sala à esquerda, ou SEM_INDICE_MOTOR.
+	int32_t direita; // Índice da sala à direita, ou SEM_INDICE_MOTOR.
+} DescricaoSalaMotor;
+
+/// @brief Define a descrição de um caso. Os textos não são copiados: a descrição deve viver tanto quanto o motor.
+typedef struct
+{
+	const DescricaoSalaMotor* salas; // A primeira é a entrada da mansão.
+	int32_t totalSalas;
+	const char* const* suspeitos;
+	int32_t totalSuspeitos;
+	const char* const* pistasCatalogo; // Pistas do catálogo, distintas.
+	const int32_t* gruposCatalogo; // Grupo de cada pista: posição do seu suspeito após o embaralhamento.
+	int32_t totalCatalogo;
+	int32_t pistasRequeridas; // Pistas de um mesmo suspeito para liberar a acusação.
+	bool voltarAoInicio; // Verdadeiro(true): uma saída inexistente leva à primeira sala. Falso(false): encerra.
+} DescricaoCasoMotor;
+
+/// @brief Define o motor do jogo. Os campos são internos; use as funções abaixo.
+typedef struct MotorJogo MotorJogo;
+
+// **** Declarações das funções. ****
+
+// **** Funções do Motor do Jogo ****
+
+/// @brief Cria o motor para um caso e inicia a primeira partida.
+/// @param DescricaoCasoMotor. Ponteiro para a descrição do caso, conferida na criação. Somente leitura.
+/// @param Inteiro. Semente do sorteio do culpado e do embaralhamento dos suspeitos.
+/// @param MotorJogo. Ponteiro via referência, para atribuição do motor criado.
+/// @returns StatusMotor. StatusMotor_OK, em caso de sucesso.
+StatusMotor criarMotorJogo(const DescricaoCasoMotor* caso, uint64_t semente, MotorJogo** motor);
+/// @brief Reinicia a partida: volta à primeira sala, descarta as pistas e sorteia de novo o culpado.
+/// @param MotorJogo. Ponteiro via referência, usado na reinicialização.
+/// @param Inteiro. Semente da nova partida.
+/// @returns StatusMotor. StatusMotor_OK, em caso de sucesso.
+StatusMotor reiniciarMotorJogo(MotorJogo* motor, uint64_t semente);
+/// @brief Move o jogador para a sala na direção escolhida. Sem saída nessa direção, a partida volta à
+/// primeira sala ou é encerrada, conforme a descrição do caso(evento EventoMotor_FIM_DO_CAMINHO).
+/// @param MotorJogo. Ponteiro via referência, usado na navegação.
+/// @param Enumeração. Direção a seguir.
+/// @returns StatusMotor. StatusMotor_OK, ou StatusMotor_SEM_SAIDA quando a direção não tem sala.
+StatusMotor moverMotorJogo(MotorJogo* motor, DirecaoMotor direcao);
+/// @brief Leva o jogador direto a uma sala(ex: por uma porta, ou pelo nome). As saídas da descrição do
+/// caso não são conferidas: o caminho é escolhido pela interface.
+/// @param MotorJogo. Ponteiro via referência, usado na navegação.
+/// @param Inteiro. Índice da sala de destino.
+/// @returns StatusMotor. StatusMotor_OK, em caso de sucesso.
+StatusMotor irParaSalaMotorJogo(MotorJogo* motor, int32_t sala);
+/// @brief Desfaz o último movimento(moverMotorJogo ou irParaSalaMotorJogo): volta à sala anterior e à
+/// versão da árvore de pistas guardada antes dele, descontando dos suspeitos as pistas descartadas.
+/// @param MotorJogo. Ponteiro via referência, usado no desfazer.
+/// @returns StatusMotor. StatusMotor_OK, ou StatusMotor_SEM_DESFAZER sem movimento guardado.
+StatusMotor desfazerMotorJogo(MotorJogo* motor);
+/// @brief Coleta a pista da sala atual na árvore de pistas e, se for do catálogo, a soma ao seu suspeito.
+/// @param MotorJogo. Ponteiro via referência, usado na coleta.
+/// @returns StatusMotor. StatusMotor_OK, StatusMotor_SEM_PISTA ou StatusMotor_PISTA_REPETIDA.
+StatusMotor coletarPistaMotorJogo(MotorJogo* motor);
+/// @brief Verifica se uma pista já foi coletada na partida. O filtro de Bloom das pistas coletadas é
+/// consultado antes da árvore: a pista certamente ausente é rejeitada sem descer a árvore.
+/// @param MotorJogo. Ponteiro via referência, usado na consulta e nas estatísticas do filtro.
+/// @param Texto. Ponteiro para o valor de texto da pista.
+/// @returns Bool. Verdadeiro(true) se a pista foi coletada. Caso contrário, falso(false).
+bool pistaColetadaMotorJogo(MotorJogo* motor, const char* pista);
+/// @brief Consulta o suspeito associado a uma pista no catálogo.
+/// @param MotorJogo. Ponteiro usado na consulta. Somente leitura.
+/// @param Texto. Ponteiro para o valor de texto da pista.
+/// @param Inteiro. Ponteiro via referência, para o índice do suspeito.
+/// @returns StatusMotor. StatusMotor_OK, ou StatusMotor_SEM_PISTA se a pista não está no catálogo.
+StatusMotor consultarSuspeitoMotorJogo(const MotorJogo* motor, const char* pista, int32_t* suspeito);
+/// @brief Recupera a quantidade de pistas coletadas associadas a um suspeito.
+/// @param MotorJogo. Ponteiro usado na consulta. Somente leitura.
+/// @param Inteiro. Índice do suspeito.
+/// @returns Inteiro. Quantidade de pistas, ou zero se o índice for inválido.
+int32_t pistasSuspeitoMotorJogo(const MotorJogo* motor, int32_t suspeito);
+/// @brief Recupera a quantidade de pistas coletadas de todos os suspeitos, em uma única passada pelos bitsets.
+/// @param MotorJogo. Ponteiro usado na consulta. Somente leitura.
+/// @param Vetor. Ponteiro para receber a contagem de cada suspeito, com capacidade para totalSuspeitos.
+/// @param Inteiro. Quantidade mínima de pistas(ex: as requeridas para a acusação).
+/// @returns Inteiro. Quantidade de suspeitos com o mínimo de pistas.
+int32_t contarPistasSuspeitosMotorJogo(const MotorJogo* motor, int32_t* contagens, int32_t minimo);
+/// @brief Acusa um suspeito. A acusação exige as pistas requeridas; a correta encerra a partida.
+/// @param MotorJogo. Ponteiro via referência, usado na acusação.
+/// @param Inteiro. Índice do suspeito acusado.
+/// @param Bool. Ponteiro via referência, para indicar se o acusado é o culpado. Pode ser NULL.
+/// @returns StatusMotor. StatusMotor_OK quando a acusação foi julgada, ou o motivo da recusa.
+StatusMotor acusarMotorJogo(MotorJogo* motor, int32_t suspeito, bool* culpado);
+/// @brief Recupera o próximo evento da fila do motor.
+/// @param MotorJogo. Ponteiro via referência, usado na retirada do evento.
+/// @param EventoMotor. Ponteiro via referência, para atribuição do evento.
+/// @returns Bool. Verdadeiro(true) se havia um evento. Caso contrário, falso(false).
+bool proximoEventoMotorJogo(MotorJogo* motor, EventoMotor* evento);
+/// @brief Recupera a sala atual.
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Índice da sala atual.
+int32_t salaAtualMotorJogo(const MotorJogo* motor);
+/// @brief Verifica se a partida foi encerrada(fim da exploração ou acusação correta).
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Bool. Verdadeiro(true) se encerrada. Caso contrário, falso(false).
+bool encerradoMotorJogo(const MotorJogo* motor);
+/// @brief Recupera o culpado sorteado para a partida, para o registro da partida(ex: um diário).
+/// A interface não deve exibi-lo antes da acusação correta.
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Índice do culpado, ou SEM_INDICE_MOTOR se o caso não tem suspeitos.
+int32_t culpadoMotorJogo(const MotorJogo* motor);
+/// @brief Recupera o caso do motor, para acesso aos nomes das salas e dos suspeitos.
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns DescricaoCasoMotor. Ponteiro para a descrição do caso.
+const DescricaoCasoMotor* casoMotorJogo(const MotorJogo* motor);
+/// @brief Recupera a árvore das pistas coletadas, para as consultas por posição, intervalo ou nome.
+/// A árvore é do motor: muda na próxima coleta, desfazer ou reinício.
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Pista. Ponteiro raiz da árvore, ou NULL sem pistas coletadas. Somente leitura.
+const Pista* pistasMotorJogo(const MotorJogo* motor);
+/// @brief Recupera o catálogo pista → suspeito da partida, com os suspeitos sorteados pelo motor.
+/// O catálogo é do motor: é montado de novo a cada reinício.
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns TabelaHash. Ponteiro do catálogo. Somente leitura.
+const TabelaHash* catalogoMotorJogo(const MotorJogo* motor);
+/// @brief Recupera o filtro de Bloom das pistas coletadas na partida, para as estatísticas.
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns FiltroBloom. Ponteiro do filtro, ou NULL se o caso não tem salas com pista. Somente leitura.
+const FiltroBloom* filtroPistasMotorJogo(const MotorJogo* motor);
+/// @brief Recupera as estatísticas das consultas ao filtro das pistas coletadas, na partida em andamento.
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns EstatisticasBloom. Ponteiro das estatísticas. Somente leitura.
+const EstatisticasBloom* consultasPistasMotorJogo(const MotorJogo* motor);
+/// @brief Recupera as pistas coletadas, em ordem de colação pt-BR(a ordem da árvore de pistas).
+/// @param MotorJogo. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Vetor. Ponteiro para receber as pistas.
+/// @param Inteiro. Capacidade do vetor de destino.
+/// @returns Inteiro. Quantidade total de pistas coletadas, que pode passar da capacidade.
+int32_t listarPistasMotorJogo(const MotorJogo* motor, const char** destino, int32_t maximo);
+/// @brief Recupera o índice de um suspeito pelo nome.
+/// @param MotorJogo. Ponteiro usado na busca. Somente leitura.
+/// @param Texto. Nome do suspeito.
+/// @returns Inteiro. Índice do suspeito, ou SEM_INDICE_MOTOR.
+int32_t indiceSuspeitoMotorJogo(const MotorJogo* motor, const char* nome);
+/// @brief Recupera a descrição de um status, para a interface.
+/// @param StatusMotor. Valor do status.
+/// @returns Texto. Descrição constante.
+const char* descreverStatusMotor(StatusMotor status);
+/// @brief Libera a memória alocada para o motor. Os textos da descrição do caso não são liberados.
+/// @param MotorJogo. Ponteiro via referência, usado na operação de liberação.
+void liberarMotorJogo(MotorJogo* motor);
+
+#endif
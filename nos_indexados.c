@@ -0,0 +1,426 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "nos_indexados.h"
+
+// Desafio Detective Quest
+// Implementação dos nós indexados.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem cria as estruturas informa as falhas.
+
+// **** Definições de constantes. ****
+
+/// @brief Define a capacidade inicial do vetor de suspeitos do catálogo indexado: os suspeitos são poucos.
+#define CAPACIDADE_INICIAL_SUSPEITOS_INDEXADOS 8
+
+// **** Funções dos Nós Indexados ****
+
+ArvorePistasIndexada* criarArvorePistasIndexada()
+{
+	ArvorePistasIndexada* arvore = (ArvorePistasIndexada*)calloc(1, sizeof(ArvorePistasIndexada));
+	if (arvore != NULL)
+	{
+		arvore->heapTextos = criarHeapTextos();
+	}
+	if (arvore == NULL || arvore->heapTextos == NULL)
+	{
+		free(arvore);
+		return NULL;
+	}
+
+	arvore->raiz = SEM_NO_INDEXADO;
+	return arvore;
+}
+
+/// @brief Garante espaço para mais um nó no pool da árvore, dobrando os vetores paralelos quando cheios.
+/// @param ArvorePistasIndexada. Ponteiro via referência, usado na atribuição.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+static bool reservarNoPistaIndexada(ArvorePistasIndexada* arvore)
+{
+	if (arvore->total < arvore->capacidade)
+	{
+		return true;
+	}
+
+	if (arvore->capacidade >= SEM_NO_INDEXADO / 2)
+	{
+		return false; // O índice SEM_NO_INDEXADO nunca é um nó válido.
+	}
+
+	uint32_t capacidade = arvore->capacidade > 0 ? arvore->capacidade * 2 : CAPACIDADE_INICIAL_NOS_INDEXADOS;
+
+	// Cada vetor é trocado assim que realocado: uma falha no meio deixa a árvore válida, com a capacidade antiga.
+	NoPistaIndexado* nos = (NoPistaIndexado*)realloc(arvore->nos, capacidade * sizeof(NoPistaIndexado));
+	if (nos == NULL)
+	{
+		return false;
+	}
+	arvore->nos = nos;
+
+	const char** textos = (const char**)realloc((void*)arvore->textos, capacidade * sizeof(const char*));
+	if (textos == NULL)
+	{
+		return false;
+	}
+	arvore->textos = textos;
+
+	const ChaveColacao** chaves = (const ChaveColacao**)realloc((void*)arvore->chaves, capacidade * sizeof(const ChaveColacao*));
+	if (chaves == NULL)
+	{
+		return false;
+	}
+	arvore->chaves = chaves;
+
+	arvore->capacidade = capacidade;
+	return true;
+}
+
+/// @brief Recupera a altura de uma subárvore indexada, com zero para SEM_NO_INDEXADO.
+static inline uint32_t alturaNoPistaIndexada(const ArvorePistasIndexada* arvore, uint32_t no)
+{
+	return no != SEM_NO_INDEXADO ? arvore->nos[no].altura : 0;
+}
+
+/// @brief Recupera o tamanho de uma subárvore indexada, com zero para SEM_NO_INDEXADO.
+static inline uint32_t tamanhoNoPistaIndexada(const ArvorePistasIndexada* arvore, uint32_t no)
+{
+	return no != SEM_NO_INDEXADO ? arvore->nos[no].tamanho : 0;
+}
+
+/// @brief Recalcula a altura e o tamanho de um nó indexado a partir dos filhos.
+static void atualizarNoPistaIndexada(ArvorePistasIndexada* arvore, uint32_t no)
+{
+	NoPistaIndexado* atual = &arvore->nos[no];
+	uint32_t alturaEsquerda = alturaNoPistaIndexada(arvore, atual->esquerda);
+	uint32_t alturaDireita = alturaNoPistaIndexada(arvore, atual->direita);
+	atual->altura = 1 + (alturaEsquerda > alturaDireita ? alturaEsquerda : alturaDireita);
+	atual->tamanho = 1 + tamanhoNoPistaIndexada(arvore, atual->esquerda) + tamanhoNoPistaIndexada(arvore, atual->direita);
+}
+
+/// @brief Efetua uma rotação à direita em um nó indexado.
+/// @returns Inteiro. Índice da nova raiz da subárvore.
+static uint32_t rotacionarDireitaPistaIndexada(ArvorePistasIndexada* arvore, uint32_t no)
+{
+	uint32_t filho = arvore->nos[no].esquerda;
+	arvore->nos[no].esquerda = arvore->nos[filho].direita;
+	arvore->nos[filho].direita = no;
+	atualizarNoPistaIndexada(arvore, no);
+	atualizarNoPistaIndexada(arvore, filho);
+	return filho;
+}
+
+/// @brief Efetua uma rotação à esquerda em um nó indexado.
+/// @returns Inteiro. Índice da nova raiz da subárvore.
+static uint32_t rotacionarEsquerdaPistaIndexada(ArvorePistasIndexada* arvore, uint32_t no)
+{
+	uint32_t filho = arvore->nos[no].direita;
+	arvore->nos[no].direita = arvore->nos[filho].esquerda;
+	arvore->nos[filho].esquerda = no;
+	atualizarNoPistaIndexada(arvore, no);
+	atualizarNoPistaIndexada(arvore, filho);
+	return filho;
+}
+
+/// @brief Atualiza um nó indexado e o rebalanceia, com as mesmas rotações de balancearPista.
+/// @returns Inteiro. Índice da nova raiz da subárvore.
+static uint32_t balancearPistaIndexada(ArvorePistasIndexada* arvore, uint32_t no)
+{
+	atualizarNoPistaIndexada(arvore, no);
+
+	NoPistaIndexado* atual = &arvore->nos[no];
+	int fator = (int)alturaNoPistaIndexada(arvore, atual->esquerda) - (int)alturaNoPistaIndexada(arvore, atual->direita);
+	if (fator > 1)
+	{
+		const NoPistaIndexado* esquerda = &arvore->nos[atual->esquerda];
+		if (alturaNoPistaIndexada(arvore, esquerda->esquerda) < alturaNoPistaIndexada(arvore, esquerda->direita))
+		{
+			atual->esquerda = rotacionarEsquerdaPistaIndexada(arvore, atual->esquerda);
+		}
+		return rotacionarDireitaPistaIndexada(arvore, no);
+	}
+	if (fator < -1)
+	{
+		const NoPistaIndexado* direita = &arvore->nos[atual->direita];
+		if (alturaNoPistaIndexada(arvore, direita->direita) < alturaNoPistaIndexada(arvore, direita->esquerda))
+		{
+			atual->direita = rotacionarDireitaPistaIndexada(arvore, atual->direita);
+		}
+		return rotacionarEsquerdaPistaIndexada(arvore, no);
+	}
+
+	return no;
+}
+
+/// @brief Compara uma chave de colação com a de um nó indexado. O prefixo guardado no nó resolve a
+/// maior parte das comparações sem ler a chave completa.
+static inline int compararNoPistaIndexada(const ArvorePistasIndexada* arvore, const ChaveColacao* chave, uint32_t no)
+{
+	uint64_t prefixo = arvore->nos[no].prefixo;
+	if (chave->prefixo != prefixo)
+	{
+		return chave->prefixo < prefixo ? -1 : 1;
+	}
+	return compararChavesColacao(chave, arvore->chaves[no]);
+}
+
+/// @brief Insere, recursivamente, um nó já preenchido no pool em uma subárvore indexada.
+/// @param ArvorePistasIndexada. Ponteiro via referência, usado na inserção.
+/// @param Inteiro. Índice da raiz da subárvore, ou SEM_NO_INDEXADO.
+/// @param Inteiro. Índice do novo nó, ainda fora da árvore.
+/// @param Bool. Ponteiro via referência, atribuído com verdadeiro(true) se a pista já existia.
+/// @returns Inteiro. Índice da nova raiz da subárvore.
+static uint32_t inserirNoPistaIndexada(ArvorePistasIndexada* arvore, uint32_t raiz, uint32_t novo, bool* existente)
+{
+	if (raiz == SEM_NO_INDEXADO)
+	{
+		return novo;
+	}
+
+	// O pool não é realocado durante a descida: os índices, e também os ponteiros, seguem válidos.
+	int comparacao = compararNoPistaIndexada(arvore, arvore->chaves[novo], raiz);
+	if (comparacao < 0)
+	{
+		arvore->nos[raiz].esquerda = inserirNoPistaIndexada(arvore, arvore->nos[raiz].esquerda, novo, existente);
+	}
+	else if (comparacao > 0)
+	{
+		arvore->nos[raiz].direita = inserirNoPistaIndexada(arvore, arvore->nos[raiz].direita, novo, existente);
+	}
+	else
+	{
+		*existente = true;
+		return raiz; // Pista já registrada.
+	}
+
+	return *existente ? raiz : balancearPistaIndexada(arvore, raiz);
+}
+
+bool inserirPistaIndexada(ArvorePistasIndexada* arvore, const char* pista)
+{
+	// O espaço é reservado antes da descida, para que o pool não mude de endereço durante a inserção.
+	if (!reservarNoPistaIndexada(arvore))
+	{
+		return false;
+	}
+
+	char texto[TAMANHO_MAX_PISTA];
+	copiarTextoLimitado(texto, sizeof(texto), pista);
+
+	const char* internado = internarTexto(arvore->heapTextos, texto);
+	const ChaveColacao* chave = internarChaveColacao(arvore->heapTextos, texto);
+	if (internado == NULL || chave == NULL)
+	{
+		return false;
+	}
+
+	uint32_t novo = arvore->total;
+	arvore->nos[novo] = (NoPistaIndexado){ chave->prefixo, SEM_NO_INDEXADO, SEM_NO_INDEXADO, 1, 1 };
+	arvore->textos[novo] = internado;
+	arvore->chaves[novo] = chave;
+
+	bool existente = false;
+	arvore->raiz = inserirNoPistaIndexada(arvore, arvore->raiz, novo, &existente);
+	if (!existente)
+	{
+		arvore->total++; // Uma pista repetida deixa o nó reservado livre para a próxima inserção.
+	}
+
+	return true;
+}
+
+uint32_t buscarPistaIndexada(const ArvorePistasIndexada* arvore, const char* pista)
+{
+	ChaveColacao consulta;
+	unsigned char buffer[TAMANHO_MAX_CHAVE_COLACAO];
+	const ChaveColacao* chave = prepararChaveConsulta(pista, &consulta, buffer);
+
+	uint32_t atual = arvore->raiz;
+	while (atual != SEM_NO_INDEXADO)
+	{
+		int comparacao = compararNoPistaIndexada(arvore, chave, atual);
+		if (comparacao == 0)
+		{
+			return atual;
+		}
+		atual = comparacao < 0 ? arvore->nos[atual].esquerda : arvore->nos[atual].direita;
+	}
+
+	return SEM_NO_INDEXADO;
+}
+
+const char* selecionarPistaIndexada(const ArvorePistasIndexada* arvore, uint32_t posicao)
+{
+	if (posicao >= tamanhoNoPistaIndexada(arvore, arvore->raiz))
+	{
+		return NULL;
+	}
+
+	uint32_t atual = arvore->raiz;
+	while (atual != SEM_NO_INDEXADO)
+	{
+		uint32_t tamanhoEsquerda = tamanhoNoPistaIndexada(arvore, arvore->nos[atual].esquerda);
+		if (posicao < tamanhoEsquerda)
+		{
+			atual = arvore->nos[atual].esquerda;
+		}
+		else if (posicao == tamanhoEsquerda)
+		{
+			return arvore->textos[atual];
+		}
+		else
+		{
+			posicao -= tamanhoEsquerda + 1;
+			atual = arvore->nos[atual].direita;
+		}
+	}
+
+	return NULL;
+}
+
+uint32_t alturaArvorePistasIndexada(const ArvorePistasIndexada* arvore)
+{
+	return alturaNoPistaIndexada(arvore, arvore->raiz);
+}
+
+void liberarArvorePistasIndexada(ArvorePistasIndexada* arvore)
+{
+	if (arvore == NULL)
+		return;
+
+	free(arvore->nos);
+	free((void*)arvore->textos);
+	free((void*)arvore->chaves);
+	liberarHeapTextos(arvore->heapTextos);
+	free(arvore);
+}
+
+TabelaHashIndexada* criarTabelaHashIndexada()
+{
+	TabelaHashIndexada* tabela = (TabelaHashIndexada*)calloc(1, sizeof(TabelaHashIndexada));
+	if (tabela != NULL)
+	{
+		tabela->heapTextos = criarHeapTextos();
+	}
+	if (tabela == NULL || tabela->heapTextos == NULL)
+	{
+		free(tabela);
+		return NULL;
+	}
+
+	for (int i = 0; i < TAMANHO_TABELA_HASH; i++)
+	{
+		tabela->dados[i] = SEM_NO_INDEXADO;
+	}
+	return tabela;
+}
+
+/// @brief Recupera o índice de um suspeito no catálogo indexado, acrescentando-o se for novo.
+/// Os suspeitos são poucos, e as associações chegam agrupadas: o último encontrado é conferido primeiro.
+/// @param TabelaHashIndexada. Ponteiro via referência, usado na atribuição.
+/// @param Texto. Ponteiro para o valor de texto do suspeito.
+/// @returns Inteiro. Índice do suspeito, ou SEM_NO_INDEXADO em caso de falha.
+static uint32_t indiceSuspeitoIndexado(TabelaHashIndexada* tabela, const char* suspeito)
+{
+	const char* internado = internarTexto(tabela->heapTextos, suspeito);
+	if (internado == NULL)
+	{
+		return SEM_NO_INDEXADO;
+	}
+
+	// Textos internados iguais têm o mesmo endereço: a comparação é de ponteiros.
+	if (tabela->totalSuspeitos > 0 && tabela->suspeitos[tabela->totalSuspeitos - 1] == internado)
+	{
+		return tabela->totalSuspeitos - 1;
+	}
+	for (uint32_t i = 0; i < tabela->totalSuspeitos; i++)
+	{
+		if (tabela->suspeitos[i] == internado)
+		{
+			return i;
+		}
+	}
+
+	if (tabela->totalSuspeitos == tabela->capacidadeSuspeitos)
+	{
+		uint32_t capacidade = tabela->capacidadeSuspeitos > 0 ? tabela->capacidadeSuspeitos * 2 : CAPACIDADE_INICIAL_SUSPEITOS_INDEXADOS;
+		const char** suspeitos = (const char**)realloc((void*)tabela->suspeitos, capacidade * sizeof(const char*));
+		if (suspeitos == NULL)
+		{
+			return SEM_NO_INDEXADO;
+		}
+		tabela->suspeitos = suspeitos;
+		tabela->capacidadeSuspeitos = capacidade;
+	}
+
+	tabela->suspeitos[tabela->totalSuspeitos] = internado;
+	return tabela->totalSuspeitos++;
+}
+
+bool inserirNoHashIndexado(const char* pista, const char* suspeito, TabelaHashIndexada* tabela)
+{
+	if (tabela->total == tabela->capacidade)
+	{
+		if (tabela->capacidade >= SEM_NO_INDEXADO / 2)
+		{
+			return false;
+		}
+
+		uint32_t capacidade = tabela->capacidade > 0 ? tabela->capacidade * 2 : CAPACIDADE_INICIAL_NOS_INDEXADOS;
+		NoHashIndexado* nos = (NoHashIndexado*)realloc(tabela->nos, capacidade * sizeof(NoHashIndexado));
+		if (nos == NULL)
+		{
+			return false;
+		}
+		tabela->nos = nos;
+
+		const char** pistas = (const char**)realloc((void*)tabela->pistas, capacidade * sizeof(const char*));
+		if (pistas == NULL)
+		{
+			return false;
+		}
+		tabela->pistas = pistas;
+		tabela->capacidade = capacidade;
+	}
+
+	const char* internada = internarTexto(tabela->heapTextos, pista);
+	uint32_t indiceSuspeito = indiceSuspeitoIndexado(tabela, suspeito);
+	if (internada == NULL || indiceSuspeito == SEM_NO_INDEXADO)
+	{
+		return false;
+	}
+
+	// Insere no início do balde, como a tabela com ponteiros.
+	uint32_t indice = funcao_hash(pista);
+	uint32_t novo = tabela->total++;
+	tabela->nos[novo] = (NoHashIndexado){ indiceSuspeito, tabela->dados[indice] };
+	tabela->pistas[novo] = internada;
+	tabela->dados[indice] = novo;
+
+	return true;
+}
+
+uint32_t buscarNoHashIndexado(const char* pista, const TabelaHashIndexada* tabela)
+{
+	uint32_t atual = tabela->dados[funcao_hash(pista)];
+	while (atual != SEM_NO_INDEXADO)
+	{
+		if (strcmp(tabela->pistas[atual], pista) == 0)
+		{
+			return atual;
+		}
+		atual = tabela->nos[atual].proximo;
+	}
+
+	return SEM_NO_INDEXADO;
+}
+
+void liberarTabelaHashIndexada(TabelaHashIndexada* tabela)
+{
+	if (tabela == NULL)
+		return;
+
+	free(tabela->nos);
+	free((void*)tabela->pistas);
+	free((void*)tabela->suspeitos);
+	liberarHeapTextos(tabela->heapTextos);
+	free(tabela);
+}
@@ -0,0 +1,124 @@
+#ifndef NOS_INDEXADOS_H
+#define NOS_INDEXADOS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "textos_compactos.h"
+#include "catalogo_pistas.h"
+
+// Desafio Detective Quest
+// Nós indexados: a árvore de pistas e o catálogo pista → suspeito sobre pools de nós, com filhos e
+// próximos como índices de 32 bits, no lugar de um malloc por nó. Os textos ficam em vetores paralelos.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o índice usado nos pools de nós indexados para indicar a ausência de nó.
+#define SEM_NO_INDEXADO UINT32_MAX
+/// @brief Define a capacidade inicial, em nós, de um pool de nós indexados.
+#define CAPACIDADE_INICIAL_NOS_INDEXADOS 64
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um nó de pista indexado: os filhos são índices de 32 bits no pool da árvore, e o texto
+/// e a chave de colação ficam em vetores paralelos ao pool, na mesma posição do nó.
+/// Com 24 bytes, dois nós e meio cabem em uma linha de cache(o nó Pista ocupa 48 bytes).
+typedef struct
+{
+	uint64_t prefixo; // Primeiros bytes da chave de colação: resolvem a maior parte das comparações sem sair do pool.
+	uint32_t esquerda; // Índice do nó à esquerda, ou SEM_NO_INDEXADO.
+	uint32_t direita; // Índice do nó à direita, ou SEM_NO_INDEXADO.
+	uint32_t tamanho; // Quantidade de nós na subárvore, incluindo o próprio nó.
+	uint32_t altura; // Altura da subárvore, usada no balanceamento.
+} NoPistaIndexado;
+
+/// @brief Define a árvore AVL de pistas sobre um pool de nós indexados: uma alocação por vetor,
+/// que cresce em dobro, no lugar de um malloc por nó.
+typedef struct
+{
+	NoPistaIndexado* nos;
+	const char** textos; // Texto internado de cada nó.
+	const ChaveColacao** chaves; // Chave de colação internada de cada nó.
+	uint32_t total;
+	uint32_t capacidade;
+	uint32_t raiz; // Índice da raiz, ou SEM_NO_INDEXADO na árvore vazia.
+	HeapTextos* heapTextos; // Textos e chaves da árvore.
+} ArvorePistasIndexada;
+
+/// @brief Define um nó indexado do catálogo pista → suspeito. A pista do nó fica no vetor paralelo de pistas.
+typedef struct
+{
+	uint32_t suspeito; // Índice em suspeitos.
+	uint32_t proximo; // Próximo nó do balde, ou SEM_NO_INDEXADO.
+} NoHashIndexado;
+
+/// @brief Define o catálogo pista → suspeito sobre um pool de nós indexados, com a mesma função hash
+/// e os mesmos baldes da TabelaHash. Cada suspeito é guardado uma única vez.
+typedef struct
+{
+	uint32_t dados[TAMANHO_TABELA_HASH]; // Primeiro nó de cada balde, ou SEM_NO_INDEXADO.
+	NoHashIndexado* nos;
+	const char** pistas; // Pista internada de cada nó.
+	uint32_t total;
+	uint32_t capacidade;
+	const char** suspeitos; // Suspeitos internados, sem repetições.
+	uint32_t totalSuspeitos;
+	uint32_t capacidadeSuspeitos;
+	HeapTextos* heapTextos; // Pistas e suspeitos do catálogo.
+} TabelaHashIndexada;
+
+// **** Funções dos Nós Indexados ****
+
+/// @brief Efetua a criação de uma árvore de pistas indexada, vazia.
+/// @returns ArvorePistasIndexada. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+ArvorePistasIndexada* criarArvorePistasIndexada();
+/// @brief Efetua uma inserção na árvore de pistas indexada. A pista é truncada como em inserirPista.
+/// @param ArvorePistasIndexada. Ponteiro via referência, usado na inserção.
+/// @param Texto. Valor descrevendo a pista.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso, inclusive se a pista já existia. Caso contrário, falso(false).
+bool inserirPistaIndexada(ArvorePistasIndexada* arvore, const char* pista);
+/// @brief Efetua a busca de uma pista na árvore indexada.
+/// @param ArvorePistasIndexada. Ponteiro usado na busca. Somente leitura.
+/// @param Texto. Ponteiro para o valor de texto da pista a procurar.
+/// @returns Inteiro. Índice do nó no pool, ou SEM_NO_INDEXADO se a pista não estiver na árvore.
+uint32_t buscarPistaIndexada(const ArvorePistasIndexada* arvore, const char* pista);
+/// @brief Recupera a pista de uma posição(select) na ordem alfabética.
+/// @param ArvorePistasIndexada. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Posição desejada, começando em zero.
+/// @returns Texto. Ponteiro para o texto da pista, ou NULL se a posição for inválida.
+const char* selecionarPistaIndexada(const ArvorePistasIndexada* arvore, uint32_t posicao);
+/// @brief Recupera a altura da árvore de pistas indexada.
+/// @param ArvorePistasIndexada. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Valor informando a altura, conforme especificado.
+uint32_t alturaArvorePistasIndexada(const ArvorePistasIndexada* arvore);
+/// @brief Libera a memória alocada para a árvore de pistas indexada, com o heap dos textos e das chaves.
+/// @param ArvorePistasIndexada. Ponteiro via referência, usado na operação de liberação.
+void liberarArvorePistasIndexada(ArvorePistasIndexada* arvore);
+/// @brief Efetua a criação de um catálogo indexado, vazio.
+/// @returns TabelaHashIndexada. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+TabelaHashIndexada* criarTabelaHashIndexada();
+/// @brief Efetua a inserção de valores de pista e suspeito associados no catálogo indexado.
+/// Como em inserirNoHash, o novo nó é inserido no início do balde.
+/// @param Texto. Ponteiro para o valor de texto da pista a inserir.
+/// @param Texto. Ponteiro para o valor de texto do suspeito a inserir.
+/// @param TabelaHashIndexada. Ponteiro via referência, usado na inserção.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool inserirNoHashIndexado(const char* pista, const char* suspeito, TabelaHashIndexada* tabela);
+/// @brief Efetua a busca de uma pista no catálogo indexado.
+/// @param Texto. Ponteiro para o valor de texto da pista a procurar.
+/// @param TabelaHashIndexada. Ponteiro usado na busca. Somente leitura.
+/// @returns Inteiro. Índice do nó no pool, ou SEM_NO_INDEXADO se a pista não estiver no catálogo.
+uint32_t buscarNoHashIndexado(const char* pista, const TabelaHashIndexada* tabela);
+/// @brief Recupera o suspeito de um nó do catálogo indexado.
+/// @param TabelaHashIndexada. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice do nó, ou SEM_NO_INDEXADO.
+/// @returns Texto. Ponteiro para o nome do suspeito, ou NULL se o nó não existir.
+static inline const char* suspeitoNoHashIndexado(const TabelaHashIndexada* tabela, uint32_t no)
+{
+	return no != SEM_NO_INDEXADO ? tabela->suspeitos[tabela->nos[no].suspeito] : NULL;
+}
+/// @brief Libera a memória alocada para o catálogo indexado, com o heap das pistas e dos suspeitos.
+/// @param TabelaHashIndexada. Ponteiro via referência, usado na operação de liberação.
+void liberarTabelaHashIndexada(TabelaHashIndexada* tabela);
+
+#endif
@@ -0,0 +1,156 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "pontuacao_suspeitos.h"
+
+// Desafio Detective Quest
+// Implementação da pontuação bayesiana dos suspeitos.
+// Nenhuma função deste arquivo usa a entrada ou a saída do console: quem inicia a pontuação informa as falhas.
+
+// **** Funções da Pontuação de Suspeitos ****
+
+bool iniciarPontuacaoSuspeitos(PontuacaoSuspeitos* pontuacao, int32_t totalSuspeitos)
+{
+	memset(pontuacao, 0, sizeof(PontuacaoSuspeitos));
+	if (totalSuspeitos < 1)
+	{
+		return false;
+	}
+
+	pontuacao->logVerossimilhanca = (float*)calloc((size_t)totalSuspeitos, sizeof(float));
+	if (pontuacao->logVerossimilhanca == NULL)
+	{
+		return false;
+	}
+
+	// A priori uniforme: todos os logs em zero, e cada suspeito contribui com peso 1.
+	pontuacao->totalSuspeitos = totalSuspeitos;
+	pontuacao->somaPesos = (double)totalSuspeitos;
+	return true;
+}
+
+void recalcularSomaPontuacao(PontuacaoSuspeitos* pontuacao)
+{
+	const float* logs = pontuacao->logVerossimilhanca;
+	int32_t total = pontuacao->totalSuspeitos;
+
+	float maior = logs[0];
+	for (int32_t i = 1; i < total; i++)
+	{
+		maior = logs[i] > maior ? logs[i] : maior;
+	}
+
+	double soma = 0.0;
+	for (int32_t i = 0; i < total; i++)
+	{
+		soma += exp((double)logs[i] - maior);
+	}
+
+	pontuacao->referencia = maior;
+	pontuacao->somaPesos = soma;
+	pontuacao->recalculos++;
+}
+
+void registrarPistaPontuacao(PontuacaoSuspeitos* pontuacao, const int32_t* suspeitos, int32_t totalApontados,
+	double razaoVerossimilhanca)
+{
+	if (pontuacao->logVerossimilhanca == NULL || razaoVerossimilhanca <= 0.0)
+	{
+		return;
+	}
+
+	float* logs = pontuacao->logVerossimilhanca;
+	double logRazao = log(razaoVerossimilhanca);
+	double referencia = pontuacao->referencia;
+	bool recalcular = false;
+
+	// Os demais suspeitos não mudam: a soma é corrigida apenas com os pesos dos apontados.
+	for (int32_t i = 0; i < totalApontados; i++)
+	{
+		int32_t suspeito = suspeitos[i];
+		if (suspeito < 0 || suspeito >= pontuacao->totalSuspeitos)
+		{
+			continue;
+		}
+
+		double anterior = logs[suspeito];
+		logs[suspeito] = (float)(anterior + logRazao);
+		pontuacao->somaPesos += exp((double)logs[suspeito] - referencia) - exp(anterior - referencia);
+		recalcular = recalcular || logs[suspeito] - referencia > LIMITE_REFERENCIA_PONTUACAO;
+	}
+	pontuacao->pistas++;
+
+	// Raro: a referência ficou longe demais da maior pontuação, ou uma pista que inocenta anulou a soma.
+	if (recalcular || !(pontuacao->somaPesos > 0.0))
+	{
+		recalcularSomaPontuacao(pontuacao);
+	}
+}
+
+void aplicarEvidenciasPontuacao(PontuacaoSuspeitos* pontuacao, const float* logRazoes)
+{
+	if (pontuacao->logVerossimilhanca == NULL)
+	{
+		return;
+	}
+
+	float* logs = pontuacao->logVerossimilhanca;
+	int32_t total = pontuacao->totalSuspeitos;
+
+	// Um laço simples sobre vetores densos de float: o compilador o vetoriza(SIMD).
+	for (int32_t i = 0; i < total; i++)
+	{
+		logs[i] += logRazoes[i];
+	}
+	pontuacao->pistas++;
+
+	recalcularSomaPontuacao(pontuacao);
+}
+
+double probabilidadeSuspeito(const PontuacaoSuspeitos* pontuacao, int32_t suspeito)
+{
+	if (suspeito < 0 || suspeito >= pontuacao->totalSuspeitos)
+	{
+		return 0.0;
+	}
+
+	return exp((double)pontuacao->logVerossimilhanca[suspeito] - pontuacao->referencia) / pontuacao->somaPesos;
+}
+
+int32_t classificarSuspeitos(const PontuacaoSuspeitos* pontuacao, int32_t* destino, int32_t maximo)
+{
+	const float* logs = pontuacao->logVerossimilhanca;
+	int32_t total = 0;
+
+	if (maximo < 1)
+	{
+		return 0;
+	}
+
+	// Inserção ordenada nos melhores até aqui: O(suspeitos x maximo), com maximo pequeno.
+	for (int32_t i = 0; i < pontuacao->totalSuspeitos; i++)
+	{
+		float valor = logs[i];
+		if (total == maximo && valor <= logs[destino[total - 1]])
+		{
+			continue; // Não entra entre os melhores; em empate, fica o de menor índice.
+		}
+
+		int32_t posicao = total < maximo ? total++ : total - 1;
+		while (posicao > 0 && logs[destino[posicao - 1]] < valor)
+		{
+			destino[posicao] = destino[posicao - 1];
+			posicao--;
+		}
+		destino[posicao] = i;
+	}
+
+	return total;
+}
+
+void liberarPontuacaoSuspeitos(PontuacaoSuspeitos* pontuacao)
+{
+	free(pontuacao->logVerossimilhanca);
+	memset(pontuacao, 0, sizeof(PontuacaoSuspeitos));
+}
@@ -0,0 +1,72 @@
+#ifndef PONTUACAO_SUSPEITOS_H
+#define PONTUACAO_SUSPEITOS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Desafio Detective Quest
+// Pontuação bayesiana dos suspeitos: a probabilidade de cada um ser o culpado, atualizada a cada pista
+// coletada em tempo proporcional aos suspeitos apontados, e a classificação dos mais prováveis.
+
+// **** Definições de constantes. ****
+
+/// @brief Define quantas vezes é mais provável uma pista apontar para o culpado do que para um inocente
+/// (razão de verossimilhança da pontuação bayesiana dos suspeitos).
+#define RAZAO_VEROSSIMILHANCA_PISTA 3.0
+/// @brief Define a distância máxima, em log, entre uma pontuação e a referência da soma dos pesos,
+/// antes de a soma ser recalculada com todos os suspeitos(evita estouro em exp).
+#define LIMITE_REFERENCIA_PONTUACAO 64.0
+
+// **** Definições de estruturas. ****
+
+/// @brief Define a pontuação bayesiana dos suspeitos. Cada suspeito guarda o log da verossimilhança das
+/// pistas coletadas(a priori uniforme), e a probabilidade é exp(log - referencia) / somaPesos.
+/// Uma pista altera apenas os suspeitos que aponta, e a soma dos pesos é corrigida só com eles.
+typedef struct
+{
+	float* logVerossimilhanca; // Vetor denso, um valor por suspeito: as atualizações em lote são vetorizadas(SIMD).
+	int32_t totalSuspeitos;
+	double referencia; // Log tomado como base dos pesos, perto da maior pontuação.
+	double somaPesos; // Soma de exp(logVerossimilhanca - referencia) de todos os suspeitos.
+	unsigned long long pistas; // Pistas(ou lotes de evidências) aplicadas.
+	unsigned long long recalculos; // Vezes em que a soma foi recalculada com todos os suspeitos.
+} PontuacaoSuspeitos;
+
+// **** Funções da Pontuação de Suspeitos ****
+
+/// @brief Inicia a pontuação de suspeitos com a priori uniforme.
+/// @param PontuacaoSuspeitos. Ponteiro via referência, para atribuição.
+/// @param Inteiro. Quantidade de suspeitos.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool iniciarPontuacaoSuspeitos(PontuacaoSuspeitos* pontuacao, int32_t totalSuspeitos);
+/// @brief Aplica uma pista que aponta alguns suspeitos, em O(suspeitos apontados).
+/// @param PontuacaoSuspeitos. Ponteiro via referência, usado na atribuição.
+/// @param Vetor. Índices dos suspeitos apontados pela pista. Índices inválidos são ignorados.
+/// @param Inteiro. Quantidade de suspeitos apontados.
+/// @param Real. Razão de verossimilhança da pista: maior que 1 incrimina, menor que 1 inocenta.
+void registrarPistaPontuacao(PontuacaoSuspeitos* pontuacao, const int32_t* suspeitos, int32_t totalApontados,
+	double razaoVerossimilhanca);
+/// @brief Recalcula a soma dos pesos com todos os suspeitos, tomando a maior pontuação como referência.
+/// As atualizações já a mantêm; o recálculo completo a cada pista serve de referência nas medições.
+/// @param PontuacaoSuspeitos. Ponteiro via referência, usado na atribuição.
+void recalcularSomaPontuacao(PontuacaoSuspeitos* pontuacao);
+/// @brief Aplica um lote de evidências a todos os suspeitos de uma vez, somando um vetor denso de logs.
+/// @param PontuacaoSuspeitos. Ponteiro via referência, usado na atribuição.
+/// @param Vetor. Log da razão de verossimilhança de cada suspeito, com totalSuspeitos valores.
+void aplicarEvidenciasPontuacao(PontuacaoSuspeitos* pontuacao, const float* logRazoes);
+/// @brief Recupera a probabilidade de um suspeito ser o culpado, dadas as pistas aplicadas.
+/// @param PontuacaoSuspeitos. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Inteiro. Índice do suspeito.
+/// @returns Real. Probabilidade entre 0 e 1, ou 0 para um índice inválido.
+double probabilidadeSuspeito(const PontuacaoSuspeitos* pontuacao, int32_t suspeito);
+/// @brief Classifica os suspeitos mais prováveis, em ordem decrescente de probabilidade.
+/// @param PontuacaoSuspeitos. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @param Vetor. Ponteiro para receber os índices dos suspeitos.
+/// @param Inteiro. Capacidade do vetor.
+/// @returns Inteiro. Quantidade de suspeitos atribuídos ao vetor.
+int32_t classificarSuspeitos(const PontuacaoSuspeitos* pontuacao, int32_t* destino, int32_t maximo);
+/// @brief Libera a memória alocada para a pontuação de suspeitos.
+/// @param PontuacaoSuspeitos. Ponteiro via referência, usado na operação de liberação.
+void liberarPontuacaoSuspeitos(PontuacaoSuspeitos* pontuacao);
+
+#endif
@@ -0,0 +1,490 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "textos_compactos.h"
+
+// Desafio Detective Quest
+// Implementação dos textos compactos, do heap de textos internados e das chaves de colação.
+
+// **** Definições de estruturas. ****
+
+/// @brief Define um bloco de um heap de textos.
+typedef struct BlocoHeapTextos
+{
+	struct BlocoHeapTextos* proximo;
+	size_t usado;
+	size_t capacidade;
+	char dados[];
+} BlocoHeapTextos;
+
+/// @brief Define uma entrada do conjunto de textos internados: o texto e, se já calculada, a sua chave de colação.
+typedef struct
+{
+	const char* texto;
+	const ChaveColacao* chave;
+} EntradaHeapTextos;
+
+/// @brief Define o heap de textos: blocos contíguos e um conjunto(endereçamento aberto)
+/// para encontrar a cópia já internada de cada texto.
+struct HeapTextos
+{
+	BlocoHeapTextos* blocos;
+	EntradaHeapTextos* entradas;
+	size_t capacidade; // Sempre potência de 2.
+	size_t total;
+	size_t bytes;
+	const char* regioes[MAXIMO_REGIOES_MAPEADAS][2]; // Início e fim das regiões mapeadas registradas.
+	int totalRegioes;
+};
+
+// **** Funções de Textos Compactos ****
+
+/// @brief Efetua o hash(FNV-1a) de um texto, usado pelo heap de textos.
+static size_t hashTexto(const char* texto)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (const unsigned char* p = (const unsigned char*)texto; *p != '\0'; p++)
+	{
+		h ^= *p;
+		h *= 1099511628211ULL;
+	}
+	return (size_t)(h ^ (h >> 32));
+}
+
+HeapTextos* criarHeapTextos()
+{
+	return (HeapTextos*)calloc(1, sizeof(HeapTextos));
+}
+
+/// @brief Dobra a capacidade do conjunto de textos internados, reposicionando as entradas.
+static bool crescerHeapTextos(HeapTextos* heap)
+{
+	size_t novaCapacidade = heap->capacidade == 0 ? 1024 : heap->capacidade * 2;
+	EntradaHeapTextos* novas = (EntradaHeapTextos*)calloc(novaCapacidade, sizeof(EntradaHeapTextos));
+	if (novas == NULL)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < heap->capacidade; i++)
+	{
+		const char* texto = heap->entradas[i].texto;
+		if (texto != NULL)
+		{
+			size_t posicao = hashTexto(texto) & (novaCapacidade - 1);
+			while (novas[posicao].texto != NULL)
+			{
+				posicao = (posicao + 1) & (novaCapacidade - 1);
+			}
+			novas[posicao] = heap->entradas[i];
+		}
+	}
+
+	free(heap->entradas);
+	heap->entradas = novas;
+	heap->capacidade = novaCapacidade;
+	return true;
+}
+
+/// @brief Reserva espaço contíguo no bloco atual, ou em um bloco novo, no alinhamento pedido(potência de 2).
+static char* reservarHeapTextos(HeapTextos* heap, size_t tamanho, size_t alinhamento)
+{
+	BlocoHeapTextos* bloco = heap->blocos;
+	size_t inicio = bloco != NULL ? (bloco->usado + alinhamento - 1) & ~(alinhamento - 1) : 0;
+	if (bloco == NULL || inicio > bloco->capacidade || bloco->capacidade - inicio < tamanho)
+	{
+		size_t capacidade = tamanho > TAMANHO_BLOCO_HEAP_TEXTOS ? tamanho : TAMANHO_BLOCO_HEAP_TEXTOS;
+		bloco = (BlocoHeapTextos*)malloc(sizeof(BlocoHeapTextos) + capacidade);
+		if (bloco == NULL)
+		{
+			return NULL;
+		}
+		bloco->usado = 0;
+		bloco->capacidade = capacidade;
+		bloco->proximo = heap->blocos;
+		heap->blocos = bloco;
+		heap->bytes += sizeof(BlocoHeapTextos) + capacidade;
+		inicio = 0; // malloc já devolve memória alinhada para qualquer tipo.
+	}
+
+	char* destino = bloco->dados + inicio;
+	bloco->usado = inicio + tamanho;
+	return destino;
+}
+
+/// @brief Lê os primeiros 8 bytes de uma chave de colação como inteiro big-endian, completando com zeros.
+static uint64_t prefixoChaveColacao(const unsigned char* bytes, size_t tamanho)
+{
+	uint64_t prefixo = 0;
+	for (size_t i = 0; i < 8; i++)
+	{
+		prefixo = (prefixo << 8) | (i < tamanho ? bytes[i] : 0);
+	}
+	return prefixo;
+}
+
+const ChaveColacao* prepararChaveConsulta(const char* texto, ChaveColacao* chave, unsigned char* buffer)
+{
+	// Um texto de até TAMANHO_MAX_PISTA - 1 bytes sempre cabe no buffer; os maiores são truncados como as pistas guardadas.
+	char limitado[TAMANHO_MAX_PISTA];
+	if (strnlen(texto, TAMANHO_MAX_PISTA) == TAMANHO_MAX_PISTA)
+	{
+		copiarTextoLimitado(limitado, sizeof(limitado), texto);
+		texto = limitado;
+	}
+
+	size_t tamanho = montarChaveColacao(texto, buffer, TAMANHO_MAX_CHAVE_COLACAO);
+	chave->tamanho = (uint32_t)tamanho;
+	chave->bytes = buffer;
+	chave->prefixo = prefixoChaveColacao(buffer, tamanho);
+	return chave;
+}
+
+/// @brief Verifica se um texto está em uma das regiões mapeadas registradas no heap.
+static bool textoMapeado(const HeapTextos* heap, const char* texto)
+{
+	uintptr_t endereco = (uintptr_t)texto;
+	for (int i = 0; i < heap->totalRegioes; i++)
+	{
+		if (endereco >= (uintptr_t)heap->regioes[i][0] && endereco < (uintptr_t)heap->regioes[i][1])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/// @brief Localiza a entrada de um texto no conjunto, internando o texto se for novo.
+/// A entrada vale até a próxima inserção.
+/// @returns EntradaHeapTextos. Ponteiro para a entrada, ou NULL em caso de falha de alocação.
+static EntradaHeapTextos* localizarEntradaHeapTextos(HeapTextos* heap, const char* texto)
+{
+	// Mantém a ocupação do conjunto abaixo de 50%.
+	if ((heap->total + 1) * 2 > heap->capacidade && !crescerHeapTextos(heap))
+	{
+		return NULL;
+	}
+
+	size_t posicao = hashTexto(texto) & (heap->capacidade - 1);
+	while (heap->entradas[posicao].texto != NULL)
+	{
+		if (strcmp(heap->entradas[posicao].texto, texto) == 0)
+		{
+			return &heap->entradas[posicao]; // Já internado: reaproveita a mesma cópia.
+		}
+		posicao = (posicao + 1) & (heap->capacidade - 1);
+	}
+
+	// Um texto de uma região mapeada já é imutável e vive tanto quanto ela: fica no próprio endereço.
+	const char* copia = texto;
+	if (!textoMapeado(heap, texto))
+	{
+		size_t tamanho = strlen(texto) + 1;
+		char* destino = reservarHeapTextos(heap, tamanho, 1);
+		if (destino == NULL)
+		{
+			return NULL;
+		}
+		memcpy(destino, texto, tamanho);
+		copia = destino;
+	}
+
+	heap->entradas[posicao].texto = copia;
+	heap->entradas[posicao].chave = NULL;
+	heap->total++;
+	return &heap->entradas[posicao];
+}
+
+const char* internarTexto(HeapTextos* heap, const char* texto)
+{
+	EntradaHeapTextos* entrada = localizarEntradaHeapTextos(heap, texto);
+	return entrada != NULL ? entrada->texto : NULL;
+}
+
+const ChaveColacao* internarChaveColacao(HeapTextos* heap, const char* texto)
+{
+	EntradaHeapTextos* entrada = localizarEntradaHeapTextos(heap, texto);
+	if (entrada != NULL && entrada->chave == NULL)
+	{
+		// A chave fica logo após o seu cabeçalho, no mesmo bloco.
+		size_t tamanho = montarChaveColacao(texto, NULL, 0);
+		char* memoria = reservarHeapTextos(heap, sizeof(ChaveColacao) + tamanho, _Alignof(ChaveColacao));
+		if (memoria != NULL)
+		{
+			ChaveColacao* chave = (ChaveColacao*)memoria;
+			unsigned char* bytes = (unsigned char*)(memoria + sizeof(ChaveColacao));
+			montarChaveColacao(texto, bytes, tamanho);
+
+			chave->tamanho = (uint32_t)tamanho;
+			chave->bytes = bytes;
+			chave->prefixo = prefixoChaveColacao(bytes, tamanho);
+			entrada->chave = chave;
+		}
+	}
+
+	return entrada != NULL ? entrada->chave : NULL;
+}
+
+size_t bytesHeapTextos(const HeapTextos* heap)
+{
+	return heap->bytes + heap->capacidade * sizeof(EntradaHeapTextos);
+}
+
+void liberarHeapTextos(HeapTextos* heap)
+{
+	if (heap == NULL)
+		return;
+
+	while (heap->blocos != NULL)
+	{
+		BlocoHeapTextos* temp = heap->blocos;
+		heap->blocos = temp->proximo;
+		free(temp);
+	}
+
+	free(heap->entradas);
+	free(heap);
+}
+
+bool registrarRegiaoMapeada(HeapTextos* heap, const char* inicio, size_t tamanho)
+{
+	if (heap->totalRegioes == MAXIMO_REGIOES_MAPEADAS)
+	{
+		return false;
+	}
+
+	heap->regioes[heap->totalRegioes][0] = inicio;
+	heap->regioes[heap->totalRegioes][1] = inicio + tamanho;
+	heap->totalRegioes++;
+	return true;
+}
+
+void esquecerRegiaoMapeada(HeapTextos* heap, const char* inicio, size_t tamanho)
+{
+	for (int i = 0; i < heap->totalRegioes; i++)
+	{
+		if (heap->regioes[i][0] == inicio)
+		{
+			heap->regioes[i][0] = heap->regioes[heap->totalRegioes - 1][0];
+			heap->regioes[i][1] = heap->regioes[heap->totalRegioes - 1][1];
+			heap->totalRegioes--;
+			break;
+		}
+	}
+
+	// Reconstrói o conjunto sem as entradas da região: no endereçamento aberto, remover no lugar
+	// quebraria as sequências de sondagem das demais. As chaves delas ficam nos blocos até a liberação.
+	uintptr_t de = (uintptr_t)inicio, ate = (uintptr_t)inicio + tamanho;
+	size_t removidas = 0;
+	for (size_t i = 0; i < heap->capacidade; i++)
+	{
+		uintptr_t endereco = (uintptr_t)heap->entradas[i].texto;
+		removidas += heap->entradas[i].texto != NULL && endereco >= de && endereco < ate;
+	}
+
+	EntradaHeapTextos* novas = removidas > 0 ? (EntradaHeapTextos*)calloc(heap->capacidade, sizeof(EntradaHeapTextos)) : NULL;
+	if (novas != NULL)
+	{
+		for (size_t i = 0; i < heap->capacidade; i++)
+		{
+			const char* texto = heap->entradas[i].texto;
+			if (texto != NULL && ((uintptr_t)texto < de || (uintptr_t)texto >= ate))
+			{
+				size_t posicao = hashTexto(texto) & (heap->capacidade - 1);
+				while (novas[posicao].texto != NULL)
+				{
+					posicao = (posicao + 1) & (heap->capacidade - 1);
+				}
+				novas[posicao] = heap->entradas[i];
+			}
+		}
+
+		free(heap->entradas);
+		heap->entradas = novas;
+		heap->total -= removidas;
+	}
+	else if (removidas > 0)
+	{
+		// Sem memória para reconstruir: as entradas apontariam para bytes desmapeados, então o
+		// conjunto inteiro é descartado. Os textos copiados continuam nos blocos, mas deixam de ser reaproveitados.
+		memset(heap->entradas, 0, heap->capacidade * sizeof(EntradaHeapTextos));
+		heap->total = 0;
+	}
+}
+
+bool textoEmRegiaoMapeada(const HeapTextos* heap, const char* texto)
+{
+	return heap->totalRegioes > 0 && textoMapeado(heap, texto);
+}
+
+bool atribuirTextoCompacto(HeapTextos* heap, TextoCompacto* destino, const char* texto)
+{
+	size_t tamanho = strlen(texto);
+
+	if (tamanho < TAMANHO_TEXTO_CURTO)
+	{
+		memcpy(destino->curto, texto, tamanho + 1);
+		destino->longo = NULL;
+		return true;
+	}
+
+	// Um texto longo de um arquivo mapeado é referenciado no próprio arquivo, sem passar pelo conjunto.
+	destino->curto[0] = '\0';
+	destino->longo = textoEmRegiaoMapeada(heap, texto) ? texto : internarTexto(heap, texto);
+	return destino->longo != NULL;
+}
+
+bool copiarTextoLimitado(char* destino, size_t capacidade, const char* origem)
+{
+	if (capacidade == 0)
+	{
+		return false;
+	}
+
+	size_t tamanho = strlen(origem);
+	if (tamanho < capacidade)
+	{
+		memcpy(destino, origem, tamanho + 1);
+		return true;
+	}
+
+	// Recua até o início de um caractere UTF-8, para não cortar uma sequência multibyte.
+	size_t corte = capacidade - 1;
+	while (corte > 0 && ((unsigned char)origem[corte] & 0xC0) == 0x80)
+	{
+		corte--;
+	}
+
+	memcpy(destino, origem, corte);
+	destino[corte] = '\0';
+	return false;
+}
+
+/// @brief Letra base(sem acento) de cada caractere de U+00C0 a U+00DF, e de U+00E0 a U+00FF
+/// na mesma posição. '?' indica um caractere sem decomposição(Æ, Ð, ×, Ø, Þ, ß).
+static const char BASES_LATIN1[] = "aaaaaa?ceeeeiiii?nooooo??uuuuy??";
+/// @brief Acento de cada caractere de U+00C0 a U+00DF: 0 nenhum, 1 agudo, 2 grave, 3 circunflexo,
+/// 4 til, 5 trema, 6 anel, 7 cedilha.
+static const char ACENTOS_LATIN1[] = "21345607213521350421345002135100";
+
+/// @brief Decodifica um caractere UTF-8. Bytes inválidos são lidos como um caractere cada.
+/// @returns Inteiro. Ponto de código; *tamanho recebe a quantidade de bytes consumidos.
+static uint32_t decodificarUtf8(const unsigned char* texto, int* tamanho)
+{
+	unsigned char c = texto[0];
+	int bytes = c < 0x80 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 0;
+	uint32_t ponto = bytes == 2 ? (c & 0x1Fu) : bytes == 3 ? (c & 0x0Fu) : (c & 0x07u);
+
+	for (int i = 1; i < bytes; i++)
+	{
+		if ((texto[i] & 0xC0) != 0x80)
+		{
+			bytes = 0; // Sequência interrompida.
+			break;
+		}
+		ponto = (ponto << 6) | (texto[i] & 0x3Fu);
+	}
+
+	if (bytes <= 1)
+	{
+		*tamanho = 1;
+		return c;
+	}
+
+	*tamanho = bytes;
+	return ponto;
+}
+
+size_t montarChaveColacao(const char* texto, unsigned char* destino, size_t capacidade)
+{
+	// Os três níveis são gerados em passadas separadas sobre o texto, para ficarem contíguos na chave.
+	size_t tamanho = 0;
+	for (int nivel = 0; nivel < 3; nivel++)
+	{
+		if (nivel > 0)
+		{
+			if (tamanho < capacidade)
+			{
+				destino[tamanho] = 0x00; // Separador: menor que qualquer peso.
+			}
+			tamanho++;
+		}
+
+		// Pesos mínimos no fim de um nível(sem acento, minúscula) são omitidos: a comparação não muda,
+		// porque textos com os mesmos pesos primários têm a mesma quantidade de caracteres.
+		size_t fimSignificativo = tamanho;
+		const unsigned char* p = (const unsigned char*)texto;
+		while (*p != '\0')
+		{
+			int bytes;
+			uint32_t ponto = decodificarUtf8(p, &bytes);
+			p += bytes;
+
+			char base = 0;
+			unsigned char acento = 0, maiuscula = 0;
+			if ((ponto >= 'a' && ponto <= 'z') || (ponto >= 'A' && ponto <= 'Z'))
+			{
+				base = (char)(ponto | 0x20);
+				maiuscula = ponto <= 'Z';
+			}
+			else if (ponto >= 0xC0 && ponto <= 0xFF && BASES_LATIN1[ponto & 0x1F] != '?')
+			{
+				base = BASES_LATIN1[ponto & 0x1F];
+				acento = (unsigned char)(ACENTOS_LATIN1[ponto & 0x1F] - '0');
+				maiuscula = ponto < 0xE0;
+			}
+			else if (ponto == 0xFF)
+			{
+				base = 'y';
+				acento = 5; // ÿ: na tabela, a mesma posição corresponde a ß, sem decomposição.
+			}
+
+			unsigned char pesos[4];
+			int totalPesos = 0;
+			if (nivel == 0)
+			{
+				// Pontuação e espaços < dígitos < letras < demais caracteres, em ordem de ponto de código.
+				if (base != 0)
+				{
+					pesos[totalPesos++] = (unsigned char)(0x8B + (base - 'a'));
+				}
+				else if (ponto >= '0' && ponto <= '9')
+				{
+					pesos[totalPesos++] = (unsigned char)(0x81 + (ponto - '0'));
+				}
+				else if (ponto < 0x80)
+				{
+					pesos[totalPesos++] = (unsigned char)(ponto + 1);
+				}
+				else
+				{
+					pesos[totalPesos++] = 0xF0;
+					pesos[totalPesos++] = (unsigned char)(ponto >> 16);
+					pesos[totalPesos++] = (unsigned char)(ponto >> 8);
+					pesos[totalPesos++] = (unsigned char)ponto;
+				}
+			}
+			else
+			{
+				pesos[totalPesos++] = (unsigned char)(1 + (nivel == 1 ? acento : maiuscula));
+			}
+
+			for (int i = 0; i < totalPesos; i++)
+			{
+				if (tamanho < capacidade)
+				{
+					destino[tamanho] = pesos[i];
+				}
+				tamanho++;
+			}
+			if (nivel == 0 || pesos[0] != 1)
+			{
+				fimSignificativo = tamanho;
+			}
+		}
+		tamanho = fimSignificativo;
+	}
+
+	return tamanho;
+}
+
@@ -0,0 +1,155 @@
+#ifndef TEXTOS_COMPACTOS_H
+#define TEXTOS_COMPACTOS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Desafio Detective Quest
+// Textos compactos dos nós(curtos no próprio nó, longos em um heap de textos), o heap de textos
+// internados e as chaves de colação pt-BR, que tornam a ordem alfabética uma comparação de bytes.
+// Cada heap pertence a quem o cria(uma partida, uma tabela) e não usa trava: é usado por uma única
+// thread de cada vez, e os textos já internados podem ser lidos por qualquer thread.
+
+// **** Definições de constantes. ****
+
+/// @brief Define o tamanho máximo do nome de uma sala ou de um suspeito, incluindo o terminador.
+#define TAMANHO_MAX_NOME 50
+/// @brief Define o tamanho máximo para o texto descritivo da pista.
+#define TAMANHO_MAX_PISTA 80
+/// @brief Define a capacidade, em bytes(incluindo o terminador), do texto guardado dentro do próprio nó.
+/// Textos maiores são internados no heap de textos.
+#define TAMANHO_TEXTO_CURTO 16
+/// @brief Define o tamanho de cada bloco de um heap de textos.
+#define TAMANHO_BLOCO_HEAP_TEXTOS 65536
+/// @brief Define o tamanho máximo da chave de colação de uma pista de até TAMANHO_MAX_PISTA bytes:
+/// até 4 bytes de peso primário e 1 de cada peso secundário e terciário por caractere, e 2 separadores.
+#define TAMANHO_MAX_CHAVE_COLACAO (TAMANHO_MAX_PISTA * 6 + 2)
+/// @brief Define a quantidade máxima de arquivos mapeados ao mesmo tempo cujos textos um heap referencia sem copiar.
+#define MAXIMO_REGIOES_MAPEADAS 8
+
+// **** Definições de estruturas. ****
+
+/// @brief Define a chave binária de colação(pt-BR) de um texto: comparar duas chaves com memcmp
+/// equivale a comparar os textos em ordem alfabética, ignorando acentos e caixa, que só desempatam.
+/// Os primeiros 8 bytes ficam também em um inteiro, que resolve a maior parte das comparações.
+typedef struct
+{
+	uint64_t prefixo; // Primeiros 8 bytes da chave, em big-endian, completados com zeros.
+	uint32_t tamanho;
+	const unsigned char* bytes;
+} ChaveColacao;
+
+/// @brief Define um texto compacto: textos curtos ficam no próprio nó; os longos apontam para
+/// uma cópia única em um heap de textos(ou para um literal estático, ou para um arquivo mapeado).
+/// Acesse sempre por lerTextoCompacto.
+typedef struct
+{
+	const char* longo; // NULL quando o texto cabe em curto.
+	char curto[TAMANHO_TEXTO_CURTO];
+} TextoCompacto;
+
+/// @brief Define um heap de textos internados: blocos contíguos e um conjunto para encontrar a cópia
+/// já internada de cada texto. Os campos são internos; use as funções abaixo.
+typedef struct HeapTextos HeapTextos;
+
+// **** Funções de Textos Compactos ****
+
+/// @brief Efetua a criação de um heap de textos, vazio. Nenhum bloco é reservado antes do primeiro texto.
+/// @returns HeapTextos. Ponteiro do tipo conforme especificado, ou NULL em caso de falha.
+HeapTextos* criarHeapTextos();
+/// @brief Atribui um valor a um texto compacto. Textos curtos são copiados para o nó;
+/// os longos são internados no heap(os de uma região mapeada, sem cópia).
+/// @param HeapTextos. Ponteiro via referência do heap dos textos longos.
+/// @param TextoCompacto. Ponteiro via referência, para atribuição.
+/// @param Texto. Ponteiro para o valor de texto a atribuir.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário, falso(false).
+bool atribuirTextoCompacto(HeapTextos* heap, TextoCompacto* destino, const char* texto);
+/// @brief Recupera o valor de um texto compacto.
+/// @param TextoCompacto. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Texto. Ponteiro para o valor de texto, terminado em '\0'.
+static inline const char* lerTextoCompacto(const TextoCompacto* texto)
+{
+	return texto->longo != NULL ? texto->longo : texto->curto;
+}
+/// @brief Interna um texto no heap: textos iguais passam a ter uma única cópia.
+/// @param HeapTextos. Ponteiro via referência, usado na internação.
+/// @param Texto. Ponteiro para o valor de texto a internar.
+/// @returns Texto. Ponteiro para a cópia internada, válida até liberarHeapTextos, ou NULL em caso de falha.
+const char* internarTexto(HeapTextos* heap, const char* texto);
+/// @brief Interna a chave de colação de um texto no heap, calculando-a uma única vez por texto.
+/// @param HeapTextos. Ponteiro via referência, usado na internação.
+/// @param Texto. Ponteiro para o valor de texto.
+/// @returns ChaveColacao. Ponteiro para a chave, válida até liberarHeapTextos, ou NULL em caso de falha.
+const ChaveColacao* internarChaveColacao(HeapTextos* heap, const char* texto);
+/// @brief Recupera a quantidade de bytes ocupados pelo heap: os blocos e o conjunto dos textos internados.
+/// @param HeapTextos. Ponteiro usado na recuperação de informações. Somente leitura.
+/// @returns Inteiro. Quantidade de bytes.
+size_t bytesHeapTextos(const HeapTextos* heap);
+/// @brief Libera o heap de textos. Nenhum texto compacto longo nem chave internados nele podem ser usados depois.
+/// @param HeapTextos. Ponteiro via referência, usado na operação de liberação.
+void liberarHeapTextos(HeapTextos* heap);
+/// @brief Registra uma região mapeada somente para leitura: os textos que estão nela passam a ser
+/// internados pelo próprio endereço, sem cópia para o heap.
+/// @param HeapTextos. Ponteiro via referência, usado no registro.
+/// @param Texto. Ponteiro para o início da região.
+/// @param Inteiro. Tamanho da região, em bytes.
+/// @returns Bool. Verdadeiro(true) em caso de sucesso. Caso contrário(limite de regiões), falso(false).
+bool registrarRegiaoMapeada(HeapTextos* heap, const char* inicio, size_t tamanho);
+/// @brief Remove o registro de uma região mapeada e esquece os textos internados que apontam para ela.
+/// Os nós que ainda referenciam esses textos devem ser liberados antes.
+/// @param HeapTextos. Ponteiro via referência, usado na remoção.
+/// @param Texto. Ponteiro para o início da região.
+/// @param Inteiro. Tamanho da região, em bytes.
+void esquecerRegiaoMapeada(HeapTextos* heap, const char* inicio, size_t tamanho);
+/// @brief Verifica se um texto está em uma região mapeada registrada, e portanto pode ser referenciado sem cópia.
+/// @param HeapTextos. Ponteiro usado na verificação. Somente leitura.
+/// @param Texto. Ponteiro para o valor de texto.
+/// @returns Bool. Verdadeiro(true) se o texto está em uma região mapeada. Caso contrário, falso(false).
+bool textoEmRegiaoMapeada(const HeapTextos* heap, const char* texto);
+/// @brief Monta a chave de colação(pt-BR) de um texto UTF-8 em três níveis: letras sem acento e sem caixa,
+/// depois acentos, depois caixa. Textos distintos sempre têm chaves distintas.
+/// @param Texto. Ponteiro para o valor de texto.
+/// @param Vetor. Ponteiro para receber os bytes da chave.
+/// @param Inteiro. Capacidade do vetor de destino.
+/// @returns Inteiro. Tamanho total da chave; se maior que a capacidade, a chave foi truncada.
+size_t montarChaveColacao(const char* texto, unsigned char* destino, size_t capacidade);
+/// @brief Prepara a chave de colação de um texto de consulta em um buffer local, sem internar o texto.
+/// Como as pistas guardadas, o texto é considerado apenas até TAMANHO_MAX_PISTA - 1 bytes.
+/// @param Texto. Ponteiro para o valor de texto.
+/// @param ChaveColacao. Ponteiro via referência, para atribuição.
+/// @param Vetor. Buffer com capacidade TAMANHO_MAX_CHAVE_COLACAO.
+/// @returns ChaveColacao. Ponteiro para a chave pronta.
+const ChaveColacao* prepararChaveConsulta(const char* texto, ChaveColacao* chave, unsigned char* buffer);
+/// @brief Compara duas chaves de colação.
+/// @param ChaveColacao. Ponteiro para a primeira chave. Somente leitura.
+/// @param ChaveColacao. Ponteiro para a segunda chave. Somente leitura.
+/// @returns Inteiro. Negativo, zero ou positivo, como strcmp.
+static inline int compararChavesColacao(const ChaveColacao* a, const ChaveColacao* b)
+{
+	if (a->prefixo != b->prefixo)
+	{
+		return a->prefixo < b->prefixo ? -1 : 1;
+	}
+
+	uint32_t menor = a->tamanho < b->tamanho ? a->tamanho : b->tamanho;
+	if (menor > 8)
+	{
+		int comparacao = memcmp(a->bytes + 8, b->bytes + 8, menor - 8);
+		if (comparacao != 0)
+		{
+			return comparacao;
+		}
+	}
+
+	return a->tamanho == b->tamanho ? 0 : (a->tamanho < b->tamanho ? -1 : 1);
+}
+/// @brief Copia um texto para um buffer de tamanho fixo, truncando em um limite de caractere UTF-8.
+/// @param Texto. Ponteiro para o buffer de destino.
+/// @param Inteiro. Capacidade do buffer, incluindo o terminador.
+/// @param Texto. Ponteiro para o valor de texto de origem.
+/// @returns Bool. Verdadeiro(true) se o texto coube inteiro. Caso contrário, falso(false).
+bool copiarTextoLimitado(char* destino, size_t capacidade, const char* origem);
+
+#endif